@@ -23,7 +23,7 @@
 
 namespace Library
 {
-	// TODO: Array<bool> can be specialized as a bit-array to save memory.
+	// Array<bool> stays a byte per element since Datum hands out bool& into it. See BitArray for a packed one.
 	
 	/**
 	 * A contiguous-memory dynamically resizing array.
@@ -717,12 +717,58 @@ namespace Library
 #pragma region Query
 		/**
 		 * Does an O(n) search for the first occurrence of the passed element.
+		 * Compares a vector of elements at once if T IsSimdSearchable.
 		 * 
 		 * @param t				the element to query for.
 		 * @returns				the index of the first element found, or Size() if it was not found.
 		 */
 		size_type IndexOf(const T& t) const;
 
+		/**
+		 * Does an O(n) search for the first occurrence of the passed element.
+		 * Compares a vector of elements at once if T IsSimdSearchable.
+		 * 
+		 * @param t				the element to query for.
+		 * @returns				an iterator to the first element found, or end() if it was not found.
+		 */
+		[[nodiscard]] iterator Find(const T& t);
+
+		/**
+		 * Does an O(n) search for the first occurrence of the passed element.
+		 * Compares a vector of elements at once if T IsSimdSearchable.
+		 * 
+		 * @param t				the element to query for.
+		 * @returns				an iterator to the first element found, or end() if it was not found.
+		 */
+		[[nodiscard]] const_iterator Find(const T& t) const;
+
+		/**
+		 * O(n)
+		 * Compares a vector of elements at once if T IsSimdSearchable.
+		 * 
+		 * @param t				the element to query for.
+		 * @returns				whether any element equals t.
+		 */
+		[[nodiscard]] bool Contains(const T& t) const;
+
+		/**
+		 * O(n)
+		 * Compares a vector of elements at once if T IsSimdSearchable.
+		 * 
+		 * @param t				the element to count.
+		 * @returns				how many elements equal t.
+		 */
+		[[nodiscard]] size_type Count(const T& t) const;
+
+		/**
+		 * O(n)
+		 * 
+		 * @param predicate		the predicate to query with.
+		 * @returns				how many elements satisfy predicate.
+		 */
+		template<std::predicate<T> Predicate>
+		[[nodiscard]] size_type Count(Predicate predicate) const;
+
 		/**
 		 * Does an O(n) search for the first element matching the passed predicate.
 		 *
@@ -913,9 +959,45 @@ namespace Library
 		 */
 		void DestructAll(const size_type first, const size_type last) noexcept;
 
+		/**
+		 * Whether IndexOf, Count and everything built on them can compare elements with Memory::SimdFind and Memory::SimdCount.
+		 * Floats and doubles are, with ±0 and NaN handled separately.
+		 */
+		static constexpr bool IsSimdSearchable = (Util::IsBitwiseComparable<T>::value || std::is_same_v<T, float> || std::is_same_v<T, double>)
+			&& (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8 || sizeof(T) == 12 || sizeof(T) == 16);
+
+		/**
+		 * Memory::SimdFind or Memory::SimdCount, fixed up for floating point.
+		 *
+		 * @param <CountAll>	whether to count every match or stop at the first
+		 * @param t				the element to query for
+		 * @returns				how many matched if CountAll, otherwise the index of the first match or Size()
+		 */
+		template<bool CountAll>
+		size_type SimdSearch(const T& t) const noexcept;
+
+		/**
+		 * Moves the elements to a new allocation of newCapacity, or frees them if it's 0.
+		 * Assumes newCapacity >= Size().
+		 * 
+		 * @param newCapacity	How many elements the new allocation can hold.
+		 */
+		void Reallocate(size_type newCapacity) noexcept;
+
+		/**
+		 * Moves count elements from source to dest, leaving source uninitialized.
+		 * The ranges may overlap.
+		 * A memmove if T IsTriviallyRelocatable, otherwise each element is move constructed then destructed.
+		 * 
+		 * @param dest			Where to move the elements to, uninitialized where it doesn't overlap source.
+		 * @param source		The elements to move.
+		 * @param count			How many elements to move.
+		 */
+		static void Relocate(T* dest, T* source, size_type count) noexcept;
+
 		/**
 		 * Shifts the internal array to the right starting at the passed index.
-		 * Moves memory as if calling the destructor on elements before they're overwritten and after they're moved.
+		 * Leaves [startIndex, startIndex + shiftAmount) uninitialized.
 		 * 
 		 * @param startIndex	The index to start the shifts at.
 		 * @param shiftAmount	How much to shift by.
@@ -924,7 +1006,7 @@ namespace Library
 
 		/**
 		 * Shifts the internal array to the left starting at the passed index.
-		 * Moves memory as if calling the destructor on elements before they're overwritten and after they're moved.
+		 * Assumes [startIndex, startIndex + shiftAmount) have already been destructed.
 		 * 
 		 * @param startIndex	The index to start the shifts at.
 		 * @param shiftAmount	How much to shift by.
@@ -973,6 +1055,9 @@ namespace Library
 		void SetPostMoveState();
 #pragma endregion
 	};
+
+	template<typename T, Concept::ReserveStrategy ReserveStrategy>
+	struct Util::IsTriviallyRelocatable<Array<T, ReserveStrategy>> : std::true_type {};
 }
 
 #include "Array.inl"
@@ -394,9 +394,12 @@ namespace Library
 			const size_type newCapacity = InvokeReserveStrategy();
 			T* newArray = Memory::Malloc<T>(newCapacity);
 
-			// This is how we avoid the extra move. By copying things after index one space ahead.
-			Memory::Memcpy(newArray, array, index);
-			Memory::Memcpy(newArray + index + 1, array + index, size - index);
+			// args may refer to an element, so construct before the elements move.
+			new (newArray + index) T(std::forward<Args>(args)...);
+
+			// This is how we avoid the extra move. By relocating things after index one space ahead.
+			Relocate(newArray, array, index);
+			Relocate(newArray + index + 1, array + index, size - index);
 
 			Memory::Free(array);
 			array = newArray;
@@ -406,8 +409,8 @@ namespace Library
 		else
 		{
 			ShiftRight(index);
+			new (array + index) T(std::forward<Args>(args)...);
 		}
-		new (array + index) T(std::forward<Args>(args)...);
 		return array[index];
 	}
 
@@ -498,7 +501,13 @@ namespace Library
 	TEMPLATE
 	inline bool ARRAY::Remove(const T& t)
 	{
-		return Remove([&t](const auto& a) { return t == a; });
+		if (const size_type index = IndexOf(t); index != size)
+		{
+			array[index].~T();
+			ShiftLeft(index);
+			return true;
+		}
+		return false;
 	}
 
 	TEMPLATE
@@ -526,7 +535,15 @@ namespace Library
 	TEMPLATE
 	inline size_t ARRAY::RemoveAll(const T& t)
 	{
-		return RemoveAll([&t](const auto& a) { return t == a; });
+		// nothing before the first match needs to be looked at twice
+		const size_type first = IndexOf(t);
+		if (first == size)
+		{
+			return 0;
+		}
+		const size_type oldSize = size;
+		Remove(iterator(std::remove_if(begin() + first, end(), [&t](const auto& a) { return t == a; })), end());
+		return oldSize - size;
 	}
 
 	TEMPLATE
@@ -603,7 +620,14 @@ namespace Library
 	TEMPLATE
 	inline size_t ARRAY::IndexOf(const T& t) const
 	{
-		return Util::Find(*this, t).data - array;
+		if constexpr (IsSimdSearchable)
+		{
+			return SimdSearch<false>(t);
+		}
+		else
+		{
+			return std::find(array, array + size, t) - array;
+		}
 	}
 
 	TEMPLATE
@@ -612,6 +636,44 @@ namespace Library
 	{
 		return Util::Find(*this, predicate).data - array;
 	}
+
+	TEMPLATE
+	inline typename ARRAY::iterator ARRAY::Find(const T& t)
+	{
+		return iterator(IndexOf(t), *this);
+	}
+
+	TEMPLATE
+	inline typename ARRAY::const_iterator ARRAY::Find(const T& t) const
+	{
+		return const_iterator(IndexOf(t), *this);
+	}
+
+	TEMPLATE
+	inline bool ARRAY::Contains(const T& t) const
+	{
+		return IndexOf(t) != size;
+	}
+
+	TEMPLATE
+	inline size_t ARRAY::Count(const T& t) const
+	{
+		if constexpr (IsSimdSearchable)
+		{
+			return SimdSearch<true>(t);
+		}
+		else
+		{
+			return std::count(array, array + size, t);
+		}
+	}
+
+	TEMPLATE
+	template<std::predicate<T> Predicate>
+	inline size_t ARRAY::Count(const Predicate predicate) const
+	{
+		return std::count_if(array, array + size, predicate);
+	}
 #pragma endregion
 
 #pragma region Memory	
@@ -659,8 +721,7 @@ namespace Library
 	{
 		if (newCapacity > Capacity())
 		{
-			Memory::Realloc(array, newCapacity);
-			capacity = internal_size_type(newCapacity);
+			Reallocate(newCapacity);
 		}
 	}
 
@@ -668,8 +729,8 @@ namespace Library
 	inline void ARRAY::Resize(size_type newSize, const T& prototype)
 	{
 		DestructAll(newSize, size);
-		Memory::Realloc(array, newSize);
-		capacity = internal_size_type(newSize);
+		size = internal_size_type(std::min(newSize, Size()));
+		Reallocate(newSize);
 		Fill(prototype);
 	}
 
@@ -685,8 +746,7 @@ namespace Library
 		// No operation to perform if we're already shrunk.
 		if (Capacity() != count)
 		{
-			capacity = internal_size_type(std::max(count, Size()));
-			Memory::Realloc(array, capacity);
+			Reallocate(std::max(count, Size()));
 		}
 	}
 
@@ -777,17 +837,96 @@ namespace Library
 		}
 	}
 
+	TEMPLATE
+	template<bool CountAll>
+	inline size_t ARRAY::SimdSearch(const T& t) const noexcept
+	{
+		if constexpr (std::is_floating_point_v<T>)
+		{
+			if (t != t)
+			{
+				// NaN equals nothing
+				return CountAll ? 0 : size;
+			}
+			if (t == T(0))
+			{
+				// 0 and -0 are equal but their bytes aren't
+				const T zeros[] = { T(0), -T(0) };
+				if constexpr (CountAll)
+				{
+					return Memory::SimdCount(array, size, zeros, sizeof(T)) + Memory::SimdCount(array, size, zeros + 1, sizeof(T));
+				}
+				else
+				{
+					return std::min(Memory::SimdFind(array, size, zeros, sizeof(T)), Memory::SimdFind(array, size, zeros + 1, sizeof(T)));
+				}
+			}
+		}
+
+		if constexpr (CountAll)
+		{
+			return Memory::SimdCount(array, size, &t, sizeof(T));
+		}
+		else
+		{
+			return Memory::SimdFind(array, size, &t, sizeof(T));
+		}
+	}
+
+	TEMPLATE
+	inline void ARRAY::Reallocate(const size_type newCapacity) noexcept
+	{
+		if constexpr (Util::IsTriviallyRelocatable<T>::value)
+		{
+			Memory::Realloc(array, newCapacity);
+		}
+		else
+		{
+			T* newArray = Memory::Malloc<T>(newCapacity);
+			Relocate(newArray, array, size);
+			Memory::Free(array);
+			array = newArray;
+		}
+		capacity = internal_size_type(newCapacity);
+	}
+
+	TEMPLATE
+	inline void ARRAY::Relocate(T* dest, T* source, const size_type count) noexcept
+	{
+		if constexpr (Util::IsTriviallyRelocatable<T>::value)
+		{
+			Memory::Memmove(dest, source, count);
+		}
+		else if (dest < source)
+		{
+			for (size_type i = 0; i < count; ++i)
+			{
+				new (dest + i) T(std::move(source[i]));
+				source[i].~T();
+			}
+		}
+		else if (dest > source)
+		{
+			// backwards so nothing's overwritten before it's moved
+			for (size_type i = count; i-- > 0;)
+			{
+				new (dest + i) T(std::move(source[i]));
+				source[i].~T();
+			}
+		}
+	}
+
 	TEMPLATE
 	inline void ARRAY::ShiftRight(size_type startIndex, size_type shiftAmount) noexcept
 	{
-		Memory::Memmove(array + startIndex + shiftAmount, array + startIndex, std::max(difference_type(0), difference_type(size) - difference_type(shiftAmount) - difference_type(startIndex) + difference_type(1)));
+		Relocate(array + startIndex + shiftAmount, array + startIndex, size - startIndex);
 		size += internal_size_type(shiftAmount);
 	}
 
 	TEMPLATE
 	inline void ARRAY::ShiftLeft(size_type startIndex, size_type shiftAmount) noexcept
 	{
-		Memory::Memmove(array + startIndex, array + startIndex + shiftAmount, size - shiftAmount - startIndex);
+		Relocate(array + startIndex, array + startIndex + shiftAmount, size - shiftAmount - startIndex);
 		size -= internal_size_type(shiftAmount);
 	}
 	
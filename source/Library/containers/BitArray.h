@@ -0,0 +1,726 @@
+// MIT License Copyright (c) 2020 Jarrett Wendt
+
+#pragma once
+
+#include "Macros.h"
+#include "Memory.h"
+#include "Util.h"
+
+#include <algorithm>			// std::equal
+#include <bit>					// std::popcount, std::countr_zero
+#include <concepts>				// std::invocable, std::predicate
+#include <initializer_list>		// std::initializer_list
+#include <iterator>				// std::random_access_iterator_tag
+#include <ostream>
+
+#define TEMPLATE template<Concept::ReserveStrategy ReserveStrategy>
+#define BITARRAY BitArray<ReserveStrategy>
+
+namespace Library
+{
+	/**
+	 * A dynamically resizing array of bools packed 1 bit per element.
+	 * Takes an 8th of the memory of an Array<bool>, and Count, IndexOf and Remove scan a whole word of 64 elements at a time.
+	 *
+	 * This isn't an Array<bool> specialization because Datum and VariantArray hand out bool& into their Arrays
+	 * and accept external bool* storage, neither of which a packed bit can be.
+	 * Elements are accessed through a reference proxy instead, the same as std::vector<bool>.
+	 *
+	 * @param <ReserveStrategy>		A callable type for determining a new capacity given the current memory usage.
+	 */
+	template<Concept::ReserveStrategy ReserveStrategy = Util::DefaultReserveStrategy>
+	class BitArray final
+	{
+	public:
+		using Word = uint64_t;
+		constexpr static size_t wordBits = sizeof(Word) * 8;
+
+		class reference;
+		using value_type = bool;
+		using const_reference = bool;
+		using size_type = size_t;
+		using difference_type = ptrdiff_t;
+		using reserve_strategy = ReserveStrategy;
+
+	private:
+		using internal_size_type = uint32_t;
+
+		/** bits at Size() and beyond are always 0 */
+		Word* words{ nullptr };
+		internal_size_type size{ 0 };
+		/** always a multiple of wordBits */
+		internal_size_type capacity{ 0 };
+
+	public:
+#pragma region Special Members
+		/**
+		 * default ctor
+		 * creates an empty container owning no memory
+		 */
+		BitArray() = default;
+
+		/**
+		 * explicit ctor
+		 *
+		 * @param capacity		how many elements worth of space to reserve
+		 */
+		explicit BitArray(size_type capacity);
+
+		/**
+		 * explicit ctor
+		 *
+		 * @param count			how many elements to construct
+		 * @param prototype		value for each element
+		 */
+		BitArray(size_type count, bool prototype);
+
+		/**
+		 * explicit ctor
+		 * Fills the container with values read through the iterators.
+		 *
+		 * @param <It>			the iterator type
+		 * @param first			the beginning iterator, inclusive
+		 * @param last			the last iterator, exclusive
+		 */
+		template<std::forward_iterator It>
+		BitArray(It first, It last);
+
+		/**
+		 * initializer_list ctor
+		 *
+		 * @param list		the initializer_list to construct this container from
+		 */
+		BitArray(std::initializer_list<bool> list);
+
+		/**
+		 * copy ctor
+		 *
+		 * @param other		the container to copy
+		 */
+		BitArray(const BitArray& other);
+
+		/**
+		 * move ctor
+		 *
+		 * @param other		the container to move, left empty afterwards
+		 */
+		BitArray(BitArray&& other) noexcept;
+
+		/**
+		 * copy assignment
+		 *
+		 * @param other		the container to copy
+		 * @returns			this container after assignment
+		 */
+		BitArray& operator=(const BitArray& other);
+
+		/**
+		 * move assignment
+		 *
+		 * @param other		the container to move, left empty afterwards
+		 * @returns			this container after assignment
+		 */
+		BitArray& operator=(BitArray&& other) noexcept;
+
+		/**
+		 * dtor
+		 * frees all associated memory
+		 */
+		~BitArray();
+#pragma endregion
+
+#pragma region reference
+		/**
+		 * Stands in for a bool& to a single bit.
+		 */
+		class reference final
+		{
+			friend class BitArray;
+
+			Word* word{ nullptr };
+			Word mask{ 0 };
+
+		public:
+			/**
+			 * @param word		the word holding the bit
+			 * @param mask		a single set bit, at the position of the referenced one
+			 */
+			reference(Word* word, const Word mask) noexcept : word(word), mask(mask) {}
+
+			reference(const reference&) noexcept = default;
+			~reference() = default;
+
+			/**
+			 * Assigns the value rather than rebinding, the same as a bool& would.
+			 *
+			 * @param other		the bit to read
+			 * @returns			this
+			 */
+			reference& operator=(const reference& other) noexcept { return operator=(bool(other)); }
+
+			/**
+			 * @param t		the value to write to the bit
+			 * @returns		this
+			 */
+			reference& operator=(const bool t) noexcept
+			{
+				*word = t ? *word | mask : *word & ~mask;
+				return *this;
+			}
+
+			/**
+			 * @returns		the value of the bit
+			 */
+			[[nodiscard]] operator bool() const noexcept { return *word & mask; }
+
+			/**
+			 * Inverts the bit.
+			 */
+			void Flip() noexcept { *word ^= mask; }
+
+			/**
+			 * Swaps the referenced bits, for std::swap and algorithms like std::reverse.
+			 */
+			friend void swap(reference left, reference right) noexcept
+			{
+				const bool t = left;
+				left = bool(right);
+				right = t;
+			}
+		};
+#pragma endregion
+
+#pragma region iterator
+		class iterator final
+		{
+			friend class BitArray;
+			friend class const_iterator;
+
+		private:
+			Word* words{ nullptr };
+			size_type index{ 0 };
+
+		public:
+			using iterator_category = std::random_access_iterator_tag;
+			using value_type = bool;
+			using difference_type = ptrdiff_t;
+			using pointer = void;
+			using reference = typename BitArray::reference;
+
+			/**
+			 * explicit constructor
+			 *
+			 * @param index		index for this iterator to start at
+			 * @param owner		the container this iterator references
+			 */
+			iterator(const size_type index, BitArray& owner) noexcept :
+				words(owner.words), index(index) {}
+
+			SPECIAL_MEMBERS(iterator, default)
+
+			/**
+			 * @param left		lhs of the operator
+			 * @param right		rhs of the operator
+			 * @returns			the difference between the indices of the two iterators
+			 */
+			[[nodiscard]] friend difference_type operator-(const iterator left, const iterator right) noexcept
+			{
+				assertm(left.words == right.words, "iterators must belong to the same container");
+				return difference_type(left.index) - difference_type(right.index);
+			}
+
+			/**
+			 * @param i		how much to increment the iterator by
+			 * @returns		a new iterator at that index
+			 */
+			[[nodiscard]] iterator operator+(const difference_type i) const noexcept
+			{
+				iterator ret = *this;
+				ret.index += i;
+				return ret;
+			}
+
+			/**
+			 * @returns		a proxy to the bit the iterator is at
+			 */
+			[[nodiscard]] reference operator*() const noexcept
+			{
+				return reference(words + index / wordBits, Word(1) << index % wordBits);
+			}
+
+			[[nodiscard]] reference operator[](const difference_type i) const noexcept { return *(*this + i); }
+			[[nodiscard]] bool operator==(const iterator& other) const noexcept { return index == other.index; }
+			[[nodiscard]] bool operator<(const iterator& other) const noexcept { return index < other.index; }
+
+			RANDOM_ITER_ARITHMETIC_OPS(iterator)
+			[[nodiscard]] bool operator!=(const iterator& other) const noexcept { return !operator==(other); }
+			[[nodiscard]] bool operator<=(const iterator& other) const noexcept { return index <= other.index; }
+			[[nodiscard]] bool operator>(const iterator& other) const noexcept { return index > other.index; }
+			[[nodiscard]] bool operator>=(const iterator& other) const noexcept { return index >= other.index; }
+		};
+
+		class const_iterator final
+		{
+			friend class BitArray;
+
+		private:
+			iterator it{};
+
+		public:
+			using iterator_category = std::random_access_iterator_tag;
+			using value_type = bool;
+			using difference_type = ptrdiff_t;
+			using pointer = void;
+			using reference = bool;
+
+			const_iterator(const iterator it) noexcept : it(it) {}
+
+			/**
+			 * explicit constructor
+			 *
+			 * @param index		index for this iterator to start at
+			 * @param owner		the container this iterator references
+			 */
+			const_iterator(const size_type index, const BitArray& owner) noexcept :
+				it{ index, const_cast<BitArray&>(owner) } {}
+
+			SPECIAL_MEMBERS(const_iterator, default)
+
+			[[nodiscard]] friend difference_type operator-(const const_iterator left, const const_iterator right) noexcept { return left.it - right.it; }
+			[[nodiscard]] const_iterator operator+(const difference_type i) const noexcept { return it + i; }
+			[[nodiscard]] reference operator*() const noexcept { return *it; }
+			[[nodiscard]] reference operator[](const difference_type i) const noexcept { return it[i]; }
+			[[nodiscard]] bool operator==(const const_iterator& other) const noexcept { return it == other.it; }
+			[[nodiscard]] bool operator<(const const_iterator& other) const noexcept { return it < other.it; }
+
+			RANDOM_ITER_ARITHMETIC_OPS(const_iterator)
+			[[nodiscard]] bool operator!=(const const_iterator& other) const noexcept { return it != other.it; }
+			[[nodiscard]] bool operator<=(const const_iterator& other) const noexcept { return it <= other.it; }
+			[[nodiscard]] bool operator>(const const_iterator& other) const noexcept { return it > other.it; }
+			[[nodiscard]] bool operator>=(const const_iterator& other) const noexcept { return it >= other.it; }
+		};
+
+		BEGIN_END(iterator, const_iterator, BitArray)
+		MAKE_REVERSE_BEGIN_END
+#pragma endregion
+
+#pragma region Properties
+		/**
+		 * @returns		true if the container is empty, false otherwise
+		 */
+		[[nodiscard]] constexpr bool IsEmpty() const noexcept;
+
+		/**
+		 * @returns		true if the container is full, false otherwise
+		 */
+		[[nodiscard]] constexpr bool IsFull() const noexcept;
+
+		/**
+		 * @returns		How many elements are in the container.
+		 */
+		[[nodiscard]] constexpr size_type Size() const noexcept;
+
+		/**
+		 * @returns		The number of elements this container can hold without resizing, always a multiple of wordBits.
+		 */
+		[[nodiscard]] constexpr size_type Capacity() const noexcept;
+
+		/**
+		 * @param it	an iterator
+		 * @returns		the index represented by the iterator
+		 */
+		[[nodiscard]] constexpr size_type IndexOf(const_iterator it) const noexcept;
+#pragma endregion
+
+#pragma region Element Access
+		/**
+		 * Returns a proxy to the given index with bounds checking.
+		 *
+		 * @param index		position of the element to return
+		 * @returns			proxy to the requested element
+		 *
+		 * @throws std::out_of_range	if index >= Size()
+		 */
+		[[nodiscard]] reference At(size_t index);
+
+		/**
+		 * @param index		position of the element to return
+		 * @returns			the requested element
+		 *
+		 * @throws std::out_of_range	if index >= Size()
+		 */
+		[[nodiscard]] bool At(size_t index) const;
+
+		/**
+		 * Same as At(index).
+		 *
+		 * @throws std::out_of_range	if index >= Size()
+		 */
+		[[nodiscard]] reference operator[](size_t index);
+
+		/**
+		 * Same as At(index).
+		 *
+		 * @throws std::out_of_range	if index >= Size()
+		 */
+		[[nodiscard]] bool operator[](size_t index) const;
+
+		/**
+		 * @throws std::out_of_range	if the container is empty
+		 */
+		[[nodiscard]] reference Front();
+
+		/**
+		 * @throws std::out_of_range	if the container is empty
+		 */
+		[[nodiscard]] bool Front() const;
+
+		/**
+		 * @throws std::out_of_range	if the container is empty
+		 */
+		[[nodiscard]] reference Back();
+
+		/**
+		 * @throws std::out_of_range	if the container is empty
+		 */
+		[[nodiscard]] bool Back() const;
+#pragma endregion
+
+#pragma region Insert
+		/**
+		 * Inserts t at index, shifting everything after it to the right a word at a time.
+		 * O(n/64) where n = Size() - index
+		 *
+		 * @param index		where to insert, may be Size()
+		 * @param t			the value to insert
+		 *
+		 * @throws std::out_of_range	if index > Size()
+		 */
+		void Insert(size_t index, bool t);
+
+		/**
+		 * amortized O(1)
+		 *
+		 * @param t		the value to append
+		 */
+		void PushBack(bool t);
+
+		/**
+		 * O(n/64)
+		 *
+		 * @param t		the value to prepend
+		 */
+		void PushFront(bool t);
+
+		/**
+		 * Sets every element to t.
+		 * O(n/64)
+		 *
+		 * @param t		the value to fill with
+		 */
+		void Fill(bool t) noexcept;
+
+		/**
+		 * Inverts every element.
+		 * O(n/64)
+		 */
+		void Flip() noexcept;
+#pragma endregion
+
+#pragma region Remove
+		/**
+		 * Removes the first element equal to t.
+		 * O(n/64)
+		 *
+		 * @param t		The value to remove.
+		 * @returns		Whether or not a removal operation was performed.
+		 */
+		bool Remove(bool t);
+
+		/**
+		 * Removes the first element matching the passed predicate.
+		 * The predicate is only called twice, once for each value.
+		 * O(n/64)
+		 *
+		 * @param predicate		The predicate to query with.
+		 * @returns				Whether or not a removal was performed.
+		 */
+		template<std::predicate<bool> Predicate>
+		bool Remove(Predicate predicate);
+
+		/**
+		 * Removes the index specified and shifts values to the left over it.
+		 * O(n/64) where n is Size() - index
+		 *
+		 * @param index		The index to remove.
+		 *
+		 * @throws std::out_of_range	if index >= Size()
+		 */
+		void RemoveAt(size_t index);
+
+		/**
+		 * Whatever's left is Size() - Count(t) copies of !t, so this only needs to count and fill.
+		 * O(n/64)
+		 *
+		 * @param t		The value to remove all instances of.
+		 * @returns		How many removals were performed.
+		 */
+		size_t RemoveAll(bool t);
+
+		/**
+		 * Removes all elements matching the passed predicate.
+		 * The predicate is only called twice, once for each value.
+		 * O(n/64)
+		 *
+		 * @param predicate		The predicate to query with.
+		 * @returns				How many elements were removed.
+		 */
+		template<std::predicate<bool> Predicate>
+		size_t RemoveAll(Predicate predicate);
+
+		template<std::predicate<bool> Predicate>
+		friend size_t erase_if(BitArray& arr, const Predicate predicate)
+		{
+			return arr.RemoveAll(predicate);
+		}
+
+		/**
+		 * Removes the range [first, last) elements between the two passed indices.
+		 * If last is beyond Size() then all elements from first to the end will be removed safely.
+		 * Does nothing if the indices are both beyond Size().
+		 * O(n/64) where n = Size() - first
+		 *
+		 * @param first		index of the first value to remove, inclusive.
+		 * @param last		index of the last value to remove, exclusive.
+		 * @returns			The number of elements removed, equal to last - first unless last > Size().
+		 *
+		 * @throws std::invalid_argument	if first > last.
+		 */
+		size_t Remove(size_t first, size_t last);
+
+		/**
+		 * O(1)
+		 * Removes the last element of the container.
+		 * Does nothing if the container is empty.
+		 */
+		void PopBack() noexcept;
+
+		/**
+		 * O(n/64)
+		 * Removes the first element of the container.
+		 * Does nothing if the container is empty.
+		 */
+		void PopFront();
+
+		/**
+		 * Afterwards Size() == 0.
+		 * O(n/64)
+		 */
+		void Clear() noexcept;
+
+		/**
+		 * Erases all memory held by this container.
+		 */
+		void Empty() noexcept;
+#pragma endregion
+
+#pragma region Query
+		/**
+		 * Scans a word at a time, skipping any word with no match and finding the match within a word with countr_zero.
+		 * O(n/64)
+		 *
+		 * @param t			the value to query for
+		 * @param first		index to start searching from
+		 * @returns			the index of the first element equal to t at or after first, or Size() if there is none
+		 */
+		[[nodiscard]] size_type IndexOf(bool t, size_type first = 0) const noexcept;
+
+		/**
+		 * O(n/64)
+		 *
+		 * @param predicate		the predicate to query with, only called twice, once for each value
+		 * @returns				the index of the first element matching predicate, or Size() if there is none
+		 */
+		template<std::predicate<bool> Predicate>
+		[[nodiscard]] size_type IndexOf(Predicate predicate) const;
+
+		/**
+		 * O(n/64) using popcount
+		 *
+		 * @param t		the value to count
+		 * @returns		how many elements equal t
+		 */
+		[[nodiscard]] size_type Count(bool t = true) const noexcept;
+
+		/**
+		 * Calls func with the index of each element equal to t, in order.
+		 * Each word is visited once and each match within it is peeled off with countr_zero,
+		 * so a sparse mask costs O(n/64 + m) rather than O(n).
+		 * The container must not be modified during the iteration.
+		 * O(n/64 + m) where m is the number of matches
+		 *
+		 * @param t			the value to look for
+		 * @param func		called with each matching index
+		 */
+		template<std::invocable<size_type> Func>
+		void ForEachIndexOf(bool t, Func func) const;
+#pragma endregion
+
+#pragma region Memory
+		/**
+		 * Warning! Use at your own risk! Manipulating this memory can invalidate the state of the BitArray.
+		 * Element i is bit i % wordBits of word i / wordBits.
+		 *
+		 * @returns		pointer to the underlying words. nullptr if the container owns no memory.
+		 */
+		[[nodiscard]] constexpr Word* Data() noexcept;
+
+		/**
+		 * Element i is bit i % wordBits of word i / wordBits.
+		 *
+		 * @returns		pointer to the underlying words. nullptr if the container owns no memory.
+		 */
+		[[nodiscard]] constexpr const Word* Data() const noexcept;
+
+		/**
+		 * O(n/64) where n is the current size of the container.
+		 * Does nothing if newCapacity <= Capacity().
+		 *
+		 * @param newCapacity	The new capacity for the container, rounded up to a multiple of wordBits.
+		 */
+		void Reserve(size_t newCapacity);
+
+		/**
+		 * If the current Size() is greater than newSize, the container is reduced to its first newSize elements.
+		 * O(n/64) where n = |newSize - Size()|, or n = newSize if the operation requires a Reserve().
+		 *
+		 * @param newSize		The new size for the container.
+		 * @param prototype		The value to initialize each new element with.
+		 */
+		void Resize(size_t newSize, bool prototype = false);
+
+		/**
+		 * Reduces memory usage to the fewest words that hold Size() elements.
+		 * O(n/64) where n = Size().
+		 */
+		void ShrinkToFit();
+
+		/**
+		 * O(1)
+		 *
+		 * @param other		container to exchange contents with.
+		 */
+		void Swap(BitArray& other) noexcept;
+#pragma endregion
+
+#pragma region Operators
+		/**
+		 * Element-wise and, a word at a time.
+		 * O(n/64)
+		 *
+		 * @param other		must be the same Size()
+		 * @returns			this
+		 */
+		BitArray& operator&=(const BitArray& other) noexcept;
+
+		/**
+		 * Element-wise or, a word at a time.
+		 * O(n/64)
+		 *
+		 * @param other		must be the same Size()
+		 * @returns			this
+		 */
+		BitArray& operator|=(const BitArray& other) noexcept;
+
+		/**
+		 * Element-wise exclusive or, a word at a time.
+		 * O(n/64)
+		 *
+		 * @param other		must be the same Size()
+		 * @returns			this
+		 */
+		BitArray& operator^=(const BitArray& other) noexcept;
+
+		/**
+		 * Compares a word at a time, which works because the bits past Size() are always 0.
+		 * O(n/64)
+		 *
+		 * @param left		lhs container
+		 * @param right		rhs container
+		 * @returns			whether or not the two containers are equal.
+		 */
+		[[nodiscard]] friend bool operator==(const BitArray& left, const BitArray& right) noexcept
+		{
+			return left.size == right.size && std::equal(left.words, left.words + NumWords(left.size), right.words);
+		}
+
+		[[nodiscard]] friend bool operator!=(const BitArray& left, const BitArray& right) noexcept
+		{
+			return !operator==(left, right);
+		}
+
+		friend std::ostream& operator<<(std::ostream& stream, const BitArray& array) noexcept
+		{
+			Util::StreamTo(stream, array.begin(), array.end());
+			return stream;
+		}
+#pragma endregion
+
+#pragma region Helpers
+	private:
+		/**
+		 * @param numBits	how many bits
+		 * @returns			how many words it takes to hold them
+		 */
+		[[nodiscard]] static constexpr size_type NumWords(size_type numBits) noexcept;
+
+		/**
+		 * @param first		the first bit in the mask, inclusive, < wordBits
+		 * @param last		the last bit in the mask, exclusive, <= wordBits
+		 * @returns			a word with bits [first, last) set
+		 */
+		[[nodiscard]] static constexpr Word RangeMask(size_type first, size_type last) noexcept;
+
+		/**
+		 * @param bit	may be negative or past Capacity(), where the bits read as 0
+		 * @returns		the wordBits bits starting at bit
+		 */
+		[[nodiscard]] Word Load(difference_type bit) const noexcept;
+
+		/**
+		 * memmove for bits, a word at a time.
+		 * Only the destination bits are written.
+		 *
+		 * @param dest		first bit to write
+		 * @param source	first bit to read
+		 * @param count		how many bits to move
+		 */
+		void MoveBits(size_type dest, size_type source, size_type count) noexcept;
+
+		/**
+		 * memset for bits, a word at a time.
+		 *
+		 * @param first		first bit to set, inclusive
+		 * @param last		last bit to set, exclusive
+		 * @param t			the value to set them to
+		 */
+		void SetRange(size_type first, size_type last, bool t) noexcept;
+
+		/**
+		 * Calls the ReserveStrategy template argument and sanity checks its return value.
+		 * @returns		A safe new Capacity() for this container.
+		 */
+		[[nodiscard]] size_type InvokeReserveStrategy() const noexcept;
+
+		/**
+		 * @throws std::out_of_range	if index >= Size()
+		 */
+		void ThrowIfOutOfRange(size_type index) const;
+#pragma endregion
+	};
+
+	template<Concept::ReserveStrategy ReserveStrategy>
+	struct Util::IsTriviallyRelocatable<BitArray<ReserveStrategy>> : std::true_type {};
+}
+
+#include "BitArray.inl"
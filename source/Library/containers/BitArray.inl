@@ -0,0 +1,617 @@
+#pragma once
+#include "BitArray.h"
+
+namespace Library
+{
+#pragma region Special Members
+	TEMPLATE
+	inline BITARRAY::BitArray(const size_type capacity)
+	{
+		Reserve(capacity);
+	}
+
+	TEMPLATE
+	inline BITARRAY::BitArray(const size_type count, const bool prototype)
+	{
+		Resize(count, prototype);
+	}
+
+	TEMPLATE
+	template<std::forward_iterator It>
+	inline BITARRAY::BitArray(It first, const It last)
+	{
+		Reserve(std::distance(first, last));
+		while (first != last)
+		{
+			PushBack(bool(*first++));
+		}
+	}
+
+	TEMPLATE
+	inline BITARRAY::BitArray(const std::initializer_list<bool> list) :
+		BitArray(list.begin(), list.end()) {}
+
+	TEMPLATE
+	inline BITARRAY::BitArray(const BitArray& other) :
+		words(Memory::Malloc<Word>(NumWords(other.capacity))),
+		size(other.size),
+		capacity(other.capacity)
+	{
+		if (words)
+		{
+			Memory::Memcpy(words, other.words, NumWords(capacity));
+		}
+	}
+
+	TEMPLATE
+	inline BITARRAY::BitArray(BitArray&& other) noexcept :
+		words(other.words),
+		size(other.size),
+		capacity(other.capacity)
+	{
+		other.words = nullptr;
+		other.size = other.capacity = 0;
+	}
+
+	TEMPLATE
+	inline BITARRAY& BITARRAY::operator=(const BitArray& other)
+	{
+		if (this != &other)
+		{
+			Clear();
+			Reserve(other.size);
+			if (other.size)
+			{
+				Memory::Memcpy(words, other.words, NumWords(other.size));
+			}
+			size = other.size;
+		}
+		return *this;
+	}
+
+	TEMPLATE
+	inline BITARRAY& BITARRAY::operator=(BitArray&& other) noexcept
+	{
+		if (this != &other)
+		{
+			Empty();
+			Swap(other);
+		}
+		return *this;
+	}
+
+	TEMPLATE
+	inline BITARRAY::~BitArray()
+	{
+		Empty();
+	}
+#pragma endregion
+
+#pragma region iterator
+	TEMPLATE
+	inline typename BITARRAY::iterator BITARRAY::begin() noexcept
+	{
+		return iterator(0, *this);
+	}
+
+	TEMPLATE
+	inline typename BITARRAY::iterator BITARRAY::end() noexcept
+	{
+		return iterator(size, *this);
+	}
+#pragma endregion
+
+#pragma region Properties
+	TEMPLATE
+	inline constexpr bool BITARRAY::IsEmpty() const noexcept
+	{
+		return size == 0;
+	}
+
+	TEMPLATE
+	inline constexpr bool BITARRAY::IsFull() const noexcept
+	{
+		return size == capacity;
+	}
+
+	TEMPLATE
+	inline constexpr size_t BITARRAY::Size() const noexcept
+	{
+		return size;
+	}
+
+	TEMPLATE
+	inline constexpr size_t BITARRAY::Capacity() const noexcept
+	{
+		return capacity;
+	}
+
+	TEMPLATE
+	inline constexpr size_t BITARRAY::IndexOf(const const_iterator it) const noexcept
+	{
+		return it.it.index;
+	}
+#pragma endregion
+
+#pragma region Element Access
+	TEMPLATE
+	inline typename BITARRAY::reference BITARRAY::At(const size_t index)
+	{
+		ThrowIfOutOfRange(index);
+		return begin()[index];
+	}
+
+	TEMPLATE
+	inline bool BITARRAY::At(const size_t index) const
+	{
+		ThrowIfOutOfRange(index);
+		return begin()[index];
+	}
+
+	TEMPLATE
+	inline typename BITARRAY::reference BITARRAY::operator[](const size_t index)
+	{
+		return At(index);
+	}
+
+	TEMPLATE
+	inline bool BITARRAY::operator[](const size_t index) const
+	{
+		return At(index);
+	}
+
+	TEMPLATE
+	inline typename BITARRAY::reference BITARRAY::Front()
+	{
+		return At(0);
+	}
+
+	TEMPLATE
+	inline bool BITARRAY::Front() const
+	{
+		return At(0);
+	}
+
+	TEMPLATE
+	inline typename BITARRAY::reference BITARRAY::Back()
+	{
+		return At(size - 1);
+	}
+
+	TEMPLATE
+	inline bool BITARRAY::Back() const
+	{
+		return At(size - 1);
+	}
+#pragma endregion
+
+#pragma region Insert
+	TEMPLATE
+	inline void BITARRAY::Insert(const size_t index, const bool t)
+	{
+		if (index > size)
+		{
+			throw std::out_of_range(std::to_string(index) + " is beyond BitArray Size() of " + std::to_string(Size()));
+		}
+		if (IsFull())
+		{
+			Reserve(InvokeReserveStrategy());
+		}
+		MoveBits(index + 1, index, size - index);
+		++size;
+		begin()[index] = t;
+	}
+
+	TEMPLATE
+	inline void BITARRAY::PushBack(const bool t)
+	{
+		if (IsFull())
+		{
+			Reserve(InvokeReserveStrategy());
+		}
+		begin()[size++] = t;
+	}
+
+	TEMPLATE
+	inline void BITARRAY::PushFront(const bool t)
+	{
+		Insert(0, t);
+	}
+
+	TEMPLATE
+	inline void BITARRAY::Fill(const bool t) noexcept
+	{
+		SetRange(0, size, t);
+	}
+
+	TEMPLATE
+	inline void BITARRAY::Flip() noexcept
+	{
+		const size_type numWords = NumWords(size);
+		for (size_type i = 0; i < numWords; ++i)
+		{
+			words[i] = ~words[i];
+		}
+		// the bits past Size() must stay 0
+		SetRange(size, numWords * wordBits, false);
+	}
+#pragma endregion
+
+#pragma region Remove
+	TEMPLATE
+	inline bool BITARRAY::Remove(const bool t)
+	{
+		if (const size_type index = IndexOf(t); index != size)
+		{
+			RemoveAt(index);
+			return true;
+		}
+		return false;
+	}
+
+	TEMPLATE
+	template<std::predicate<bool> Predicate>
+	inline bool BITARRAY::Remove(Predicate predicate)
+	{
+		if (const size_type index = IndexOf(predicate); index != size)
+		{
+			RemoveAt(index);
+			return true;
+		}
+		return false;
+	}
+
+	TEMPLATE
+	inline void BITARRAY::RemoveAt(const size_t index)
+	{
+		ThrowIfOutOfRange(index);
+		Remove(index, index + 1);
+	}
+
+	TEMPLATE
+	inline size_t BITARRAY::RemoveAll(const bool t)
+	{
+		const size_type ret = Count(t);
+		const size_type newSize = size - ret;
+		SetRange(0, newSize, !t);
+		SetRange(newSize, size, false);
+		size = internal_size_type(newSize);
+		return ret;
+	}
+
+	TEMPLATE
+	template<std::predicate<bool> Predicate>
+	inline size_t BITARRAY::RemoveAll(Predicate predicate)
+	{
+		const bool removeTrue = predicate(true);
+		const bool removeFalse = predicate(false);
+		if (removeTrue && removeFalse)
+		{
+			const size_type ret = size;
+			Clear();
+			return ret;
+		}
+		return removeTrue ? RemoveAll(true) : removeFalse ? RemoveAll(false) : 0;
+	}
+
+	TEMPLATE
+	inline size_t BITARRAY::Remove(const size_t first, size_t last)
+	{
+		if (first > last)
+		{
+			throw std::invalid_argument("first " + std::to_string(first) + " is greater than last " + std::to_string(last));
+		}
+		if (first >= size)
+		{
+			return 0;
+		}
+		last = std::min(last, Size());
+		const size_type ret = last - first;
+		MoveBits(first, last, size - last);
+		SetRange(size - ret, size, false);
+		size -= internal_size_type(ret);
+		return ret;
+	}
+
+	TEMPLATE
+	inline void BITARRAY::PopBack() noexcept
+	{
+		if (!IsEmpty())
+		{
+			begin()[--size] = false;
+		}
+	}
+
+	TEMPLATE
+	inline void BITARRAY::PopFront()
+	{
+		if (!IsEmpty())
+		{
+			RemoveAt(0);
+		}
+	}
+
+	TEMPLATE
+	inline void BITARRAY::Clear() noexcept
+	{
+		SetRange(0, size, false);
+		size = 0;
+	}
+
+	TEMPLATE
+	inline void BITARRAY::Empty() noexcept
+	{
+		Memory::Free(words);
+		size = capacity = 0;
+	}
+#pragma endregion
+
+#pragma region Query
+	TEMPLATE
+	inline size_t BITARRAY::IndexOf(const bool t, const size_type first) const noexcept
+	{
+		const size_type numWords = NumWords(size);
+		// searching for 0s is searching for 1s in the complement
+		const Word invert = t ? Word(0) : ~Word(0);
+		for (size_type i = first / wordBits; i < numWords; ++i)
+		{
+			Word word = words[i] ^ invert;
+			if (i == first / wordBits)
+			{
+				word &= ~Word(0) << first % wordBits;
+			}
+			if (word)
+			{
+				// the complement's bits past Size() are 1s
+				return std::min(i * wordBits + std::countr_zero(word), Size());
+			}
+		}
+		return size;
+	}
+
+	TEMPLATE
+	template<std::predicate<bool> Predicate>
+	inline size_t BITARRAY::IndexOf(Predicate predicate) const
+	{
+		const bool matchTrue = predicate(true);
+		const bool matchFalse = predicate(false);
+		if (matchTrue && matchFalse)
+		{
+			return 0;
+		}
+		return matchTrue ? IndexOf(true) : matchFalse ? IndexOf(false) : Size();
+	}
+
+	TEMPLATE
+	inline size_t BITARRAY::Count(const bool t) const noexcept
+	{
+		size_type ret = 0;
+		const size_type numWords = NumWords(size);
+		for (size_type i = 0; i < numWords; ++i)
+		{
+			ret += std::popcount(words[i]);
+		}
+		return t ? ret : size - ret;
+	}
+
+	TEMPLATE
+	template<std::invocable<size_t> Func>
+	inline void BITARRAY::ForEachIndexOf(const bool t, Func func) const
+	{
+		const size_type numWords = NumWords(size);
+		const Word invert = t ? Word(0) : ~Word(0);
+		for (size_type i = 0; i < numWords; ++i)
+		{
+			Word word = words[i] ^ invert;
+			if (i == numWords - 1)
+			{
+				word &= RangeMask(0, size - i * wordBits);
+			}
+			for (; word; word &= word - 1)
+			{
+				func(i * wordBits + std::countr_zero(word));
+			}
+		}
+	}
+#pragma endregion
+
+#pragma region Memory
+	TEMPLATE
+	inline constexpr typename BITARRAY::Word* BITARRAY::Data() noexcept
+	{
+		return words;
+	}
+
+	TEMPLATE
+	inline constexpr const typename BITARRAY::Word* BITARRAY::Data() const noexcept
+	{
+		return words;
+	}
+
+	TEMPLATE
+	inline void BITARRAY::Reserve(const size_type newCapacity)
+	{
+		if (newCapacity > Capacity())
+		{
+			const size_type oldNumWords = NumWords(capacity);
+			const size_type newNumWords = NumWords(newCapacity);
+			Memory::Realloc(words, newNumWords);
+			Memory::Memset(words + oldNumWords, 0, newNumWords - oldNumWords);
+			capacity = internal_size_type(newNumWords * wordBits);
+		}
+	}
+
+	TEMPLATE
+	inline void BITARRAY::Resize(const size_type newSize, const bool prototype)
+	{
+		Reserve(newSize);
+		if (newSize > size)
+		{
+			SetRange(size, newSize, prototype);
+		}
+		else
+		{
+			SetRange(newSize, size, false);
+		}
+		size = internal_size_type(newSize);
+	}
+
+	TEMPLATE
+	inline void BITARRAY::ShrinkToFit()
+	{
+		if (const size_type numWords = NumWords(size); numWords != NumWords(capacity))
+		{
+			Memory::Realloc(words, numWords);
+			capacity = internal_size_type(numWords * wordBits);
+		}
+	}
+
+	TEMPLATE
+	inline void BITARRAY::Swap(BitArray& other) noexcept
+	{
+		std::swap(words, other.words);
+		std::swap(size, other.size);
+		std::swap(capacity, other.capacity);
+	}
+#pragma endregion
+
+#pragma region Operators
+	TEMPLATE
+	inline BITARRAY& BITARRAY::operator&=(const BitArray& other) noexcept
+	{
+		assertm(size == other.size, "BitArrays must be the same size");
+		for (size_type i = 0; i < NumWords(size); ++i)
+		{
+			words[i] &= other.words[i];
+		}
+		return *this;
+	}
+
+	TEMPLATE
+	inline BITARRAY& BITARRAY::operator|=(const BitArray& other) noexcept
+	{
+		assertm(size == other.size, "BitArrays must be the same size");
+		for (size_type i = 0; i < NumWords(size); ++i)
+		{
+			words[i] |= other.words[i];
+		}
+		return *this;
+	}
+
+	TEMPLATE
+	inline BITARRAY& BITARRAY::operator^=(const BitArray& other) noexcept
+	{
+		assertm(size == other.size, "BitArrays must be the same size");
+		for (size_type i = 0; i < NumWords(size); ++i)
+		{
+			words[i] ^= other.words[i];
+		}
+		return *this;
+	}
+#pragma endregion
+
+#pragma region Helpers
+	TEMPLATE
+	inline constexpr size_t BITARRAY::NumWords(const size_type numBits) noexcept
+	{
+		return (numBits + wordBits - 1) / wordBits;
+	}
+
+	TEMPLATE
+	inline constexpr typename BITARRAY::Word BITARRAY::RangeMask(const size_type first, const size_type last) noexcept
+	{
+		return (last == wordBits ? ~Word(0) : (Word(1) << last) - 1) & (~Word(0) << first);
+	}
+
+	TEMPLATE
+	inline typename BITARRAY::Word BITARRAY::Load(const difference_type bit) const noexcept
+	{
+		if (bit < 0)
+		{
+			return -bit < difference_type(wordBits) ? Load(0) << -bit : 0;
+		}
+		const size_type numWords = NumWords(capacity);
+		const size_type i = size_type(bit) / wordBits;
+		const size_type offset = size_type(bit) % wordBits;
+		Word ret = i < numWords ? words[i] >> offset : 0;
+		if (offset && i + 1 < numWords)
+		{
+			ret |= words[i + 1] << (wordBits - offset);
+		}
+		return ret;
+	}
+
+	TEMPLATE
+	inline void BITARRAY::MoveBits(const size_type dest, const size_type source, const size_type count) noexcept
+	{
+		if (count == 0 || dest == source)
+		{
+			return;
+		}
+
+		const size_type last = dest + count;
+		const difference_type offset = difference_type(source) - difference_type(dest);
+		const auto moveWord = [&](const size_type i)
+		{
+			const size_type wordBegin = i * wordBits;
+			const Word mask = RangeMask(std::max(wordBegin, dest) - wordBegin, std::min(wordBegin + wordBits, last) - wordBegin);
+			const Word value = Load(difference_type(wordBegin) + offset);
+			words[i] = (words[i] & ~mask) | (value & mask);
+		};
+
+		// Like memmove, go in whichever direction reads each word before it's overwritten.
+		const size_type firstWord = dest / wordBits;
+		const size_type lastWord = (last - 1) / wordBits;
+		if (dest < source)
+		{
+			for (size_type i = firstWord; i <= lastWord; ++i)
+			{
+				moveWord(i);
+			}
+		}
+		else
+		{
+			for (size_type i = lastWord + 1; i-- > firstWord;)
+			{
+				moveWord(i);
+			}
+		}
+	}
+
+	TEMPLATE
+	inline void BITARRAY::SetRange(const size_type first, const size_type last, const bool t) noexcept
+	{
+		if (first >= last)
+		{
+			return;
+		}
+
+		const size_type firstWord = first / wordBits;
+		const size_type lastWord = (last - 1) / wordBits;
+		for (size_type i = firstWord; i <= lastWord; ++i)
+		{
+			const size_type wordBegin = i * wordBits;
+			const Word mask = RangeMask(std::max(wordBegin, first) - wordBegin, std::min(wordBegin + wordBits, last) - wordBegin);
+			words[i] = t ? words[i] | mask : words[i] & ~mask;
+		}
+	}
+
+	TEMPLATE
+	inline size_t BITARRAY::InvokeReserveStrategy() const noexcept
+	{
+		return std::max(ReserveStrategy{}(size, capacity), size_type(size) + 1);
+	}
+
+	TEMPLATE
+	inline void BITARRAY::ThrowIfOutOfRange(const size_type index) const
+	{
+		if (index >= Size())
+		{
+			throw std::out_of_range(std::to_string(index) + " is beyond BitArray Size() of " + std::to_string(Size()));
+		}
+	}
+#pragma endregion
+}
+
+#undef TEMPLATE
+#undef BITARRAY
@@ -0,0 +1,576 @@
+// MIT License Copyright (c) 2020 Jarrett Wendt
+
+#pragma once
+
+#include "Macros.h"
+#include "Memory.h"
+#include "Util.h"
+#include "LibAllocator.h"
+
+#include <algorithm>			// std::min/max, std::equal
+#include <concepts>				// std::predicate
+#include <cstddef>				// std::byte
+#include <initializer_list>		// std::initializer_list
+#include <iterator>				// std::forward_iterator
+#include <limits>				// std::numeric_limits
+#include <memory>				// std::allocator_traits
+#include <ostream>
+
+#define TEMPLATE template<typename T, typename Allocator>
+#define CHUNKEDLIST ChunkedList<T, Allocator>
+
+namespace Library
+{
+	/**
+	 * An unrolled SList: each Node holds a small array of elements rather than just one.
+	 * Nodes are sized to a whole number of cache lines, so walking the list touches one cache line per handful of elements
+	 * rather than one per element, and there's one next pointer and one allocation per Node rather than per element.
+	 *
+	 * Each Node keeps its elements in [first, last) of its array so that both ends can grow and shrink in O(1).
+	 * Removing from the middle shifts the rest of that one Node, which is never more than chunkCapacity elements.
+	 * Neighbouring Nodes are merged whenever a removal leaves them able to fit in one, so they stay at least half full on average.
+	 *
+	 * Unlike SList, inserting or removing anywhere but the ends invalidates iterators and references into the affected Nodes.
+	 *
+	 * @param <T>				The type for this container to store.
+	 * @param <Allocator>		Where the Nodes come from, e.g. PoolAllocator<T>.
+	 */
+	template<typename T, typename Allocator = Allocator<T>>
+	class ChunkedList final
+	{
+	public:
+		using value_type = T;
+		using reference = T&;
+		using const_reference = const T&;
+		using pointer = T*;
+		using const_pointer = const T*;
+		using size_type = size_t;
+		using difference_type = ptrdiff_t;
+
+	private:
+		using chunk_size_type = uint16_t;
+
+		constexpr static size_t cacheLineSize = 64;
+		// Nodes span more than one cache line rather than hold fewer elements than this.
+		constexpr static size_t minChunkCapacity = 4;
+		// Where the elements start within a Node, after its next pointer and indices.
+		constexpr static size_t dataOffset = (sizeof(void*) + 2 * sizeof(chunk_size_type) + alignof(T) - 1) / alignof(T) * alignof(T);
+		constexpr static size_t nodeSize = (dataOffset + minChunkCapacity * sizeof(T) + cacheLineSize - 1) / cacheLineSize * cacheLineSize;
+
+		static_assert(alignof(T) <= cacheLineSize, "over-aligned types don't fit in cache line sized Nodes");
+
+	public:
+		/** How many elements fit in each Node. */
+		constexpr static size_type chunkCapacity = (nodeSize - dataOffset) / sizeof(T);
+
+	private:
+		struct Node final
+		{
+			Node* next{ nullptr };
+			// The elements are in [first, last) of data.
+			chunk_size_type first;
+			chunk_size_type last;
+			alignas(T) std::byte data[nodeSize - dataOffset];
+
+			/**
+			 * @param at		where the first element will go, 0 to grow towards the back or chunkCapacity to grow towards the front
+			 */
+			explicit Node(chunk_size_type at) noexcept;
+			~Node() = default;
+			MOVE_COPY(Node, delete)
+
+			[[nodiscard]] T* At(size_type index) noexcept;
+			[[nodiscard]] size_type Size() const noexcept;
+		};
+
+		static_assert(chunkCapacity <= std::numeric_limits<chunk_size_type>::max());
+
+		Node* head{ nullptr };
+		Node* tail{ nullptr };
+		size_type size{ 0 };
+
+	public:
+#pragma region Special Members
+		ChunkedList(std::initializer_list<T> list);
+		ChunkedList& operator=(std::initializer_list<T> list);
+
+		/**
+		 * constructs this container from a forward iterator
+		 *
+		 * @param <It>		iterator type
+		 * @param first		beginning iterator to read from (inclusive)
+		 * @param last		ending iterator to read from (exclusive)
+		 */
+		template<std::forward_iterator It>
+		ChunkedList(It first, It last);
+
+		/**
+		 * typecast ctor which accepts any range
+		 *
+		 * @param range			the range to construct from
+		 */
+		template<Concept::RangeOf<T> Range>
+		ChunkedList(const Range& range);
+
+		/**
+		 * typecast assignment which accepts any range
+		 *
+		 * @param range			the range to assign from
+		 */
+		template<Concept::RangeOf<T> Range>
+		ChunkedList& operator=(const Range& range);
+
+		ChunkedList() noexcept = default;
+		ChunkedList(const ChunkedList& other);
+		ChunkedList(ChunkedList&& other) noexcept;
+		ChunkedList& operator=(const ChunkedList& other);
+		ChunkedList& operator=(ChunkedList&& other) noexcept;
+		~ChunkedList();
+#pragma endregion
+
+#pragma region iterator
+		class const_iterator;
+
+		class iterator final
+		{
+			friend class ChunkedList;
+			friend class const_iterator;
+
+		private:
+#ifdef _DEBUG
+			const ChunkedList* owner{ nullptr };
+#endif
+			Node* node{ nullptr };
+			chunk_size_type index{ 0 };
+
+		public:
+			using iterator_category = std::forward_iterator_tag;
+			using value_type = T;
+			using difference_type = ptrdiff_t;
+			using pointer = T*;
+			using reference = T&;
+
+		private:
+			iterator(Node* node, chunk_size_type index, const ChunkedList* owner) noexcept;
+		public:
+			SPECIAL_MEMBERS(iterator, default)
+
+			iterator operator++(int) noexcept;
+			iterator& operator++() noexcept;
+			reference operator*() const;
+			pointer operator->() const;
+			bool operator==(iterator other) const noexcept;
+			bool operator!=(iterator other) const noexcept;
+			operator bool() const noexcept;
+			bool operator!() const noexcept;
+			bool IsAtEnd() const noexcept;
+		private:
+			void AssertInitialized() const noexcept;
+		};
+
+		class const_iterator final
+		{
+			friend class ChunkedList;
+			CONST_FORWARD_ITERATOR(const_iterator, iterator)
+			operator bool() const noexcept;
+			bool operator!() const noexcept;
+			bool IsAtEnd() const noexcept;
+		};
+
+		BEGIN_END(iterator, const_iterator, ChunkedList)
+#pragma endregion
+
+#pragma region Properties
+		/**
+		 * @returns		true if the container is empty, false otherwise
+		 */
+		[[nodiscard]] constexpr bool IsEmpty() const noexcept;
+
+		/**
+		 * @returns		How many elements are in the container.
+		 */
+		[[nodiscard]] constexpr size_type Size() const noexcept;
+#pragma endregion
+
+#pragma region Element Access
+		/**
+		 * @returns		reference to the first element.
+		 *
+		 * @throws std::out_of_range	if the container is empty
+		 */
+		[[nodiscard]] reference Front();
+
+		/**
+		 * @returns		reference to the first element.
+		 *
+		 * @throws std::out_of_range	if the container is empty
+		 */
+		[[nodiscard]] const_reference Front() const;
+
+		/**
+		 * @returns		reference to the last element.
+		 *
+		 * @throws std::out_of_range	if the container is empty
+		 */
+		[[nodiscard]] reference Back();
+
+		/**
+		 * @returns		reference to the last element.
+		 *
+		 * @throws std::out_of_range	if the container is empty
+		 */
+		[[nodiscard]] const_reference Back() const;
+
+		/**
+		 * Skips whole Nodes at a time to find the value at the specified index.
+		 * O(n / chunkCapacity)
+		 *
+		 * @param pos	the position to get
+		 * @returns		the value at that position
+		 *
+		 * @throws std::out_of_range	if pos >= Size()
+		 */
+		[[nodiscard]] reference At(size_type pos);
+
+		/**
+		 * Skips whole Nodes at a time to find the value at the specified index.
+		 * O(n / chunkCapacity)
+		 *
+		 * @param pos	the position to get
+		 * @returns		the value at that position
+		 *
+		 * @throws std::out_of_range	if pos >= Size()
+		 */
+		[[nodiscard]] const_reference At(size_type pos) const;
+#pragma endregion
+
+#pragma region Insert
+		/**
+		 * Inserts a value in the list after the position referenced by the passed iterator.
+		 * If end() is passed this performs the same operation as EmplaceBack().
+		 * If pos's Node is full it's split in two.
+		 * O(chunkCapacity)
+		 *
+		 * @param pos	where to emplace
+		 * @param args	the arguments to be forwarded to the constructor
+		 * @returns		iterator at the new element
+		 *
+		 * @asserts		the iterator belongs to this container
+		 */
+		template<typename... Args>
+		iterator EmplaceAfter(const_iterator pos, Args&&... args);
+
+		/**
+		 * O(chunkCapacity)
+		 * If end() is passed this performs the same operation as PushBack().
+		 *
+		 * @param pos			where to insert
+		 * @param t				value to insert
+		 * @returns				iterator at the newly inserted element
+		 *
+		 * @asserts				the iterator belongs to this container
+		 */
+		iterator InsertAfter(const_iterator pos, const T& t);
+
+		/**
+		 * O(chunkCapacity)
+		 * If end() is passed this performs the same operation as PushBack().
+		 *
+		 * @param pos			where to insert
+		 * @param t				value to insert
+		 * @returns				iterator at the newly inserted element
+		 *
+		 * @asserts				the iterator belongs to this container
+		 */
+		iterator InsertAfter(const_iterator pos, T&& t);
+
+		/**
+		 * Appends a new element to the end of the container.
+		 * O(1)
+		 *
+		 * @param args		Arguments to forward to the constructor of the element.
+		 */
+		template<typename... Args>
+		reference EmplaceBack(Args&&... args);
+
+		/**
+		 * Appends a new element to the front of the container.
+		 * O(1)
+		 *
+		 * @param args		Arguments to forward to the constructor of the element.
+		 */
+		template<typename... Args>
+		reference EmplaceFront(Args&&... args);
+
+		/**
+		 * Appends the element to the end of the container.
+		 * O(1)
+		 *
+		 * @param t		The value of the element to append.
+		 */
+		void PushBack(const T& t);
+
+		/**
+		 * Appends the element to the end of the container.
+		 * O(1)
+		 *
+		 * @param t		The value of the element to append.
+		 */
+		void PushBack(T&& t);
+
+		/**
+		 * Appends the element to the front of the container.
+		 * O(1)
+		 *
+		 * @param t		The value of the element to prepend.
+		 */
+		void PushFront(const T& t);
+
+		/**
+		 * Appends the element to the front of the container.
+		 * O(1)
+		 *
+		 * @param t		The value of the element to prepend.
+		 */
+		void PushFront(T&& t);
+
+		/**
+		 * Appends a prototypical value to the end of the container
+		 * O(n) where n = count
+		 *
+		 * @param count			how many values to append
+		 * @param prototype		what to append
+		 */
+		void Append(size_type count, const T& prototype = T());
+
+		/**
+		 * appends an initializer_list to the end of the container
+		 * O(n) where n = list.size()
+		 *
+		 * @param list		the list of values to append
+		 */
+		void Append(std::initializer_list<T> list);
+
+		/**
+		 * Appends the values in the range [first, last).
+		 * O(n) where n = std::distance(first, last)
+		 *
+		 * @param first		beginning iterator to read values from
+		 * @param last		ending iterator to read values from
+		 */
+		template<std::forward_iterator It>
+		void Append(It first, It last);
+#pragma endregion
+
+#pragma region Remove
+		/**
+		 * Removes the first element equal to t.
+		 * O(n)
+		 *
+		 * @param t		the value to remove
+		 * @returns		iterator at the element after the removed one, or end() if nothing was removed
+		 */
+		iterator Remove(const T& t);
+
+		/**
+		 * Removes the first element which satisfies predicate.
+		 * O(n)
+		 *
+		 * @param predicate		whether an element should be removed
+		 * @returns				iterator at the element after the removed one, or end() if nothing was removed
+		 */
+		template<std::predicate<T> Predicate>
+		iterator Remove(Predicate predicate);
+
+		/**
+		 * Removes the element at pos, shifting whichever side of its Node is shorter.
+		 * If that leaves the Node and the next one able to fit in one, they're merged.
+		 * O(chunkCapacity), or O(n / chunkCapacity) if it empties the last Node.
+		 *
+		 * @param pos		the element to remove, if end() nothing is removed
+		 * @returns			iterator at the element after the removed one
+		 *
+		 * @asserts			the iterator belongs to this container
+		 */
+		iterator RemoveAt(const_iterator pos);
+
+		/**
+		 * Removes every element equal to t in one pass, merging Nodes as they empty out.
+		 * O(n)
+		 *
+		 * @param t		the value to remove
+		 * @returns		how many elements were removed
+		 */
+		size_type RemoveAll(const T& t);
+
+		/**
+		 * Removes every element which satisfies predicate in one pass, merging Nodes as they empty out.
+		 * O(n)
+		 *
+		 * @param predicate		whether an element should be removed
+		 * @returns				how many elements were removed
+		 */
+		template<std::predicate<T> Predicate>
+		size_type RemoveAll(Predicate predicate);
+
+		friend size_t erase(ChunkedList& list, const T& t)
+		{
+			return list.RemoveAll(t);
+		}
+
+		template<std::predicate<T> Predicate>
+		friend size_t erase_if(ChunkedList& list, const Predicate predicate)
+		{
+			return list.RemoveAll(predicate);
+		}
+
+		/**
+		 * Removes the first element, if there is one.
+		 * O(1)
+		 */
+		void PopFront();
+
+		/**
+		 * Removes the last element, if there is one.
+		 * O(1), or O(n / chunkCapacity) if it empties the last Node.
+		 */
+		void PopBack();
+
+		/**
+		 * Erases all elements from the container, freeing every Node.
+		 */
+		void Clear();
+#pragma endregion
+
+#pragma region Memory
+		/**
+		 * Packs the elements into as few Nodes as possible, every one of them full but the last.
+		 * O(n)
+		 */
+		void ShrinkToFit();
+
+		/**
+		 * O(1)
+		 *
+		 * @param other		the container to swap contents with
+		 */
+		void Swap(ChunkedList& other) noexcept;
+#pragma endregion
+
+#pragma region Operators
+		/**
+		 * O(n)
+		 *
+		 * @param other		the container to compare this one against
+		 * @returns			whether both containers hold equal elements in the same order
+		 */
+		[[nodiscard]] bool operator==(const ChunkedList& other) const;
+
+		/**
+		 * O(n)
+		 *
+		 * @param other		the container to compare this one against
+		 * @returns			whether the containers differ in any element
+		 */
+		[[nodiscard]] bool operator!=(const ChunkedList& other) const;
+
+		friend std::ostream& operator<<(std::ostream& stream, const ChunkedList& list) noexcept
+		{
+			Util::StreamTo(stream, list.begin(), list.end());
+			return stream;
+		}
+#pragma endregion
+
+#pragma region Helpers
+	private:
+		/**
+		 * Moves elements from the front of node->next onto the back of node until node is full or node->next is empty,
+		 * deleting node->next if it ends up empty.
+		 * First moves node's own elements down to the start of its array to make room.
+		 * O(chunkCapacity)
+		 *
+		 * @param node		a Node with a next
+		 */
+		void Pull(Node* node) noexcept;
+
+		/**
+		 * Pulls node->next into node if they'd fit in one.
+		 *
+		 * @param node		any Node
+		 * @returns			whether they were merged
+		 */
+		bool MergeNext(Node* node) noexcept;
+
+		/**
+		 * Unlinks and deletes a Node which has no elements.
+		 * O(n / chunkCapacity) if it's the tail and not the head, otherwise O(1)
+		 *
+		 * @param node		an empty Node in this list
+		 * @param prev		the Node before it, or nullptr to look it up
+		 */
+		void Unlink(Node* node, Node* prev = nullptr) noexcept;
+
+		/**
+		 * Traverses the list to find the Node right before the passed one.
+		 * O(n / chunkCapacity)
+		 *
+		 * @returns		the Node just before the passed one, or nullptr if it's the head
+		 */
+		[[nodiscard]] Node* GetPrev(const Node* node) const noexcept;
+
+		/**
+		 * Allocates an empty Node with Allocator.
+		 *
+		 * @param at		where the Node's first element will go
+		 * @returns			the new Node
+		 */
+		static Node* NewNode(chunk_size_type at);
+
+		/**
+		 * Gives a Node's memory back to Allocator without destructing any of its elements.
+		 *
+		 * @param node		a Node returned by NewNode
+		 */
+		static void DeleteNode(Node* node) noexcept;
+
+		/**
+		 * Moves count elements from source to dest, leaving source uninitialized.
+		 * The ranges may overlap.
+		 * A memmove if T IsTriviallyRelocatable, otherwise each element is move constructed then destructed.
+		 *
+		 * @param dest			Where to move the elements to, uninitialized where it doesn't overlap source.
+		 * @param source		The elements to move.
+		 * @param count			How many elements to move.
+		 */
+		static void Relocate(T* dest, T* source, size_type count) noexcept;
+
+		/**
+		 * Helper for methods that accept iterators.
+		 *
+		 * @param it		The iterator who's owner to compare against this.
+		 *
+		 * @asserts			if owner == this
+		 */
+		void AssertOwner(const_iterator it) const;
+
+		/**
+		 * Helper for Front() and Back().
+		 *
+		 * @throws std::out_of_range	if IsEmpty()
+		 */
+		void ThrowEmpty() const;
+
+		/**
+		 * @param index		the index to compare against the size
+		 *
+		 * @throws std::out_of_range	if index >= Size()
+		 */
+		void ThrowIndex(size_type index) const;
+#pragma endregion
+	};
+
+	template<typename T, typename Allocator>
+	struct Util::IsTriviallyRelocatable<ChunkedList<T, Allocator>> : std::true_type {};
+}
+
+#include "ChunkedList.inl"
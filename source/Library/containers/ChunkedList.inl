@@ -0,0 +1,814 @@
+// MIT License Copyright (c) 2020 Jarrett Wendt
+
+#pragma once
+#include "ChunkedList.h"
+
+namespace Library
+{
+#pragma region Node
+	TEMPLATE
+	inline CHUNKEDLIST::Node::Node(const chunk_size_type at) noexcept :
+		first(at),
+		last(at) {}
+
+	TEMPLATE
+	inline T* CHUNKEDLIST::Node::At(const size_type index) noexcept
+	{
+		return reinterpret_cast<T*>(data) + index;
+	}
+
+	TEMPLATE
+	inline size_t CHUNKEDLIST::Node::Size() const noexcept
+	{
+		return last - first;
+	}
+#pragma endregion
+
+#pragma region Special Members
+	TEMPLATE
+	inline CHUNKEDLIST::ChunkedList(const std::initializer_list<T> list) :
+		ChunkedList(list.begin(), list.end()) {}
+
+	TEMPLATE
+	inline CHUNKEDLIST& CHUNKEDLIST::operator=(const std::initializer_list<T> list)
+	{
+		Clear();
+		Append(list.begin(), list.end());
+		return *this;
+	}
+
+	TEMPLATE
+	template<std::forward_iterator It>
+	inline CHUNKEDLIST::ChunkedList(It first, const It last)
+	{
+		Append(first, last);
+	}
+
+	TEMPLATE
+	template<Concept::RangeOf<T> Range>
+	inline CHUNKEDLIST::ChunkedList(const Range& range) :
+		ChunkedList(range.begin(), range.end()) {}
+
+	TEMPLATE
+	template<Concept::RangeOf<T> Range>
+	inline CHUNKEDLIST& CHUNKEDLIST::operator=(const Range& range)
+	{
+		Clear();
+		Append(range.begin(), range.end());
+		return *this;
+	}
+
+	TEMPLATE
+	inline CHUNKEDLIST::ChunkedList(const ChunkedList& other)
+	{
+		Append(other.begin(), other.end());
+	}
+
+	TEMPLATE
+	inline CHUNKEDLIST::ChunkedList(ChunkedList&& other) noexcept
+	{
+		Swap(other);
+	}
+
+	TEMPLATE
+	inline CHUNKEDLIST& CHUNKEDLIST::operator=(const ChunkedList& other)
+	{
+		if (this != &other)
+		{
+			Clear();
+			Append(other.begin(), other.end());
+		}
+		return *this;
+	}
+
+	TEMPLATE
+	inline CHUNKEDLIST& CHUNKEDLIST::operator=(ChunkedList&& other) noexcept
+	{
+		if (this != &other)
+		{
+			Clear();
+			Swap(other);
+		}
+		return *this;
+	}
+
+	TEMPLATE
+	inline CHUNKEDLIST::~ChunkedList()
+	{
+		Clear();
+	}
+#pragma endregion
+
+#pragma region iterator
+	TEMPLATE
+	inline CHUNKEDLIST::iterator::iterator(Node* node, const chunk_size_type index, [[maybe_unused]] const ChunkedList* owner) noexcept :
+#ifdef _DEBUG
+		owner(owner),
+#endif
+		node(node),
+		index(index) {}
+
+	TEMPLATE
+	inline typename CHUNKEDLIST::iterator CHUNKEDLIST::iterator::operator++(int) noexcept
+	{
+		const iterator ret = *this;
+		operator++();
+		return ret;
+	}
+
+	TEMPLATE
+	inline typename CHUNKEDLIST::iterator& CHUNKEDLIST::iterator::operator++() noexcept
+	{
+		if (node && ++index == node->last)
+		{
+			node = node->next;
+			index = node ? node->first : 0;
+		}
+		return *this;
+	}
+
+	TEMPLATE
+	inline typename CHUNKEDLIST::iterator::reference CHUNKEDLIST::iterator::operator*() const
+	{
+		if (!node)
+		{
+			throw std::out_of_range("iterator is at end()");
+		}
+		return *node->At(index);
+	}
+
+	TEMPLATE
+	inline typename CHUNKEDLIST::iterator::pointer CHUNKEDLIST::iterator::operator->() const
+	{
+		return &operator*();
+	}
+
+	TEMPLATE
+	inline bool CHUNKEDLIST::iterator::operator==(const iterator other) const noexcept
+	{
+		return node == other.node && index == other.index;
+	}
+
+	TEMPLATE
+	inline bool CHUNKEDLIST::iterator::operator!=(const iterator other) const noexcept
+	{
+		return !operator==(other);
+	}
+
+	TEMPLATE
+	inline CHUNKEDLIST::iterator::operator bool() const noexcept
+	{
+		return !IsAtEnd();
+	}
+
+	TEMPLATE
+	inline bool CHUNKEDLIST::iterator::operator!() const noexcept
+	{
+		return !operator bool();
+	}
+
+	TEMPLATE
+	inline bool CHUNKEDLIST::iterator::IsAtEnd() const noexcept
+	{
+		AssertInitialized();
+		return !node;
+	}
+
+	TEMPLATE
+	inline void CHUNKEDLIST::iterator::AssertInitialized() const noexcept
+	{
+		assertm(owner, "uninitialized ChunkedList iterator");
+	}
+
+	TEMPLATE
+	inline CHUNKEDLIST::const_iterator::operator bool() const noexcept
+	{
+		return it.operator bool();
+	}
+
+	TEMPLATE
+	inline bool CHUNKEDLIST::const_iterator::operator!() const noexcept
+	{
+		return it.operator!();
+	}
+
+	TEMPLATE
+	inline bool CHUNKEDLIST::const_iterator::IsAtEnd() const noexcept
+	{
+		return it.IsAtEnd();
+	}
+
+	TEMPLATE
+	inline typename CHUNKEDLIST::iterator CHUNKEDLIST::begin() noexcept
+	{
+		return iterator(head, head ? head->first : 0, this);
+	}
+
+	TEMPLATE
+	inline typename CHUNKEDLIST::iterator CHUNKEDLIST::end() noexcept
+	{
+		return iterator(nullptr, 0, this);
+	}
+#pragma endregion
+
+#pragma region Properties
+	TEMPLATE
+	inline constexpr bool CHUNKEDLIST::IsEmpty() const noexcept
+	{
+		return size == 0;
+	}
+
+	TEMPLATE
+	inline constexpr size_t CHUNKEDLIST::Size() const noexcept
+	{
+		return size;
+	}
+#pragma endregion
+
+#pragma region Element Access
+	TEMPLATE
+	inline typename CHUNKEDLIST::reference CHUNKEDLIST::Front()
+	{
+		ThrowEmpty();
+		return *head->At(head->first);
+	}
+
+	TEMPLATE
+	inline typename CHUNKEDLIST::const_reference CHUNKEDLIST::Front() const
+	{
+		return const_cast<ChunkedList*>(this)->Front();
+	}
+
+	TEMPLATE
+	inline typename CHUNKEDLIST::reference CHUNKEDLIST::Back()
+	{
+		ThrowEmpty();
+		return *tail->At(tail->last - 1);
+	}
+
+	TEMPLATE
+	inline typename CHUNKEDLIST::const_reference CHUNKEDLIST::Back() const
+	{
+		return const_cast<ChunkedList*>(this)->Back();
+	}
+
+	TEMPLATE
+	inline typename CHUNKEDLIST::reference CHUNKEDLIST::At(size_type pos)
+	{
+		ThrowIndex(pos);
+		Node* node = head;
+		for (; pos >= node->Size(); node = node->next)
+		{
+			pos -= node->Size();
+		}
+		return *node->At(node->first + pos);
+	}
+
+	TEMPLATE
+	inline typename CHUNKEDLIST::const_reference CHUNKEDLIST::At(const size_type pos) const
+	{
+		return const_cast<ChunkedList*>(this)->At(pos);
+	}
+#pragma endregion
+
+#pragma region Insert
+	TEMPLATE
+	template<typename... Args>
+	inline typename CHUNKEDLIST::iterator CHUNKEDLIST::EmplaceAfter(const_iterator pos, Args&&... args)
+	{
+		AssertOwner(pos);
+		if (!pos)
+		{
+			EmplaceBack(std::forward<Args>(args)...);
+			return iterator(tail, tail->last - 1, this);
+		}
+
+		// Constructed up front since args may refer to an element that's about to be shifted.
+		T t(std::forward<Args>(args)...);
+
+		Node* node = pos.it.node;
+		size_type index = pos.it.index + 1;
+		if (node->Size() == chunkCapacity)
+		{
+			// split the back half off into a new Node
+			Node* newNode = NewNode(0);
+			const size_type middle = node->first + chunkCapacity / 2;
+			Relocate(newNode->At(0), node->At(middle), node->last - middle);
+			newNode->last = chunk_size_type(node->last - middle);
+			node->last = chunk_size_type(middle);
+
+			newNode->next = node->next;
+			node->next = newNode;
+			if (tail == node)
+			{
+				tail = newNode;
+			}
+
+			if (index > middle)
+			{
+				index -= middle;
+				node = newNode;
+			}
+		}
+
+		if (node->last < chunkCapacity)
+		{
+			Relocate(node->At(index + 1), node->At(index), node->last - index);
+			++node->last;
+		}
+		else
+		{
+			// no room at the back, so make some at the front
+			Relocate(node->At(node->first - 1), node->At(node->first), index - node->first);
+			--node->first;
+			--index;
+		}
+
+		new (node->At(index)) T(std::move(t));
+		++size;
+		return iterator(node, chunk_size_type(index), this);
+	}
+
+	TEMPLATE
+	inline typename CHUNKEDLIST::iterator CHUNKEDLIST::InsertAfter(const const_iterator pos, const T& t)
+	{
+		return EmplaceAfter(pos, t);
+	}
+
+	TEMPLATE
+	inline typename CHUNKEDLIST::iterator CHUNKEDLIST::InsertAfter(const const_iterator pos, T&& t)
+	{
+		return EmplaceAfter(pos, std::move(t));
+	}
+
+	TEMPLATE
+	template<typename... Args>
+	inline typename CHUNKEDLIST::reference CHUNKEDLIST::EmplaceBack(Args&&... args)
+	{
+		if (tail && tail->last < chunkCapacity)
+		{
+			T* ret = new (tail->At(tail->last)) T(std::forward<Args>(args)...);
+			++tail->last;
+			++size;
+			return *ret;
+		}
+
+		Node* node = NewNode(0);
+		try
+		{
+			new (node->At(0)) T(std::forward<Args>(args)...);
+		}
+		catch (...)
+		{
+			DeleteNode(node);
+			throw;
+		}
+		node->last = 1;
+
+		if (tail)
+		{
+			tail->next = node;
+		}
+		else
+		{
+			head = node;
+		}
+		tail = node;
+		++size;
+		return *node->At(0);
+	}
+
+	TEMPLATE
+	template<typename... Args>
+	inline typename CHUNKEDLIST::reference CHUNKEDLIST::EmplaceFront(Args&&... args)
+	{
+		if (head && head->first > 0)
+		{
+			T* ret = new (head->At(head->first - 1)) T(std::forward<Args>(args)...);
+			--head->first;
+			++size;
+			return *ret;
+		}
+
+		// fill the new Node from the back so the next PushFront has room
+		Node* node = NewNode(chunk_size_type(chunkCapacity));
+		try
+		{
+			new (node->At(chunkCapacity - 1)) T(std::forward<Args>(args)...);
+		}
+		catch (...)
+		{
+			DeleteNode(node);
+			throw;
+		}
+		node->first = chunk_size_type(chunkCapacity - 1);
+
+		node->next = head;
+		head = node;
+		if (!tail)
+		{
+			tail = node;
+		}
+		++size;
+		return *node->At(node->first);
+	}
+
+	TEMPLATE
+	inline void CHUNKEDLIST::PushBack(const T& t)
+	{
+		EmplaceBack(t);
+	}
+
+	TEMPLATE
+	inline void CHUNKEDLIST::PushBack(T&& t)
+	{
+		EmplaceBack(std::move(t));
+	}
+
+	TEMPLATE
+	inline void CHUNKEDLIST::PushFront(const T& t)
+	{
+		EmplaceFront(t);
+	}
+
+	TEMPLATE
+	inline void CHUNKEDLIST::PushFront(T&& t)
+	{
+		EmplaceFront(std::move(t));
+	}
+
+	TEMPLATE
+	inline void CHUNKEDLIST::Append(size_type count, const T& prototype)
+	{
+		while (count-- > 0)
+		{
+			EmplaceBack(prototype);
+		}
+	}
+
+	TEMPLATE
+	inline void CHUNKEDLIST::Append(const std::initializer_list<T> list)
+	{
+		Append(list.begin(), list.end());
+	}
+
+	TEMPLATE
+	template<std::forward_iterator It>
+	inline void CHUNKEDLIST::Append(It first, const It last)
+	{
+		while (first != last)
+		{
+			EmplaceBack(*first++);
+		}
+	}
+#pragma endregion
+
+#pragma region Remove
+	TEMPLATE
+	inline typename CHUNKEDLIST::iterator CHUNKEDLIST::Remove(const T& t)
+	{
+		return Remove([&t](const T& element) { return element == t; });
+	}
+
+	TEMPLATE
+	template<std::predicate<T> Predicate>
+	inline typename CHUNKEDLIST::iterator CHUNKEDLIST::Remove(Predicate predicate)
+	{
+		for (auto it = begin(); it != end(); ++it)
+		{
+			if (predicate(*it))
+			{
+				return RemoveAt(it);
+			}
+		}
+		return end();
+	}
+
+	TEMPLATE
+	inline typename CHUNKEDLIST::iterator CHUNKEDLIST::RemoveAt(const const_iterator pos)
+	{
+		AssertOwner(pos);
+		if (!pos)
+		{
+			return end();
+		}
+
+		Node* node = pos.it.node;
+		size_type index = pos.it.index;
+		node->At(index)->~T();
+		if (index - node->first < node->last - index - 1)
+		{
+			Relocate(node->At(node->first + 1), node->At(node->first), index - node->first);
+			++node->first;
+			++index;
+		}
+		else
+		{
+			Relocate(node->At(index), node->At(index + 1), node->last - index - 1);
+			--node->last;
+		}
+		--size;
+
+		// how far the next element is into the Node, which stays the same if the Node is compacted by a merge
+		const size_type offset = index - node->first;
+		MergeNext(node);
+		if (node->Size() == 0)
+		{
+			// there was no next Node to merge, so this was the tail
+			Unlink(node);
+			return end();
+		}
+		if (offset == node->Size())
+		{
+			return iterator(node->next, node->next ? node->next->first : 0, this);
+		}
+		return iterator(node, chunk_size_type(node->first + offset), this);
+	}
+
+	TEMPLATE
+	inline size_t CHUNKEDLIST::RemoveAll(const T& t)
+	{
+		return RemoveAll([&t](const T& element) { return element == t; });
+	}
+
+	TEMPLATE
+	template<std::predicate<T> Predicate>
+	inline size_t CHUNKEDLIST::RemoveAll(Predicate predicate)
+	{
+		size_type removed = 0;
+		Node* prev = nullptr;
+		for (Node* node = head; node;)
+		{
+			// compact the survivors towards the front of their Node
+			size_type write = node->first;
+			size_type read = node->first;
+			try
+			{
+				for (; read < node->last; ++read)
+				{
+					if (predicate(*node->At(read)))
+					{
+						node->At(read)->~T();
+						++removed;
+					}
+					else
+					{
+						if (write != read)
+						{
+							Relocate(node->At(write), node->At(read), 1);
+						}
+						++write;
+					}
+				}
+			}
+			catch (...)
+			{
+				// close the gap so every element left is still constructed
+				Relocate(node->At(write), node->At(read), node->last - read);
+				node->last = chunk_size_type(write + node->last - read);
+				size -= removed;
+				throw;
+			}
+			node->last = chunk_size_type(write);
+
+			Node* next = node->next;
+			if (node->Size() == 0)
+			{
+				Unlink(node, prev);
+			}
+			else if (!prev || !MergeNext(prev))
+			{
+				prev = node;
+			}
+			node = next;
+		}
+		size -= removed;
+		return removed;
+	}
+
+	TEMPLATE
+	inline void CHUNKEDLIST::PopFront()
+	{
+		if (!IsEmpty())
+		{
+			head->At(head->first++)->~T();
+			--size;
+			if (head->Size() == 0)
+			{
+				Unlink(head, nullptr);
+			}
+		}
+	}
+
+	TEMPLATE
+	inline void CHUNKEDLIST::PopBack()
+	{
+		if (!IsEmpty())
+		{
+			tail->At(--tail->last)->~T();
+			--size;
+			if (tail->Size() == 0)
+			{
+				Unlink(tail);
+			}
+		}
+	}
+
+	TEMPLATE
+	inline void CHUNKEDLIST::Clear()
+	{
+		while (head)
+		{
+			Node* next = head->next;
+			for (size_type i = head->first; i < head->last; ++i)
+			{
+				head->At(i)->~T();
+			}
+			DeleteNode(head);
+			head = next;
+		}
+		tail = nullptr;
+		size = 0;
+	}
+#pragma endregion
+
+#pragma region Memory
+	TEMPLATE
+	inline void CHUNKEDLIST::ShrinkToFit()
+	{
+		for (Node* node = head; node; node = node->next)
+		{
+			while (node->next && (node->first > 0 || node->last < chunkCapacity))
+			{
+				Pull(node);
+			}
+		}
+	}
+
+	TEMPLATE
+	inline void CHUNKEDLIST::Swap(ChunkedList& other) noexcept
+	{
+		std::swap(head, other.head);
+		std::swap(tail, other.tail);
+		std::swap(size, other.size);
+	}
+#pragma endregion
+
+#pragma region Operators
+	TEMPLATE
+	inline bool CHUNKEDLIST::operator==(const ChunkedList& other) const
+	{
+		return this == &other || size == other.size && std::equal(begin(), end(), other.begin(), other.end());
+	}
+
+	TEMPLATE
+	inline bool CHUNKEDLIST::operator!=(const ChunkedList& other) const
+	{
+		return !operator==(other);
+	}
+#pragma endregion
+
+#pragma region Helpers
+	TEMPLATE
+	inline void CHUNKEDLIST::Pull(Node* node) noexcept
+	{
+		if (node->first > 0)
+		{
+			Relocate(node->At(0), node->At(node->first), node->Size());
+			node->last = chunk_size_type(node->Size());
+			node->first = 0;
+		}
+
+		Node* next = node->next;
+		const size_type count = std::min(chunkCapacity - node->last, next->Size());
+		Relocate(node->At(node->last), next->At(next->first), count);
+		node->last += chunk_size_type(count);
+		next->first += chunk_size_type(count);
+
+		if (next->Size() == 0)
+		{
+			Unlink(next, node);
+		}
+	}
+
+	TEMPLATE
+	inline bool CHUNKEDLIST::MergeNext(Node* node) noexcept
+	{
+		if (node->next && node->Size() + node->next->Size() <= chunkCapacity)
+		{
+			Pull(node);
+			return true;
+		}
+		return false;
+	}
+
+	TEMPLATE
+	inline void CHUNKEDLIST::Unlink(Node* node, Node* prev) noexcept
+	{
+		assertm(node->Size() == 0, "only empty Nodes can be unlinked");
+		if (!prev && node != head)
+		{
+			prev = GetPrev(node);
+		}
+
+		if (prev)
+		{
+			prev->next = node->next;
+		}
+		else
+		{
+			head = node->next;
+		}
+		if (tail == node)
+		{
+			tail = prev;
+		}
+		DeleteNode(node);
+	}
+
+	TEMPLATE
+	inline typename CHUNKEDLIST::Node* CHUNKEDLIST::GetPrev(const Node* node) const noexcept
+	{
+		Node* prev = nullptr;
+		for (Node* current = head; current != node; current = current->next)
+		{
+			prev = current;
+		}
+		return prev;
+	}
+
+	TEMPLATE
+	inline typename CHUNKEDLIST::Node* CHUNKEDLIST::NewNode(const chunk_size_type at)
+	{
+		using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+		NodeAllocator allocator{};
+		Node* node = std::allocator_traits<NodeAllocator>::allocate(allocator, 1);
+		return new (node) Node(at);
+	}
+
+	TEMPLATE
+	inline void CHUNKEDLIST::DeleteNode(Node* node) noexcept
+	{
+		using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+		NodeAllocator allocator{};
+		node->~Node();
+		std::allocator_traits<NodeAllocator>::deallocate(allocator, node, 1);
+	}
+
+	TEMPLATE
+	inline void CHUNKEDLIST::Relocate(T* dest, T* source, const size_type count) noexcept
+	{
+		if constexpr (Util::IsTriviallyRelocatable<T>::value)
+		{
+			if (count)
+			{
+				Memory::Memmove(dest, source, count);
+			}
+		}
+		else if (dest < source)
+		{
+			for (size_type i = 0; i < count; ++i)
+			{
+				new (dest + i) T(std::move(source[i]));
+				source[i].~T();
+			}
+		}
+		else if (dest > source)
+		{
+			// backwards so nothing's overwritten before it's moved
+			for (size_type i = count; i-- > 0;)
+			{
+				new (dest + i) T(std::move(source[i]));
+				source[i].~T();
+			}
+		}
+	}
+
+	TEMPLATE
+	inline void CHUNKEDLIST::AssertOwner([[maybe_unused]] const const_iterator it) const
+	{
+		assertm(it.it.owner == this, "iterator does not belong to this ChunkedList");
+	}
+
+	TEMPLATE
+	inline void CHUNKEDLIST::ThrowEmpty() const
+	{
+		if (IsEmpty())
+		{
+			throw std::out_of_range("Cannot dereference empty container");
+		}
+	}
+
+	TEMPLATE
+	inline void CHUNKEDLIST::ThrowIndex(const size_type index) const
+	{
+		if (index >= Size())
+		{
+			throw std::out_of_range(std::to_string(index) + " is beyond this container's size of " + std::to_string(Size()));
+		}
+	}
+#pragma endregion
+}
+
+#undef TEMPLATE
+#undef CHUNKEDLIST
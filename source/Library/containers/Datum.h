@@ -426,6 +426,9 @@ namespace Library
 		void Do(Type type, Invokable func);
 	};
 
+	template<>
+	struct Util::IsTriviallyRelocatable<Datum> : std::true_type {};
+
 	/**
 	 * @param val	a Datum::value_type
 	 * @returns		the enumerated type of the value_type
@@ -18,10 +18,10 @@
 // These get #undef-ed at the end of the .inl file.
 // Also pretty convenient in case I ever decide I want to change/rename the template args.
 // The only downside is that intellisense thinks my methods are unimplemented.
-#define TEMPLATE template<typename TKey, typename TValue, Concept::Hasher<TKey> Hash, std::predicate<TKey, TKey> KeyEqual, Concept::ReserveStrategy ReserveStrategy>
-#define HASHMAP HashMap<TKey, TValue, Hash, KeyEqual, ReserveStrategy>
+#define TEMPLATE template<typename TKey, typename TValue, Concept::Hasher<TKey> Hash, std::predicate<TKey, TKey> KeyEqual, Concept::ReserveStrategy ReserveStrategy, typename Allocator>
+#define HASHMAP HashMap<TKey, TValue, Hash, KeyEqual, ReserveStrategy, Allocator>
 #define OTHER_TEMPLATE template<Concept::Hasher<TKey> OtherHash, std::predicate<TKey, TKey> OtherKeyEqual, Concept::ReserveStrategy OtherReserveStrategy>
-#define OTHER_HASHMAP HashMap<TKey, TValue, OtherHash, OtherKeyEqual, OtherReserveStrategy>
+#define OTHER_HASHMAP HashMap<TKey, TValue, OtherHash, OtherKeyEqual, OtherReserveStrategy, Allocator>
 
 namespace Library
 {
@@ -92,7 +92,7 @@ namespace Library
 		}
 	};
 	
-	template<typename TKey, typename TValue, Concept::Hasher<TKey> Hash = Hash<TKey>, std::predicate<TKey, TKey> KeyEqual = std::equal_to<TKey>, Concept::ReserveStrategy ReserveStrategy = Util::PrimeReserveStrategy>
+	template<typename TKey, typename TValue, Concept::Hasher<TKey> Hash = Hash<TKey>, std::predicate<TKey, TKey> KeyEqual = std::equal_to<TKey>, Concept::ReserveStrategy ReserveStrategy = Util::PrimeReserveStrategy, typename Allocator = Allocator<std::pair<const TKey, TValue>>>
 	class HashMap final
 	{
 	public:
@@ -104,13 +104,15 @@ namespace Library
 		using hasher = Hash;
 		using key_equal = KeyEqual;
 		using reserve_strategy = ReserveStrategy;
+		using allocator_type = Allocator;
 		using reference = value_type&;
 		using const_reference = const value_type&;
 		using pointer = value_type*;
 		using const_pointer = const pointer;
 
 	private:
-		using ChainType = SList<value_type>;
+		// Allocator is rebound to the nodes of each chain.
+		using ChainType = SList<value_type, typename std::allocator_traits<Allocator>::template rebind_alloc<value_type>>;
 		using BucketType = Array<ChainType>;
 		using ChainIt = typename ChainType::iterator;
 		using BucketIt = typename BucketType::iterator;
@@ -757,6 +759,9 @@ namespace Library
 
 	namespace Util
 	{
+		template<typename TKey, typename TValue, Concept::Hasher<TKey> Hash, std::predicate<TKey, TKey> KeyEqual, Concept::ReserveStrategy ReserveStrategy, typename Allocator>
+		struct IsTriviallyRelocatable<HashMap<TKey, TValue, Hash, KeyEqual, ReserveStrategy, Allocator>> : std::true_type {};
+
 		template<typename TKey, typename TValue>
 		[[nodiscard]] bool Contains(const HashMap<TKey, TValue>& map, const TKey& key)
 		{
@@ -366,7 +366,7 @@ namespace Library
 	{
 		TryResize();
 		// Construct a node directly. This is how we guarantee no moves or copies.
-		auto node = new typename ChainType::Node(std::forward<Args>(args)...);
+		auto node = ChainType::NewNode(std::forward<Args>(args)...);
 		// Find will either return end or an iterator right at the matching key.
 		std::pair<iterator, bool> ret = { FindPrev(node->data.key), false };
 		// No overwrite.
@@ -389,7 +389,7 @@ namespace Library
 	inline std::pair<typename HASHMAP::iterator, bool> HASHMAP::TryEmplace(Args&& ...args)
 	{
 		TryResize();
-		auto node = new typename ChainType::Node(std::forward<Args>(args)...);
+		auto node = ChainType::NewNode(std::forward<Args>(args)...);
 		// Find will either return end or an iterator right at the matching key.
 		std::pair<iterator, bool> ret = { Find(node->data.key), false };
 		if (ret.first.IsAtEnd())
@@ -401,7 +401,7 @@ namespace Library
 		}
 		else
 		{
-			delete node;
+			ChainType::DeleteNode(node);
 		}
 		return ret;
 	}
@@ -0,0 +1,550 @@
+// MIT License Copyright (c) 2020 Jarrett Wendt
+
+#pragma once
+
+#include "Macros.h"
+#include "Memory.h"
+#include "Util.h"
+
+#include <algorithm>			// std::min/max, std::rotate
+#include <concepts>				// std::predicate
+#include <cstddef>				// std::byte
+#include <initializer_list>		// std::initializer_list
+#include <iterator>				// std::forward_iterator
+#include <ostream>
+
+#define TEMPLATE template<typename T, size_t N, Concept::ReserveStrategy ReserveStrategy>
+#define INLINEARRAY InlineArray<T, N, ReserveStrategy>
+
+namespace Library
+{
+	/**
+	 * An Array which holds its first N elements inside itself, only going to the heap once it outgrows them.
+	 * Most Arrays only ever hold a handful of elements, so this saves them a Malloc, a Free, and a cache miss.
+	 * Once spilled, it grows the same way an Array does.
+	 *
+	 * Moving one that's still inline has to move each element, so unlike Array a move is O(n) rather than O(1).
+	 *
+	 * @param <T>					The type for this container to store.
+	 * @param <N>					How many elements fit inline.
+	 * @param <ReserveStrategy>		A callable type for determining a new capacity given the current memory usage.
+	 */
+	template<typename T, size_t N, Concept::ReserveStrategy ReserveStrategy = Util::DefaultReserveStrategy>
+	class InlineArray final
+	{
+		static_assert(N > 0, "use Array for a container with no inline elements");
+
+	public:
+		using value_type = T;
+		using reference = T&;
+		using const_reference = const T&;
+		using pointer = T*;
+		using const_pointer = const T*;
+		using size_type = size_t;
+		using difference_type = ptrdiff_t;
+		using reserve_strategy = ReserveStrategy;
+		using iterator = T*;
+		using const_iterator = const T*;
+
+		constexpr static size_type inlineCapacity = N;
+
+	private:
+		using internal_size_type = uint32_t;
+
+		/** points at buffer until the elements spill to the heap */
+		T* array{ reinterpret_cast<T*>(buffer) };
+		internal_size_type size{ 0 };
+		internal_size_type capacity{ N };
+		alignas(T) std::byte buffer[N * sizeof(T)];
+
+	public:
+#pragma region Special Members
+		/**
+		 * default ctor
+		 * creates an empty container owning no memory
+		 */
+		InlineArray() noexcept {}
+
+		/**
+		 * explicit ctor
+		 *
+		 * @param capacity		how many elements worth of space to reserve
+		 */
+		explicit InlineArray(size_type capacity);
+
+		/**
+		 * explicit ctor
+		 *
+		 * @param count			how many elements of space to reserve and construct
+		 * @param prototype		prototypical value to be copy-constructed into each element
+		 */
+		InlineArray(size_type count, const T& prototype);
+
+		/**
+		 * explicit ctor
+		 * Fills the container with values read through the iterators.
+		 *
+		 * @param <It>			the iterator type
+		 * @param first			the beginning iterator, inclusive
+		 * @param last			the last iterator, exclusive
+		 */
+		template<std::forward_iterator It>
+		InlineArray(It first, It last);
+
+		/**
+		 * initializer_list ctor
+		 *
+		 * @param list		the initializer_list to construct this container from
+		 */
+		InlineArray(std::initializer_list<T> list);
+
+		/**
+		 * copy ctor
+		 *
+		 * @param other		the container to copy
+		 */
+		InlineArray(const InlineArray& other);
+
+		/**
+		 * move ctor
+		 * O(1) if other has spilled to the heap, otherwise O(n)
+		 *
+		 * @param other		the container to move, left empty afterwards
+		 */
+		InlineArray(InlineArray&& other) noexcept;
+
+		/**
+		 * copy assignment
+		 *
+		 * @param other		the container to copy
+		 * @returns			this container after assignment
+		 */
+		InlineArray& operator=(const InlineArray& other);
+
+		/**
+		 * move assignment
+		 * O(1) if other has spilled to the heap, otherwise O(n)
+		 *
+		 * @param other		the container to move, left empty afterwards
+		 * @returns			this container after assignment
+		 */
+		InlineArray& operator=(InlineArray&& other) noexcept;
+
+		/**
+		 * dtor
+		 * frees all associated memory
+		 */
+		~InlineArray();
+#pragma endregion
+
+#pragma region iterator
+		BEGIN_END(iterator, const_iterator, InlineArray)
+		MAKE_REVERSE_BEGIN_END
+#pragma endregion
+
+#pragma region Properties
+		/**
+		 * @returns		true if the container is empty, false otherwise
+		 */
+		[[nodiscard]] constexpr bool IsEmpty() const noexcept;
+
+		/**
+		 * @returns		true if the container is full, false otherwise
+		 */
+		[[nodiscard]] constexpr bool IsFull() const noexcept;
+
+		/**
+		 * @returns		true if the elements are still stored inside this container rather than on the heap
+		 */
+		[[nodiscard]] constexpr bool IsInline() const noexcept;
+
+		/**
+		 * @returns		How many elements are in the container.
+		 */
+		[[nodiscard]] constexpr size_type Size() const noexcept;
+
+		/**
+		 * @returns		The number of elements this container can hold without resizing, never less than N.
+		 */
+		[[nodiscard]] constexpr size_type Capacity() const noexcept;
+#pragma endregion
+
+#pragma region Element Access
+		/**
+		 * Returns a reference to the given index with bounds checking.
+		 *
+		 * @param index		position of the element to return
+		 * @returns			reference to the requested element
+		 *
+		 * @throws std::out_of_range	if index >= Size()
+		 */
+		[[nodiscard]] T& At(size_t index);
+
+		/**
+		 * Returns a reference to the given index with bounds checking.
+		 *
+		 * @param index		position of the element to return
+		 * @returns			reference to the requested element
+		 *
+		 * @throws std::out_of_range	if index >= Size()
+		 */
+		[[nodiscard]] const T& At(size_t index) const;
+
+		/**
+		 * Same as At(index).
+		 *
+		 * @throws std::out_of_range	if index >= Size()
+		 */
+		[[nodiscard]] T& operator[](size_t index);
+
+		/**
+		 * Same as At(index).
+		 *
+		 * @throws std::out_of_range	if index >= Size()
+		 */
+		[[nodiscard]] const T& operator[](size_t index) const;
+
+		/**
+		 * @throws std::out_of_range	if the container is empty
+		 */
+		[[nodiscard]] T& Front();
+
+		/**
+		 * @throws std::out_of_range	if the container is empty
+		 */
+		[[nodiscard]] const T& Front() const;
+
+		/**
+		 * @throws std::out_of_range	if the container is empty
+		 */
+		[[nodiscard]] T& Back();
+
+		/**
+		 * @throws std::out_of_range	if the container is empty
+		 */
+		[[nodiscard]] const T& Back() const;
+#pragma endregion
+
+#pragma region Insert
+		/**
+		 * Constructs a new element at index, shifting everything after it to the right.
+		 * O(n) where n = Size() - index
+		 *
+		 * @param index		where to construct, may be Size()
+		 * @param args		arguments to forward to T's ctor
+		 * @returns			the new element
+		 *
+		 * @throws std::out_of_range	if index > Size()
+		 */
+		template<typename... Args>
+		T& Emplace(size_t index, Args&&... args);
+
+		/**
+		 * amortized O(1)
+		 *
+		 * @param args		arguments to forward to T's ctor
+		 * @returns			the new element
+		 */
+		template<typename... Args>
+		T& EmplaceBack(Args&&... args);
+
+		/**
+		 * O(n)
+		 *
+		 * @param args		arguments to forward to T's ctor
+		 * @returns			the new element
+		 */
+		template<typename... Args>
+		T& EmplaceFront(Args&&... args);
+
+		/**
+		 * amortized O(1)
+		 *
+		 * @param t		the value to append
+		 */
+		void PushBack(const T& t);
+
+		/**
+		 * amortized O(1)
+		 *
+		 * @param t		the value to append
+		 */
+		void PushBack(T&& t);
+
+		/**
+		 * O(n)
+		 *
+		 * @param t		the value to prepend
+		 */
+		void PushFront(const T& t);
+
+		/**
+		 * O(n)
+		 *
+		 * @param t		the value to prepend
+		 */
+		void PushFront(T&& t);
+
+		/**
+		 * O(n) where n = Size() - index
+		 *
+		 * @param index		where to insert, may be Size()
+		 * @param t			the value to insert
+		 *
+		 * @throws std::out_of_range	if index > Size()
+		 */
+		void Insert(size_t index, const T& t);
+
+		/**
+		 * O(n) where n = Size() - index
+		 *
+		 * @param index		where to insert, may be Size()
+		 * @param t			the value to insert
+		 *
+		 * @throws std::out_of_range	if index > Size()
+		 */
+		void Insert(size_t index, T&& t);
+#pragma endregion
+
+#pragma region Remove
+		/**
+		 * Removes the first instance of the passed value from the container.
+		 * All elements after the removed one get shifted to the left.
+		 * O(n)
+		 *
+		 * @param t		The value to remove.
+		 * @returns		Whether or not a removal operation was performed.
+		 */
+		bool Remove(const T& t);
+
+		/**
+		 * Removes the first element matching the passed predicate.
+		 * All elements after the removed one get shifted to the left.
+		 * O(n)
+		 *
+		 * @param predicate		The predicate to query with.
+		 * @returns				Whether or not a removal was performed.
+		 */
+		template<std::predicate<T> Predicate>
+		bool Remove(Predicate predicate);
+
+		/**
+		 * Removes the index specified and shift values to the left over.
+		 * O(n) where n is Size() - index
+		 *
+		 * @param index		The index to remove.
+		 *
+		 * @throws std::out_of_range	if index >= Size()
+		 */
+		void RemoveAt(size_t index);
+
+		/**
+		 * Removes all elements matching the specified value.
+		 * O(n)
+		 *
+		 * @param t		The value to remove all instances of.
+		 * @returns		How many removals were performed.
+		 */
+		size_t RemoveAll(const T& t);
+
+		/**
+		 * Removes all elements matching the passed predicate.
+		 * O(n)
+		 *
+		 * @param predicate		The predicate to query with.
+		 * @returns				How many elements were removed.
+		 */
+		template<std::predicate<T> Predicate>
+		size_t RemoveAll(Predicate predicate);
+
+		template<std::predicate<T> Predicate>
+		friend size_t erase_if(InlineArray& arr, const Predicate predicate)
+		{
+			return arr.RemoveAll(predicate);
+		}
+
+		/**
+		 * Removes the range [first, last) elements between the two passed indices.
+		 * If last is beyond Size() then all elements from first to the end will be removed safely.
+		 * Does nothing if the indices are both beyond Size().
+		 * O(n) where n = Size() - first
+		 *
+		 * @param first		index of the first value to remove, inclusive.
+		 * @param last		index of the last value to remove, exclusive.
+		 * @returns			The number of elements removed, equal to last - first unless last > Size().
+		 *
+		 * @throws std::invalid_argument	if first > last.
+		 */
+		size_t Remove(size_t first, size_t last);
+
+		/**
+		 * O(1)
+		 * Removes the last element of the container.
+		 * Does nothing if the container is empty.
+		 */
+		void PopBack();
+
+		/**
+		 * O(n) where n = Size() - 1 before the operation.
+		 * Removes the first element of the container.
+		 * Does nothing if the container is empty.
+		 */
+		void PopFront();
+
+		/**
+		 * Erases all elements from the container by calling the destructors on each of them.
+		 * Afterwards Size() == 0.
+		 */
+		void Clear() noexcept;
+
+		/**
+		 * Erases all memory held by this container, moving it back inline.
+		 */
+		void Empty() noexcept;
+#pragma endregion
+
+#pragma region Query
+		/**
+		 * Does an O(n) search for the first occurrence of the passed element.
+		 *
+		 * @param t				the element to query for.
+		 * @returns				the index of the first element found, or Size() if it was not found.
+		 */
+		[[nodiscard]] size_type IndexOf(const T& t) const;
+
+		/**
+		 * Does an O(n) search for the first element matching the passed predicate.
+		 *
+		 * @param predicate		the predicate to query with.
+		 * @returns				the index of the first element found, or Size() if it was not found.
+		 */
+		template<std::predicate<T> Predicate>
+		[[nodiscard]] size_type IndexOf(Predicate predicate) const;
+#pragma endregion
+
+#pragma region Memory
+		/**
+		 * @returns		pointer to the underlying data, which is inside this container while IsInline().
+		 */
+		[[nodiscard]] constexpr T* Data() noexcept;
+
+		/**
+		 * @returns		pointer to the underlying data, which is inside this container while IsInline().
+		 */
+		[[nodiscard]] constexpr const T* Data() const noexcept;
+
+		/**
+		 * Spills to the heap if newCapacity > N.
+		 * O(n) where n is the current size of the container.
+		 * Does nothing if newCapacity <= Capacity().
+		 *
+		 * @param newCapacity	The new capacity for the container.
+		 */
+		void Reserve(size_t newCapacity);
+
+		/**
+		 * O(n) where n = newSize - Size(), or n = newSize if the operation requires a Reserve().
+		 * If the current Size() is greater than newSize, the container is reduced to its first newSize elements.
+		 *
+		 * @param newSize		The new size for the container.
+		 * @param prototype		The value to initialize each new element with.
+		 */
+		void Resize(size_t newSize, const T& prototype = T());
+
+		/**
+		 * Reduces memory usage such that Capacity() == std::max(Size(), N).
+		 * Moves the elements back inline if they fit.
+		 * O(n) where n = Size().
+		 */
+		void ShrinkToFit();
+#pragma endregion
+
+#pragma region Operators
+		/**
+		 * templated operator== to allow for comparing containers with different inline capacities and reserve strategies
+		 *
+		 * @param left		lhs container
+		 * @param right		rhs container
+		 * @returns			whether or not the two containers are equal.
+		 */
+		template<size_t OtherN, Concept::ReserveStrategy OtherReserveStrategy>
+		[[nodiscard]] friend bool operator==(const InlineArray& left, const InlineArray<T, OtherN, OtherReserveStrategy>& right)
+		{
+			return left.Size() == right.Size() && std::equal(left.begin(), left.end(), right.begin(), right.end());
+		}
+
+		/**
+		 * templated operator!= to allow for comparing containers with different inline capacities and reserve strategies
+		 *
+		 * @param left		lhs container
+		 * @param right		rhs container
+		 * @returns			whether or not the two containers are not equal.
+		 */
+		template<size_t OtherN, Concept::ReserveStrategy OtherReserveStrategy>
+		[[nodiscard]] friend bool operator!=(const InlineArray& left, const InlineArray<T, OtherN, OtherReserveStrategy>& right)
+		{
+			return !operator==(left, right);
+		}
+
+		friend std::ostream& operator<<(std::ostream& stream, const InlineArray& array) noexcept
+		{
+			Util::StreamTo(stream, array.begin(), array.end());
+			return stream;
+		}
+#pragma endregion
+
+#pragma region Helpers
+	private:
+		/**
+		 * @returns		the inline storage
+		 */
+		[[nodiscard]] T* Buffer() noexcept;
+
+		/**
+		 * Moves the elements to newArray and frees the old storage if it was on the heap.
+		 *
+		 * @param newArray		where to move the elements, either Buffer() or a fresh heap allocation
+		 * @param newCapacity	how many elements newArray can hold
+		 */
+		void MoveTo(T* newArray, size_type newCapacity) noexcept;
+
+		/**
+		 * Move constructs count elements from source into dest, then destructs the ones in source.
+		 *
+		 * @param dest			uninitialized memory for count elements
+		 * @param source		count constructed elements
+		 * @param count			how many elements to relocate
+		 */
+		static void Relocate(T* dest, T* source, size_type count) noexcept;
+
+		/**
+		 * Takes other's heap memory or relocates its inline elements, leaving other empty and inline.
+		 * Assumes this is empty and inline.
+		 *
+		 * @param other		the container to take from
+		 */
+		void Take(InlineArray& other) noexcept;
+
+		/**
+		 * Calls the ReserveStrategy template argument and sanity checks its return value.
+		 * @returns		A safe new Capacity() for this container.
+		 */
+		[[nodiscard]] size_type InvokeReserveStrategy() const noexcept;
+
+		/**
+		 * Calls the destructor on all elements in range [first, last).
+		 *
+		 * @param first		the first index to destruct (inclusive)
+		 * @param last		the last index to destruct (exclusive)
+		 */
+		void DestructAll(size_type first, size_type last) noexcept;
+
+		/**
+		 * @throws std::out_of_range	if index >= Size()
+		 */
+		void ThrowIfOutOfRange(size_type index) const;
+#pragma endregion
+	};
+}
+
+#include "InlineArray.inl"
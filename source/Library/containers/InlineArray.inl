@@ -0,0 +1,517 @@
+#pragma once
+#include "InlineArray.h"
+
+namespace Library
+{
+#pragma region Special Members
+	TEMPLATE
+	inline INLINEARRAY::InlineArray(const size_type capacity)
+	{
+		Reserve(capacity);
+	}
+
+	TEMPLATE
+	inline INLINEARRAY::InlineArray(const size_type count, const T& prototype)
+	{
+		Resize(count, prototype);
+	}
+
+	TEMPLATE
+	template<std::forward_iterator It>
+	inline INLINEARRAY::InlineArray(It first, const It last)
+	{
+		Reserve(std::distance(first, last));
+		while (first != last)
+		{
+			new (array + size++) T(*first++);
+		}
+	}
+
+	TEMPLATE
+	inline INLINEARRAY::InlineArray(const std::initializer_list<T> list) :
+		InlineArray(list.begin(), list.end()) {}
+
+	TEMPLATE
+	inline INLINEARRAY::InlineArray(const InlineArray& other) :
+		InlineArray(other.begin(), other.end()) {}
+
+	TEMPLATE
+	inline INLINEARRAY::InlineArray(InlineArray&& other) noexcept
+	{
+		Take(other);
+	}
+
+	TEMPLATE
+	inline INLINEARRAY& INLINEARRAY::operator=(const InlineArray& other)
+	{
+		if (this != &other)
+		{
+			Clear();
+			Reserve(other.size);
+			for (const T& t : other)
+			{
+				new (array + size++) T(t);
+			}
+		}
+		return *this;
+	}
+
+	TEMPLATE
+	inline INLINEARRAY& INLINEARRAY::operator=(InlineArray&& other) noexcept
+	{
+		if (this != &other)
+		{
+			Empty();
+			Take(other);
+		}
+		return *this;
+	}
+
+	TEMPLATE
+	inline INLINEARRAY::~InlineArray()
+	{
+		Empty();
+	}
+#pragma endregion
+
+#pragma region iterator
+	TEMPLATE
+	inline typename INLINEARRAY::iterator INLINEARRAY::begin() noexcept
+	{
+		return array;
+	}
+
+	TEMPLATE
+	inline typename INLINEARRAY::iterator INLINEARRAY::end() noexcept
+	{
+		return array + size;
+	}
+#pragma endregion
+
+#pragma region Properties
+	TEMPLATE
+	inline constexpr bool INLINEARRAY::IsEmpty() const noexcept
+	{
+		return size == 0;
+	}
+
+	TEMPLATE
+	inline constexpr bool INLINEARRAY::IsFull() const noexcept
+	{
+		return size == capacity;
+	}
+
+	TEMPLATE
+	inline constexpr bool INLINEARRAY::IsInline() const noexcept
+	{
+		return array == reinterpret_cast<const T*>(buffer);
+	}
+
+	TEMPLATE
+	inline constexpr size_t INLINEARRAY::Size() const noexcept
+	{
+		return size;
+	}
+
+	TEMPLATE
+	inline constexpr size_t INLINEARRAY::Capacity() const noexcept
+	{
+		return capacity;
+	}
+#pragma endregion
+
+#pragma region Element Access
+	TEMPLATE
+	inline T& INLINEARRAY::At(const size_t index)
+	{
+		ThrowIfOutOfRange(index);
+		return array[index];
+	}
+
+	TEMPLATE
+	inline const T& INLINEARRAY::At(const size_t index) const
+	{
+		return const_cast<InlineArray*>(this)->At(index);
+	}
+
+	TEMPLATE
+	inline T& INLINEARRAY::operator[](const size_t index)
+	{
+		return At(index);
+	}
+
+	TEMPLATE
+	inline const T& INLINEARRAY::operator[](const size_t index) const
+	{
+		return At(index);
+	}
+
+	TEMPLATE
+	inline T& INLINEARRAY::Front()
+	{
+		return At(0);
+	}
+
+	TEMPLATE
+	inline const T& INLINEARRAY::Front() const
+	{
+		return At(0);
+	}
+
+	TEMPLATE
+	inline T& INLINEARRAY::Back()
+	{
+		return At(size - 1);
+	}
+
+	TEMPLATE
+	inline const T& INLINEARRAY::Back() const
+	{
+		return At(size - 1);
+	}
+#pragma endregion
+
+#pragma region Insert
+	TEMPLATE
+	template<typename... Args>
+	inline T& INLINEARRAY::Emplace(const size_t index, Args&&... args)
+	{
+		if (index > size)
+		{
+			throw std::out_of_range(std::to_string(index) + " is beyond InlineArray Size() of " + std::to_string(Size()));
+		}
+		EmplaceBack(std::forward<Args>(args)...);
+		std::rotate(begin() + index, end() - 1, end());
+		return array[index];
+	}
+
+	TEMPLATE
+	template<typename... Args>
+	inline T& INLINEARRAY::EmplaceBack(Args&&... args)
+	{
+		if (IsFull())
+		{
+			// args may refer to an element, so construct before the elements move
+			const size_type newCapacity = InvokeReserveStrategy();
+			T* newArray = Memory::Malloc<T>(newCapacity);
+			new (newArray + size) T(std::forward<Args>(args)...);
+			MoveTo(newArray, newCapacity);
+		}
+		else
+		{
+			new (array + size) T(std::forward<Args>(args)...);
+		}
+		return array[size++];
+	}
+
+	TEMPLATE
+	template<typename... Args>
+	inline T& INLINEARRAY::EmplaceFront(Args&&... args)
+	{
+		return Emplace(0, std::forward<Args>(args)...);
+	}
+
+	TEMPLATE
+	inline void INLINEARRAY::PushBack(const T& t)
+	{
+		EmplaceBack(t);
+	}
+
+	TEMPLATE
+	inline void INLINEARRAY::PushBack(T&& t)
+	{
+		EmplaceBack(std::move(t));
+	}
+
+	TEMPLATE
+	inline void INLINEARRAY::PushFront(const T& t)
+	{
+		EmplaceFront(t);
+	}
+
+	TEMPLATE
+	inline void INLINEARRAY::PushFront(T&& t)
+	{
+		EmplaceFront(std::move(t));
+	}
+
+	TEMPLATE
+	inline void INLINEARRAY::Insert(const size_t index, const T& t)
+	{
+		Emplace(index, t);
+	}
+
+	TEMPLATE
+	inline void INLINEARRAY::Insert(const size_t index, T&& t)
+	{
+		Emplace(index, std::move(t));
+	}
+#pragma endregion
+
+#pragma region Remove
+	TEMPLATE
+	inline bool INLINEARRAY::Remove(const T& t)
+	{
+		if (const size_type index = IndexOf(t); index != size)
+		{
+			RemoveAt(index);
+			return true;
+		}
+		return false;
+	}
+
+	TEMPLATE
+	template<std::predicate<T> Predicate>
+	inline bool INLINEARRAY::Remove(Predicate predicate)
+	{
+		if (const size_type index = IndexOf(predicate); index != size)
+		{
+			RemoveAt(index);
+			return true;
+		}
+		return false;
+	}
+
+	TEMPLATE
+	inline void INLINEARRAY::RemoveAt(const size_t index)
+	{
+		ThrowIfOutOfRange(index);
+		Remove(index, index + 1);
+	}
+
+	TEMPLATE
+	inline size_t INLINEARRAY::RemoveAll(const T& t)
+	{
+		return RemoveAll([&t](const T& other) { return t == other; });
+	}
+
+	TEMPLATE
+	template<std::predicate<T> Predicate>
+	inline size_t INLINEARRAY::RemoveAll(Predicate predicate)
+	{
+		const size_type newSize = std::remove_if(begin(), end(), predicate) - begin();
+		const size_type ret = size - newSize;
+		DestructAll(newSize, size);
+		size = internal_size_type(newSize);
+		return ret;
+	}
+
+	TEMPLATE
+	inline size_t INLINEARRAY::Remove(const size_t first, size_t last)
+	{
+		if (first > last)
+		{
+			throw std::invalid_argument("first " + std::to_string(first) + " is greater than last " + std::to_string(last));
+		}
+		last = std::min(last, Size());
+		if (first >= last)
+		{
+			// moving an element onto itself could empty it
+			return 0;
+		}
+		std::move(begin() + last, end(), begin() + first);
+		const size_type ret = last - first;
+		DestructAll(size - ret, size);
+		size -= internal_size_type(ret);
+		return ret;
+	}
+
+	TEMPLATE
+	inline void INLINEARRAY::PopBack()
+	{
+		if (!IsEmpty())
+		{
+			DestructAll(size - 1, size);
+			--size;
+		}
+	}
+
+	TEMPLATE
+	inline void INLINEARRAY::PopFront()
+	{
+		if (!IsEmpty())
+		{
+			RemoveAt(0);
+		}
+	}
+
+	TEMPLATE
+	inline void INLINEARRAY::Clear() noexcept
+	{
+		DestructAll(0, size);
+		size = 0;
+	}
+
+	TEMPLATE
+	inline void INLINEARRAY::Empty() noexcept
+	{
+		Clear();
+		if (!IsInline())
+		{
+			Memory::Free(array);
+			array = Buffer();
+			capacity = N;
+		}
+	}
+#pragma endregion
+
+#pragma region Query
+	TEMPLATE
+	inline size_t INLINEARRAY::IndexOf(const T& t) const
+	{
+		return std::find(begin(), end(), t) - begin();
+	}
+
+	TEMPLATE
+	template<std::predicate<T> Predicate>
+	inline size_t INLINEARRAY::IndexOf(Predicate predicate) const
+	{
+		return std::find_if(begin(), end(), predicate) - begin();
+	}
+#pragma endregion
+
+#pragma region Memory
+	TEMPLATE
+	inline constexpr T* INLINEARRAY::Data() noexcept
+	{
+		return array;
+	}
+
+	TEMPLATE
+	inline constexpr const T* INLINEARRAY::Data() const noexcept
+	{
+		return array;
+	}
+
+	TEMPLATE
+	inline void INLINEARRAY::Reserve(const size_type newCapacity)
+	{
+		if (newCapacity > Capacity())
+		{
+			MoveTo(Memory::Malloc<T>(newCapacity), newCapacity);
+		}
+	}
+
+	TEMPLATE
+	inline void INLINEARRAY::Resize(const size_type newSize, const T& prototype)
+	{
+		if (newSize < size)
+		{
+			DestructAll(newSize, size);
+			size = internal_size_type(newSize);
+		}
+		else
+		{
+			Reserve(newSize);
+			while (size < newSize)
+			{
+				new (array + size++) T(prototype);
+			}
+		}
+	}
+
+	TEMPLATE
+	inline void INLINEARRAY::ShrinkToFit()
+	{
+		if (!IsInline() && capacity != size)
+		{
+			if (size <= N)
+			{
+				MoveTo(Buffer(), N);
+			}
+			else
+			{
+				MoveTo(Memory::Malloc<T>(size), size);
+			}
+		}
+	}
+#pragma endregion
+
+#pragma region Helpers
+	TEMPLATE
+	inline T* INLINEARRAY::Buffer() noexcept
+	{
+		return reinterpret_cast<T*>(buffer);
+	}
+
+	TEMPLATE
+	inline void INLINEARRAY::MoveTo(T* newArray, const size_type newCapacity) noexcept
+	{
+		Relocate(newArray, array, size);
+		if (!IsInline())
+		{
+			Memory::Free(array);
+		}
+		array = newArray;
+		capacity = internal_size_type(newCapacity);
+	}
+
+	TEMPLATE
+	inline void INLINEARRAY::Relocate(T* dest, T* source, const size_type count) noexcept
+	{
+		if constexpr (Util::IsTriviallyRelocatable<T>::value)
+		{
+			if (count)
+			{
+				Memory::Memcpy(dest, source, count);
+			}
+		}
+		else
+		{
+			for (size_type i = 0; i < count; ++i)
+			{
+				new (dest + i) T(std::move(source[i]));
+				source[i].~T();
+			}
+		}
+	}
+
+	TEMPLATE
+	inline void INLINEARRAY::Take(InlineArray& other) noexcept
+	{
+		if (other.IsInline())
+		{
+			Relocate(array, other.array, other.size);
+		}
+		else
+		{
+			array = other.array;
+			capacity = other.capacity;
+			other.array = other.Buffer();
+			other.capacity = N;
+		}
+		size = other.size;
+		other.size = 0;
+	}
+
+	TEMPLATE
+	inline size_t INLINEARRAY::InvokeReserveStrategy() const noexcept
+	{
+		return std::max(ReserveStrategy{}(size, capacity), size_type(size) + 1);
+	}
+
+	TEMPLATE
+	inline void INLINEARRAY::DestructAll(const size_type first, const size_type last) noexcept
+	{
+		if constexpr (!std::is_trivially_destructible_v<T>)
+		{
+			for (size_type i = first; i < last; ++i)
+			{
+				array[i].~T();
+			}
+		}
+	}
+
+	TEMPLATE
+	inline void INLINEARRAY::ThrowIfOutOfRange(const size_type index) const
+	{
+		if (index >= Size())
+		{
+			throw std::out_of_range(std::to_string(index) + " is beyond InlineArray Size() of " + std::to_string(Size()));
+		}
+	}
+#pragma endregion
+}
+
+#undef TEMPLATE
+#undef INLINEARRAY
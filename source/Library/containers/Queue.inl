@@ -63,9 +63,9 @@ namespace Library
 
 	TEMPLATE
 	template<typename... Args>
-	inline auto QUEUE::Emplace(Args&& ...args)
+	inline typename QUEUE::reference QUEUE::Emplace(Args&& ...args)
 	{
-		return c.Emplace(std::forward<Args>(args)...);
+		return c.EmplaceBack(std::forward<Args>(args)...);
 	}
 #pragma endregion
 
@@ -5,26 +5,22 @@
 #include "Macros.h"
 #include "Util.h"
 #include "Hash.h"
+#include "LibAllocator.h"
 
 #include <algorithm>			// std::min/max
 #include <initializer_list>		// std::initializer_list
 #include <iterator>				// std::_Is_random_iter
+#include <memory>				// std::allocator_traits
 
-// TODO: This container could be vastly optimized if Node were always guaranteed to be the size of cache lane.
-// That would mean SList is made up of linked sub-arrays.
-// This would all around decrease memory usage (since we have less next pointers) and reduce cache misses.
-// That would require adding an index data member to the iterator to know what position in the sub-array it is at.
-// That would also mean removals would be slower since objects have to be shifted.
-// We could use dirty bits to improve the speed of removals, but then the empy positions need to be culled every now and then.
-// It might be better to just avoid this problem by not allowing removals in the middle of the list.
-// That would imply a different class though.
+// Each Node holds a single element, so walking an SList is a cache miss per element.
+// ChunkedList is the same idea made up of linked cache line sized sub-arrays, for when traversal matters more than stable iterators.
 
 // SList, SList::Node, SList::iterator, and SList::const_iterator all need to be friends of HashMap for it to be able to emplace with no moves or copies.
-#define FRIEND_HASHMAP template<typename TKey, typename TValue, Concept::Hasher<TKey> Hash, std::predicate<TKey, TKey> KeyEqual, Concept::ReserveStrategy ReserveStrategy> friend class HashMap;
+#define FRIEND_HASHMAP template<typename TKey, typename TValue, Concept::Hasher<TKey> Hash, std::predicate<TKey, TKey> KeyEqual, Concept::ReserveStrategy ReserveStrategy, typename HashMapAllocator> friend class HashMap;
 
 namespace Library
 {	
-	template<typename T>
+	template<typename T, typename Allocator = Allocator<T>>
 	class SList final
 	{
 		FRIEND_HASHMAP
@@ -461,7 +457,7 @@ namespace Library
 		 *
 		 * @param list		the list of values to append
 		 */
-		void Append(const SList<T>& list);
+		void Append(const SList& list);
 
 		/**
 		 * Appends a range of data to the end of the list: [first, last)
@@ -776,7 +772,7 @@ namespace Library
 		 * @param less			the comparator to use for this operation.
 		 */
 		template<std::predicate<T, T> LessThan>
-		void Merge(SList<T>& other, LessThan less);
+		void Merge(SList& other, LessThan less);
 
 		/**
 		 * Merges another sorted list into this one.
@@ -788,7 +784,7 @@ namespace Library
 		 *
 		 * @param other			the list to merge into this one.
 		 */
-		void Merge(SList<T>& other);
+		void Merge(SList& other);
 
 		/**
 		 * Merges another sorted list into this one.
@@ -800,7 +796,7 @@ namespace Library
 		 * @param less			the comparator to use for this operation.
 		 */
 		template<std::predicate<T, T> LessThan>
-		void Merge(SList<T>&& other, LessThan less);
+		void Merge(SList&& other, LessThan less);
 
 		/**
 		 * Merges another sorted list into this one.
@@ -811,7 +807,7 @@ namespace Library
 		 *
 		 * @param other			the list to merge into this one.
 		 */
-		void Merge(SList<T>&& other);
+		void Merge(SList&& other);
 #pragma endregion
 		
 #pragma region Operators
@@ -822,7 +818,7 @@ namespace Library
 		 * @return true		if all elements are the same in both containers
 		 * @return false	otherwise
 		 */
-		[[nodiscard]] bool operator==(const SList<T>& other) const;
+		[[nodiscard]] bool operator==(const SList& other) const;
 
 		/**
 		 * O(n)
@@ -831,7 +827,7 @@ namespace Library
 		 * @return true		if at least 1 element is different in these two containers
 		 * @return false	otherwise
 		 */
-		[[nodiscard]] bool operator!=(const SList<T>& other) const;
+		[[nodiscard]] bool operator!=(const SList& other) const;
 
 		/**
 		 * "ToString" operator
@@ -924,6 +920,22 @@ namespace Library
 		 * ow many nodes were deleted
 		 */
 		static size_type DeleteUntil(Node* node, const Node* until);
+
+		/**
+		 * Allocates a Node with Allocator and constructs it in place.
+		 *
+		 * @param args		forwarded to Node's constructor
+		 * @returns			the new Node
+		 */
+		template<typename... Args>
+		static Node* NewNode(Args&&... args);
+
+		/**
+		 * Destructs a single Node and gives its memory back to Allocator.
+		 *
+		 * @param node		a Node returned by NewNode
+		 */
+		static void DeleteNode(Node* node) noexcept;
 		
 		/**
 		 * Helper for methods that accept iterators.
@@ -973,6 +985,9 @@ namespace Library
 		void SetPostMoveState() noexcept;
 #pragma endregion
 	};
+
+	template<typename T, typename Allocator>
+	struct Util::IsTriviallyRelocatable<SList<T, Allocator>> : std::true_type {};
 }
 
 #undef FRIEND_HASHMAP
@@ -6,77 +6,77 @@
 namespace Library
 {
 #pragma region Ctors
-	template<typename T>
+	template<typename T, typename Allocator>
 	template<typename ...Args>
-	inline SList<T>::Node::Node(Node* next, Args&& ...args) :
+	inline SList<T, Allocator>::Node::Node(Node* next, Args&& ...args) :
 		next(next),
 		data{ std::forward<Args>(args)... } {}
 	
-	template<typename T>
+	template<typename T, typename Allocator>
 	template<typename ...Args>
-	inline SList<T>::Node::Node(Args&& ...args) :
+	inline SList<T, Allocator>::Node::Node(Args&& ...args) :
 		data{ std::forward<Args>(args)... } {}
 
-	template<typename T>
-	inline SList<T>::SList(const std::initializer_list<T> list) :
+	template<typename T, typename Allocator>
+	inline SList<T, Allocator>::SList(const std::initializer_list<T> list) :
 		SList(list.begin(), list.end()) {}
 
-	template<typename T>
-	inline SList<T>& SList<T>::operator=(const std::initializer_list<T> list)
+	template<typename T, typename Allocator>
+	inline SList<T, Allocator>& SList<T, Allocator>::operator=(const std::initializer_list<T> list)
 	{
 		Clear();
 		Append(list.begin(), list.end());
 		return *this;
 	}
 
-	template<typename T>
+	template<typename T, typename Allocator>
 	template<std::forward_iterator It>
-	inline SList<T>::SList(It first, It last)
+	inline SList<T, Allocator>::SList(It first, It last)
 	{
 		Append(first, last);
 	}
 
-	template<typename T>
+	template<typename T, typename Allocator>
 	template<std::random_access_iterator It>
-	inline SList<T>::SList(It first, It last) :
+	inline SList<T, Allocator>::SList(It first, It last) :
 		SList(std::distance(first, last), first, last) {}
 
-	template<typename T>
+	template<typename T, typename Allocator>
 	template<Concept::RangeOf<T> Range>
-	inline SList<T>::SList(const Range& range) :
+	inline SList<T, Allocator>::SList(const Range& range) :
 		SList(Util::GetSize(range), range.begin(), range.end()) {}
 
-	template<typename T>
+	template<typename T, typename Allocator>
 	template<Concept::RangeOf<T> Range>
-	inline SList<T>& SList<T>::operator=(const Range& range)
+	inline SList<T, Allocator>& SList<T, Allocator>::operator=(const Range& range)
 	{
 		Clear();
 		Append(range.begin(), range.end());
 		return *this;
 	}
 
-	template<typename T>
+	template<typename T, typename Allocator>
 	template<std::forward_iterator It>
-	inline SList<T>::SList(const size_type size, It first, It last) :
+	inline SList<T, Allocator>::SList(const size_type size, It first, It last) :
 		size(size)
 	{
-		head = tail = new Node(*first++);
+		head = tail = NewNode(*first++);
 		while (first != last)
 		{
-			tail->next = new Node(*first++);
+			tail->next = NewNode(*first++);
 			tail = tail->next;
 		}
 	}
 
-	template<typename T>
-	inline SList<T>::SList(const SList& other) :
+	template<typename T, typename Allocator>
+	inline SList<T, Allocator>::SList(const SList& other) :
 		size(other.size)
 	{
 		Copy(other);
 	}
 
-	template<typename T>
-	inline SList<T>::SList(SList&& other) noexcept :
+	template<typename T, typename Allocator>
+	inline SList<T, Allocator>::SList(SList&& other) noexcept :
 		head(other.head),
 		tail(other.tail),
 		size(other.size)
@@ -84,8 +84,8 @@ namespace Library
 		other.SetPostMoveState();
 	}
 
-	template<typename T>
-	inline SList<T>& SList<T>::operator=(const SList& other)
+	template<typename T, typename Allocator>
+	inline SList<T, Allocator>& SList<T, Allocator>::operator=(const SList& other)
 	{
 		if (this != &other)
 		{
@@ -96,8 +96,8 @@ namespace Library
 		return *this;
 	}
 
-	template<typename T>
-	inline SList<T>& SList<T>::operator=(SList&& other) noexcept
+	template<typename T, typename Allocator>
+	inline SList<T, Allocator>& SList<T, Allocator>::operator=(SList&& other) noexcept
 	{
 		if (this != &other)
 		{
@@ -112,31 +112,31 @@ namespace Library
 		return *this;
 	}
 
-	template<typename T>
-	inline SList<T>::~SList()
+	template<typename T, typename Allocator>
+	inline SList<T, Allocator>::~SList()
 	{
 		Clear();
 	}
 #pragma endregion
 
 #pragma region iterator
-	template<typename T>
-	inline SList<T>::iterator::iterator(Node* node, [[maybe_unused]] const SList<T>* owner) noexcept :
+	template<typename T, typename Allocator>
+	inline SList<T, Allocator>::iterator::iterator(Node* node, [[maybe_unused]] const SList<T, Allocator>* owner) noexcept :
 #ifdef _DEBUG
 		owner(owner),
 #endif
 		node(node) {}
 
-	template<typename T>
-	inline typename SList<T>::iterator SList<T>::iterator::operator++(int) noexcept
+	template<typename T, typename Allocator>
+	inline typename SList<T, Allocator>::iterator SList<T, Allocator>::iterator::operator++(int) noexcept
 	{
 		const iterator ret = *this;
 		operator++();
 		return ret;
 	}
 
-	template<typename T>
-	inline typename SList<T>::iterator& SList<T>::iterator::operator++() noexcept
+	template<typename T, typename Allocator>
+	inline typename SList<T, Allocator>::iterator& SList<T, Allocator>::iterator::operator++() noexcept
 	{
 		if (node)
 		{
@@ -145,8 +145,8 @@ namespace Library
 		return *this;
 	}
 
-	template<typename T>
-	inline typename SList<T>::iterator::reference SList<T>::iterator::operator*() const
+	template<typename T, typename Allocator>
+	inline typename SList<T, Allocator>::iterator::reference SList<T, Allocator>::iterator::operator*() const
 	{
 		if (!node)
 		{
@@ -155,161 +155,161 @@ namespace Library
 		return node->data;
 	}
 
-	template<typename T>
-	inline typename SList<T>::iterator::pointer SList<T>::iterator::operator->() const
+	template<typename T, typename Allocator>
+	inline typename SList<T, Allocator>::iterator::pointer SList<T, Allocator>::iterator::operator->() const
 	{
 		return &operator*();
 	}
 
-	template<typename T>
-	inline bool SList<T>::iterator::operator==(const iterator other) const noexcept
+	template<typename T, typename Allocator>
+	inline bool SList<T, Allocator>::iterator::operator==(const iterator other) const noexcept
 	{
 		return node == other.node;
 	}
 
-	template<typename T>
-	inline bool SList<T>::iterator::operator!=(const iterator other) const noexcept
+	template<typename T, typename Allocator>
+	inline bool SList<T, Allocator>::iterator::operator!=(const iterator other) const noexcept
 	{
 		return !operator==(other);
 	}
 
-	template<typename T>
-	inline SList<T>::iterator::operator bool() const noexcept
+	template<typename T, typename Allocator>
+	inline SList<T, Allocator>::iterator::operator bool() const noexcept
 	{
 		return !IsAtEnd();
 	}
 
-	template<typename T>
-	inline bool SList<T>::iterator::operator!() const noexcept
+	template<typename T, typename Allocator>
+	inline bool SList<T, Allocator>::iterator::operator!() const noexcept
 	{
 		return !operator bool();
 	}
 
-	template<typename T>
-	inline bool SList<T>::iterator::IsAtEnd() const noexcept
+	template<typename T, typename Allocator>
+	inline bool SList<T, Allocator>::iterator::IsAtEnd() const noexcept
 	{
 		AssertInitialized();
 		return !node;
 	}
 
-	template<typename T>
-	inline void SList<T>::iterator::AssertInitialized() const noexcept
+	template<typename T, typename Allocator>
+	inline void SList<T, Allocator>::iterator::AssertInitialized() const noexcept
 	{
 		assertm(owner, "uninitialized SList iterator");
 	}
 
-	template<typename T>
-	inline SList<T>::const_iterator::operator bool() const noexcept
+	template<typename T, typename Allocator>
+	inline SList<T, Allocator>::const_iterator::operator bool() const noexcept
 	{
 		return it.operator bool();
 	}
 
-	template<typename T>
-	inline bool SList<T>::const_iterator::operator!() const noexcept
+	template<typename T, typename Allocator>
+	inline bool SList<T, Allocator>::const_iterator::operator!() const noexcept
 	{
 		return it.operator!();
 	}
 
-	template<typename T>
-	inline bool SList<T>::const_iterator::IsAtEnd() const noexcept
+	template<typename T, typename Allocator>
+	inline bool SList<T, Allocator>::const_iterator::IsAtEnd() const noexcept
 	{
 		return it.IsAtEnd();
 	}
 
-	template<typename T>
-	inline typename SList<T>::iterator SList<T>::begin() noexcept
+	template<typename T, typename Allocator>
+	inline typename SList<T, Allocator>::iterator SList<T, Allocator>::begin() noexcept
 	{
 		return iterator(head, this);
 	}
 
-	template<typename T>
-	inline typename SList<T>::iterator SList<T>::end() noexcept
+	template<typename T, typename Allocator>
+	inline typename SList<T, Allocator>::iterator SList<T, Allocator>::end() noexcept
 	{
 		return iterator(nullptr, this);
 	}
 
-	template<typename T>
-	inline typename SList<T>::iterator SList<T>::before_begin() noexcept
+	template<typename T, typename Allocator>
+	inline typename SList<T, Allocator>::iterator SList<T, Allocator>::before_begin() noexcept
 	{
 		// The head pointer is the first data member of an SList.
 		// Since SList has no vtable pointer, we can treat the SList itself as another node, just with no data.
 		return iterator(reinterpret_cast<Node*>(this), this);
 	}
 
-	template<typename T>
-	inline typename SList<T>::const_iterator SList<T>::before_begin() const noexcept
+	template<typename T, typename Allocator>
+	inline typename SList<T, Allocator>::const_iterator SList<T, Allocator>::before_begin() const noexcept
 	{
 		return const_cast<SList*>(this)->before_begin();
 	}
 
-	template<typename T>
-	inline typename SList<T>::const_iterator SList<T>::cbefore_begin() const noexcept
+	template<typename T, typename Allocator>
+	inline typename SList<T, Allocator>::const_iterator SList<T, Allocator>::cbefore_begin() const noexcept
 	{
 		return before_begin();
 	}
 
-	template<typename T>
-	inline typename SList<T>::iterator SList<T>::before_end() noexcept
+	template<typename T, typename Allocator>
+	inline typename SList<T, Allocator>::iterator SList<T, Allocator>::before_end() noexcept
 	{
 		return iterator(tail, this);
 	}
 
-	template<typename T>
-	inline typename SList<T>::const_iterator SList<T>::before_end() const noexcept
+	template<typename T, typename Allocator>
+	inline typename SList<T, Allocator>::const_iterator SList<T, Allocator>::before_end() const noexcept
 	{
 		return const_cast<SList*>(this)->before_end();
 	}
 
-	template<typename T>
-	inline typename SList<T>::const_iterator SList<T>::cbefore_end() const noexcept
+	template<typename T, typename Allocator>
+	inline typename SList<T, Allocator>::const_iterator SList<T, Allocator>::cbefore_end() const noexcept
 	{
 		return before_end();
 	}
 #pragma endregion
 
 #pragma region Properties
-	template<typename T>
-	inline constexpr typename SList<T>::size_type SList<T>::Size() const noexcept
+	template<typename T, typename Allocator>
+	inline constexpr typename SList<T, Allocator>::size_type SList<T, Allocator>::Size() const noexcept
 	{
 		return size;
 	}
 
-	template<typename T>
-	inline constexpr bool SList<T>::IsEmpty() const noexcept
+	template<typename T, typename Allocator>
+	inline constexpr bool SList<T, Allocator>::IsEmpty() const noexcept
 	{
 		return Size() <= 0;
 	}
 #pragma endregion
 
 #pragma region Element Access
-	template<typename T>
-	inline typename SList<T>::reference SList<T>::Front()
+	template<typename T, typename Allocator>
+	inline typename SList<T, Allocator>::reference SList<T, Allocator>::Front()
 	{
 		ThrowEmpty();
 		return head->data;
 	}
 
-	template<typename T>
-	inline typename SList<T>::const_reference SList<T>::Front() const
+	template<typename T, typename Allocator>
+	inline typename SList<T, Allocator>::const_reference SList<T, Allocator>::Front() const
 	{
 		return const_cast<SList*>(this)->Front();
 	}
 
-	template<typename T>
-	inline typename SList<T>::reference SList<T>::Back()
+	template<typename T, typename Allocator>
+	inline typename SList<T, Allocator>::reference SList<T, Allocator>::Back()
 	{
 		ThrowEmpty();
 		return tail->data;
 	}
 
-	template<typename T>
-	inline typename SList<T>::const_reference SList<T>::Back() const
+	template<typename T, typename Allocator>
+	inline typename SList<T, Allocator>::const_reference SList<T, Allocator>::Back() const
 	{
 		return const_cast<SList*>(this)->Back();
 	}
 
-	template<typename T>
-	inline typename SList<T>::reference SList<T>::At(size_type pos)
+	template<typename T, typename Allocator>
+	inline typename SList<T, Allocator>::reference SList<T, Allocator>::At(size_type pos)
 	{
 		ThrowIndex(pos);
 		Node* node = head;
@@ -324,28 +324,28 @@ namespace Library
 #pragma warning(pop)
 	}
 
-	template<typename T>
-	inline typename SList<T>::const_reference SList<T>::At(const size_type pos) const
+	template<typename T, typename Allocator>
+	inline typename SList<T, Allocator>::const_reference SList<T, Allocator>::At(const size_type pos) const
 	{
 		return const_cast<SList*>(this)->At(pos);
 	}
 #pragma endregion
 
 #pragma region Insert
-	template<typename T>
-	inline typename SList<T>::iterator SList<T>::InsertAfter(const const_iterator pos, const T& t)
+	template<typename T, typename Allocator>
+	inline typename SList<T, Allocator>::iterator SList<T, Allocator>::InsertAfter(const const_iterator pos, const T& t)
 	{
 		return EmplaceAfter(pos, t);
 	}
 
-	template<typename T>
-	inline typename SList<T>::iterator SList<T>::InsertAfter(const const_iterator pos, T&& t)
+	template<typename T, typename Allocator>
+	inline typename SList<T, Allocator>::iterator SList<T, Allocator>::InsertAfter(const const_iterator pos, T&& t)
 	{
 		return EmplaceAfter(pos, std::move(t));
 	}
 
-	template<typename T>
-	inline typename SList<T>::iterator SList<T>::InsertAfter(const_iterator pos, const size_type count, const T& prototype)
+	template<typename T, typename Allocator>
+	inline typename SList<T, Allocator>::iterator SList<T, Allocator>::InsertAfter(const_iterator pos, const size_type count, const T& prototype)
 	{
 		AssertOwner(pos);
 		if (!pos)
@@ -355,20 +355,20 @@ namespace Library
 		}
 		for (size_t i = 0; i < count; i++)
 		{
-			pos.it.node = pos.it.node->next = new Node(pos.it.node->next, prototype);
+			pos.it.node = pos.it.node->next = NewNode(pos.it.node->next, prototype);
 		}
 		return pos.it;
 	}
 
-	template<typename T>
-	inline typename SList<T>::iterator SList<T>::InsertAfter(const const_iterator pos, const std::initializer_list<T> list)
+	template<typename T, typename Allocator>
+	inline typename SList<T, Allocator>::iterator SList<T, Allocator>::InsertAfter(const const_iterator pos, const std::initializer_list<T> list)
 	{
 		return InsertAfter(pos, list.begin(), list.end());
 	}
 	
-	template<typename T>
+	template<typename T, typename Allocator>
 	template<std::forward_iterator It>
-	inline typename SList<T>::iterator SList<T>::InsertAfter(const const_iterator pos, const It first, const It last)
+	inline typename SList<T, Allocator>::iterator SList<T, Allocator>::InsertAfter(const const_iterator pos, const It first, const It last)
 	{
 		AssertOwner(pos);
 
@@ -391,7 +391,7 @@ namespace Library
 			{
 				size++;
 			}
-			p.node = p.node->next = new Node(p.node->next, *it);
+			p.node = p.node->next = NewNode(p.node->next, *it);
 		}
 		if (oldSize == 1)
 		{
@@ -400,9 +400,9 @@ namespace Library
 		return p;
 	}
 	
-	template<typename T>
+	template<typename T, typename Allocator>
 	template<typename ...Args>
-	inline typename SList<T>::iterator SList<T>::EmplaceAfter(const_iterator pos, Args&& ...args)
+	inline typename SList<T, Allocator>::iterator SList<T, Allocator>::EmplaceAfter(const_iterator pos, Args&& ...args)
 	{
 		AssertOwner(pos);
 		if (!pos || pos.it.node == tail)
@@ -410,16 +410,16 @@ namespace Library
 			EmplaceBack(std::forward<Args>(args)...);
 			return iterator(tail, this);
 		}
-		pos.it.node->next = new Node(pos.it.node->next, std::forward<Args>(args)...);
+		pos.it.node->next = NewNode(pos.it.node->next, std::forward<Args>(args)...);
 		pos.it.node = pos.it.node->next;
 		return pos.it;
 	}
 
-	template<typename T>
+	template<typename T, typename Allocator>
 	template<typename ...Args>
-	inline typename SList<T>::reference SList<T>::EmplaceBack(Args&& ...args)
+	inline typename SList<T, Allocator>::reference SList<T, Allocator>::EmplaceBack(Args&& ...args)
 	{
-		Node* node = new Node(std::forward<Args>(args)...);
+		Node* node = NewNode(std::forward<Args>(args)...);
 		if (IsEmpty())
 		{
 			head = node;
@@ -433,68 +433,68 @@ namespace Library
 		return tail->data;
 	}
 
-	template<typename T>
+	template<typename T, typename Allocator>
 	template<typename ...Args>
-	inline typename SList<T>::reference SList<T>::EmplaceFront(Args&& ...args)
+	inline typename SList<T, Allocator>::reference SList<T, Allocator>::EmplaceFront(Args&& ...args)
 	{
-		PushFront(new Node(head, std::forward<Args>(args)...));
+		PushFront(NewNode(head, std::forward<Args>(args)...));
 		return head->data;
 	}
 
-	template<typename T>
-	inline void SList<T>::PushBack(const T& t)
+	template<typename T, typename Allocator>
+	inline void SList<T, Allocator>::PushBack(const T& t)
 	{
 		EmplaceBack(t);
 	}
 	
-	template<typename T>
-	inline void SList<T>::PushBack(T&& t)
+	template<typename T, typename Allocator>
+	inline void SList<T, Allocator>::PushBack(T&& t)
 	{
 		EmplaceBack(std::move(t));
 	}
 	
-	template<typename T>
-	inline void SList<T>::PushFront(const T& t)
+	template<typename T, typename Allocator>
+	inline void SList<T, Allocator>::PushFront(const T& t)
 	{
 		EmplaceFront(t);
 	}
 	
-	template<typename T>
-	inline void SList<T>::PushFront(T&& t)
+	template<typename T, typename Allocator>
+	inline void SList<T, Allocator>::PushFront(T&& t)
 	{
 		EmplaceFront(std::move(t));
 	}
 	
-	template<typename T>
-	inline void SList<T>::Append(size_type count, const T& prototype)
+	template<typename T, typename Allocator>
+	inline void SList<T, Allocator>::Append(size_type count, const T& prototype)
 	{
 		size += count;
 		while (count--)
 		{
-			tail->next = new Node(prototype);
+			tail->next = NewNode(prototype);
 			tail = tail->next;
 		}
 	}
 
-	template<typename T>
-	inline void SList<T>::Append(const std::initializer_list<T> list)
+	template<typename T, typename Allocator>
+	inline void SList<T, Allocator>::Append(const std::initializer_list<T> list)
 	{
 		Append(list.begin(), list.end());
 	}
 
-	template<typename T>
-	inline void SList<T>::Append(const SList<T>& list)
+	template<typename T, typename Allocator>
+	inline void SList<T, Allocator>::Append(const SList<T, Allocator>& list)
 	{
 		Append(list.begin(), list.end());
 	}
 
-	template<typename T>
+	template<typename T, typename Allocator>
 	template<std::forward_iterator It>
-	inline void SList<T>::Append(It first, const It last)
+	inline void SList<T, Allocator>::Append(It first, const It last)
 	{
 		if (IsEmpty())
 		{
-			head = tail = new Node(*first++);
+			head = tail = NewNode(*first++);
 			size++;
 		}
 		if constexpr (std::random_access_iterator<It>)
@@ -507,28 +507,28 @@ namespace Library
 			{
 				size++;
 			}
-			tail->next = new Node(*first++);
+			tail->next = NewNode(*first++);
 			tail = tail->next;
 		}
 	}
 #pragma endregion
 
 #pragma region Remove
-	template<typename T>
-	inline typename SList<T>::iterator SList<T>::Remove(const T& t)
+	template<typename T, typename Allocator>
+	inline typename SList<T, Allocator>::iterator SList<T, Allocator>::Remove(const T& t)
 	{
 		return Remove([&t](const auto& a) { return a == t; });
 	}
 
-	template<typename T>
-	inline typename SList<T>::iterator SList<T>::Remove(T&& t)
+	template<typename T, typename Allocator>
+	inline typename SList<T, Allocator>::iterator SList<T, Allocator>::Remove(T&& t)
 	{
 		return Remove([t = std::move(t)](const auto& a) { return a == t; });
 	}
 
-	template<typename T>
+	template<typename T, typename Allocator>
 	template<std::predicate<T> Predicate>
-	inline typename SList<T>::iterator SList<T>::Remove(const Predicate predicate)
+	inline typename SList<T, Allocator>::iterator SList<T, Allocator>::Remove(const Predicate predicate)
 	{
 		if (IsEmpty())
 		{
@@ -542,8 +542,8 @@ namespace Library
 		return RemoveAfter(FindPrev(predicate));
 	}
 
-	template<typename T>
-	inline typename SList<T>::iterator SList<T>::RemoveAt(const_iterator pos)
+	template<typename T, typename Allocator>
+	inline typename SList<T, Allocator>::iterator SList<T, Allocator>::RemoveAt(const_iterator pos)
 	{
 		if (!pos)
 		{
@@ -555,8 +555,8 @@ namespace Library
 		return Remove(prev, pos);
 	}
 
-	template<typename T>
-	inline typename SList<T>::iterator SList<T>::Remove(size_type first, size_type last)
+	template<typename T, typename Allocator>
+	inline typename SList<T, Allocator>::iterator SList<T, Allocator>::Remove(size_type first, size_type last)
 	{
 		if (first > last)
 		{
@@ -573,8 +573,8 @@ namespace Library
 		return Remove(fit, lit);
 	}
 
-	template<typename T>
-	inline typename SList<T>::iterator SList<T>::Remove(const_iterator first, const const_iterator last)
+	template<typename T, typename Allocator>
+	inline typename SList<T, Allocator>::iterator SList<T, Allocator>::Remove(const_iterator first, const const_iterator last)
 	{
 		AssertOwner(first);
 		AssertOwner(last);
@@ -614,9 +614,9 @@ namespace Library
 		{
 			size--;
 			temp = temp->next;
-			delete node;
+			DeleteNode(node);
 		}
-		delete last.it.node;
+		DeleteNode(last.it.node);
 		size--;
 		
 		if (Size() == 1)
@@ -626,8 +626,8 @@ namespace Library
 		return first.it;
 	}
 
-	template<typename T>
-	inline typename SList<T>::iterator SList<T>::RemoveAfter(const_iterator pos)
+	template<typename T, typename Allocator>
+	inline typename SList<T, Allocator>::iterator SList<T, Allocator>::RemoveAfter(const_iterator pos)
 	{
 		AssertOwner(pos);
 		auto prev = pos++.it;
@@ -635,14 +635,14 @@ namespace Library
 		{
 			const auto temp = pos.it.node;
 			prev.node->next = (++pos).it.node;
-			delete temp;
+			DeleteNode(temp);
 			size--;
 		}
 		return pos.it;
 	}
 
-	template<typename T>
-	inline typename SList<T>::iterator SList<T>::RemoveAfter(const_iterator first, const const_iterator last)
+	template<typename T, typename Allocator>
+	inline typename SList<T, Allocator>::iterator SList<T, Allocator>::RemoveAfter(const_iterator first, const const_iterator last)
 	{
 		AssertOwner(first);
 		AssertOwner(last);
@@ -655,42 +655,42 @@ namespace Library
 		return last.it;
 	}
 
-	template<typename T>
-	inline void SList<T>::RemoveAllAfter(const const_iterator pos)
+	template<typename T, typename Allocator>
+	inline void SList<T, Allocator>::RemoveAllAfter(const const_iterator pos)
 	{
 		AssertOwner(pos);
 		RemoveAfter(pos, end());
 	}
 
-	template<typename T>
-	inline typename SList<T>::size_type SList<T>::RemoveAll(const T& t)
+	template<typename T, typename Allocator>
+	inline typename SList<T, Allocator>::size_type SList<T, Allocator>::RemoveAll(const T& t)
 	{
 		return RemoveAll([&t](const auto& a) { return t == a; });
 	}
 
-	template<typename T>
-	inline typename SList<T>::size_type SList<T>::RemoveAll(T&& t)
+	template<typename T, typename Allocator>
+	inline typename SList<T, Allocator>::size_type SList<T, Allocator>::RemoveAll(T&& t)
 	{
 		return RemoveAll([t = std::move(t)](const auto& a) { return t == a; });
 	}
 
-	template<typename T>
+	template<typename T, typename Allocator>
 	template<std::predicate<T> Predicate>
-	inline typename SList<T>::size_type SList<T>::RemoveAll(const Predicate predicate)
+	inline typename SList<T, Allocator>::size_type SList<T, Allocator>::RemoveAll(const Predicate predicate)
 	{
 		const size_t oldSize = size;
 		Remove(const_iterator(std::remove_if(begin(), end(), predicate)), end());
 		return oldSize - size;
 	}
 
-	template<typename T>
-	inline void SList<T>::PopFront()
+	template<typename T, typename Allocator>
+	inline void SList<T, Allocator>::PopFront()
 	{
 		if (!IsEmpty())
 		{
 			Node* temp = head;
 			head = head->next;
-			delete temp;
+			DeleteNode(temp);
 			size--;
 
 			if (Size() == 1)
@@ -700,14 +700,14 @@ namespace Library
 		}		
 	}
 	
-	template<typename T>
-	inline void SList<T>::PopBack()
+	template<typename T, typename Allocator>
+	inline void SList<T, Allocator>::PopBack()
 	{
 		if (!IsEmpty())
 		{
 			Node* temp = tail;
 			tail = GetPenultimate();
-			delete temp;
+			DeleteNode(temp);
 			size--;
 
 			if (IsEmpty())
@@ -721,8 +721,8 @@ namespace Library
 		}
 	}
 
-	template<typename T>
-	inline void SList<T>::Clear()
+	template<typename T, typename Allocator>
+	inline void SList<T, Allocator>::Clear()
 	{
 		// Banking on the compiler being smart enough to not put any of the code for counting deletions here.
 		Delete(head);
@@ -732,33 +732,33 @@ namespace Library
 #pragma endregion
 
 #pragma region Query
-	template<typename T>
-	inline typename SList<T>::iterator SList<T>::FindPrev(const T& t)
+	template<typename T, typename Allocator>
+	inline typename SList<T, Allocator>::iterator SList<T, Allocator>::FindPrev(const T& t)
 	{
 		return FindPrev([&t](const auto& a) { return a == t; });
 	}
 
-	template<typename T>
-	inline typename SList<T>::const_iterator SList<T>::FindPrev(const T& t) const
+	template<typename T, typename Allocator>
+	inline typename SList<T, Allocator>::const_iterator SList<T, Allocator>::FindPrev(const T& t) const
 	{
 		return const_cast<SList*>(this)->FindPrev(t);
 	}
 
-	template<typename T>
-	inline typename SList<T>::iterator SList<T>::FindPrev(T&& t)
+	template<typename T, typename Allocator>
+	inline typename SList<T, Allocator>::iterator SList<T, Allocator>::FindPrev(T&& t)
 	{
 		return FindPrev([t = std::move(t)](const auto& a) { return a == t; });
 	}
 
-	template<typename T>
-	inline typename SList<T>::const_iterator SList<T>::FindPrev(T&& t) const
+	template<typename T, typename Allocator>
+	inline typename SList<T, Allocator>::const_iterator SList<T, Allocator>::FindPrev(T&& t) const
 	{
 		return const_cast<SList*>(this)->FindPrev(std::move(t));
 	}
 
-	template<typename T>
+	template<typename T, typename Allocator>
 	template<std::predicate<T> Predicate>
-	inline typename SList<T>::iterator SList<T>::FindPrev(const Predicate predicate)
+	inline typename SList<T, Allocator>::iterator SList<T, Allocator>::FindPrev(const Predicate predicate)
 	{
 		auto it = before_begin();
 		while (it.node->next && !predicate(it.node->next->data))
@@ -768,17 +768,17 @@ namespace Library
 		return it;
 	}
 
-	template<typename T>
+	template<typename T, typename Allocator>
 	template<std::predicate<T> Predicate>
-	inline typename SList<T>::const_iterator SList<T>::FindPrev(const Predicate predicate) const
+	inline typename SList<T, Allocator>::const_iterator SList<T, Allocator>::FindPrev(const Predicate predicate) const
 	{
 		return const_cast<SList*>(this)->FindPrev(predicate);
 	}
 #pragma endregion
 
 #pragma region Memory
-	template<typename T>
-	inline void SList<T>::ShrinkTo(const size_type count)
+	template<typename T, typename Allocator>
+	inline void SList<T, Allocator>::ShrinkTo(const size_type count)
 	{
 		if (count > Size())
 		{
@@ -787,8 +787,8 @@ namespace Library
 		Remove(count, Size());
 	}
 	
-	template<typename T>
-	inline void SList<T>::Resize(const size_type count, const T& prototype)
+	template<typename T, typename Allocator>
+	inline void SList<T, Allocator>::Resize(const size_type count, const T& prototype)
 	{
 		if (count < Size())
 		{
@@ -800,14 +800,14 @@ namespace Library
 		}
 	}
 	
-	template<typename T>
-	inline void SList<T>::Swap(SList& other) noexcept
+	template<typename T, typename Allocator>
+	inline void SList<T, Allocator>::Swap(SList& other) noexcept
 	{
 		std::swap(*this, other);
 	}
 	
-	template<typename T>
-	inline void SList<T>::Reverse() noexcept
+	template<typename T, typename Allocator>
+	inline void SList<T, Allocator>::Reverse() noexcept
 	{
 		auto curr = head;
 		Node* prev = nullptr;
@@ -821,15 +821,15 @@ namespace Library
 		head = prev;
 	}
 
-	template<typename T>
-	inline void SList<T>::Sort()
+	template<typename T, typename Allocator>
+	inline void SList<T, Allocator>::Sort()
 	{
 		Sort(std::less<T>());
 	}
 	
-	template<typename T>
+	template<typename T, typename Allocator>
 	template<std::predicate<T, T> LessThan>
-	inline void SList<T>::Sort(const LessThan less)
+	inline void SList<T, Allocator>::Sort(const LessThan less)
 	{
 		if (Size() > 1)
 		{
@@ -856,23 +856,23 @@ namespace Library
 		}
 	}
 
-	template<typename T>
+	template<typename T, typename Allocator>
 	template<std::predicate<T, T> LessThan>
-	inline void SList<T>::Merge(SList<T>& other, const LessThan less)
+	inline void SList<T, Allocator>::Merge(SList<T, Allocator>& other, const LessThan less)
 	{
 		// A moved list is the same as an empty list.
 		Merge(std::move(other), less);
 	}
 
-	template<typename T>
-	inline void SList<T>::Merge(SList<T>& other)
+	template<typename T, typename Allocator>
+	inline void SList<T, Allocator>::Merge(SList<T, Allocator>& other)
 	{
 		Merge(other, std::less<T>());
 	}
 
-	template<typename T>
+	template<typename T, typename Allocator>
 	template<std::predicate<T, T> LessThan>
-	inline void SList<T>::Merge(SList<T>&& other, const LessThan less)
+	inline void SList<T, Allocator>::Merge(SList<T, Allocator>&& other, const LessThan less)
 	{
 		if (!other.IsEmpty())
 		{
@@ -888,30 +888,30 @@ namespace Library
 		other.SetPostMoveState();
 	}
 	
-	template<typename T>
-	inline void SList<T>::Merge(SList<T>&& other)
+	template<typename T, typename Allocator>
+	inline void SList<T, Allocator>::Merge(SList<T, Allocator>&& other)
 	{
 		Merge(std::move(other), std::less<T>());
 	}
 #pragma endregion
 	
 #pragma region Operators
-	template<typename T>
-	inline bool SList<T>::operator==(const SList<T>& other) const
+	template<typename T, typename Allocator>
+	inline bool SList<T, Allocator>::operator==(const SList<T, Allocator>& other) const
 	{
 		return this == &other || size == other.size && std::equal(begin(), end(), other.begin(), other.end());
 	}
 	
-	template<typename T>
-	inline bool SList<T>::operator!=(const SList<T>& other) const
+	template<typename T, typename Allocator>
+	inline bool SList<T, Allocator>::operator!=(const SList<T, Allocator>& other) const
 	{
 		return !operator==(other);
 	}
 #pragma endregion
 
 #pragma region Helpers
-	template<typename T>
-	inline typename SList<T>::iterator SList<T>::InsertAfter(const_iterator pos, Node* node)
+	template<typename T, typename Allocator>
+	inline typename SList<T, Allocator>::iterator SList<T, Allocator>::InsertAfter(const_iterator pos, Node* node)
 	{
 		AssertOwner(pos);
 		node->next = pos.it.node->next;
@@ -919,8 +919,8 @@ namespace Library
 		return ++pos.it;
 	}
 	
-	template<typename T>
-	inline void SList<T>::PushFront(Node* node) noexcept
+	template<typename T, typename Allocator>
+	inline void SList<T, Allocator>::PushFront(Node* node) noexcept
 	{
 		head = node;
 		if (IsEmpty())
@@ -930,20 +930,20 @@ namespace Library
 		size++;
 	}
 	
-	template<typename T>
-	inline typename SList<T>::iterator SList<T>::TailIt() noexcept
+	template<typename T, typename Allocator>
+	inline typename SList<T, Allocator>::iterator SList<T, Allocator>::TailIt() noexcept
 	{
 		return iterator(tail, this);
 	}
 	
-	template<typename T>
-	inline typename SList<T>::Node* SList<T>::GetPenultimate() const noexcept
+	template<typename T, typename Allocator>
+	inline typename SList<T, Allocator>::Node* SList<T, Allocator>::GetPenultimate() const noexcept
 	{
 		return GetPrev(tail);
 	}
 
-	template<typename T>
-	inline typename SList<T>::Node* SList<T>::GetPrev(const Node* node) const noexcept
+	template<typename T, typename Allocator>
+	inline typename SList<T, Allocator>::Node* SList<T, Allocator>::GetPrev(const Node* node) const noexcept
 	{	
 		auto it = before_begin();
 		while (it && it.it.node->next != node)
@@ -953,17 +953,17 @@ namespace Library
 		return it.it.node;
 	}
 
-	template<typename T>
-	inline typename SList<T>::iterator SList<T>::GetMiddle() const noexcept
+	template<typename T, typename Allocator>
+	inline typename SList<T, Allocator>::iterator SList<T, Allocator>::GetMiddle() const noexcept
 	{
 		auto ret = begin();
 		for (size_type i = 0; i < Size() / 2 - 1; i++, ++ret);
 		return ret.it;
 	}
 
-	template<typename T>
+	template<typename T, typename Allocator>
 	template<std::predicate<T, T> LessThan>
-	inline typename SList<T>::Node*SList<T>::Merge(Node* a, Node* b, const LessThan less)
+	inline typename SList<T, Allocator>::Node*SList<T, Allocator>::Merge(Node* a, Node* b, const LessThan less)
 	{
 		// These base cases will never be hit because we always check IsEmpty before calling this.
 		// For completeness of the algorithm, the code is still included, just commented out.
@@ -1005,38 +1005,66 @@ namespace Library
 		return head;
 	}
 
-	template<typename T>
-	inline typename SList<T>::size_type SList<T>::Delete(Node* node)
+	template<typename T, typename Allocator>
+	inline typename SList<T, Allocator>::size_type SList<T, Allocator>::Delete(Node* node)
 	{
 		return DeleteUntil(node, nullptr);
 	}
 
-	template<typename T>
-	inline typename SList<T>::size_type SList<T>::DeleteUntil(Node* node, const Node* until)
+	template<typename T, typename Allocator>
+	inline typename SList<T, Allocator>::size_type SList<T, Allocator>::DeleteUntil(Node* node, const Node* until)
 	{
 		size_type ret = 0;
 		for (auto prev = node; node != until; prev = node, ret++)
 		{
 			node = node->next;
-			delete prev;
+			DeleteNode(prev);
 		}
 		return ret;
 	}
 
-	template<typename T>
-	inline void SList<T>::AssertOwner([[maybe_unused]] const iterator it) const
+	template<typename T, typename Allocator>
+	template<typename... Args>
+	inline typename SList<T, Allocator>::Node* SList<T, Allocator>::NewNode(Args&&... args)
+	{
+		using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+		NodeAllocator allocator{};
+		Node* node = std::allocator_traits<NodeAllocator>::allocate(allocator, 1);
+		try
+		{
+			new (node) Node(std::forward<Args>(args)...);
+		}
+		catch (...)
+		{
+			std::allocator_traits<NodeAllocator>::deallocate(allocator, node, 1);
+			throw;
+		}
+		return node;
+	}
+
+	template<typename T, typename Allocator>
+	inline void SList<T, Allocator>::DeleteNode(Node* node) noexcept
+	{
+		using NodeAllocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+		NodeAllocator allocator{};
+		node->~Node();
+		std::allocator_traits<NodeAllocator>::deallocate(allocator, node, 1);
+	}
+
+	template<typename T, typename Allocator>
+	inline void SList<T, Allocator>::AssertOwner([[maybe_unused]] const iterator it) const
 	{
 		assertm(it.owner == this, "iterator does not belong to this SList");
 	}
 
-	template<typename T>
-	inline void SList<T>::AssertOwner(const const_iterator it) const
+	template<typename T, typename Allocator>
+	inline void SList<T, Allocator>::AssertOwner(const const_iterator it) const
 	{
 		AssertOwner(it.it);
 	}
 
-	template<typename T>
-	inline void SList<T>::ThrowEmpty() const
+	template<typename T, typename Allocator>
+	inline void SList<T, Allocator>::ThrowEmpty() const
 	{
 		if (IsEmpty())
 		{
@@ -1044,8 +1072,8 @@ namespace Library
 		}
 	}
 
-	template<typename T>
-	inline void SList<T>::ThrowIndex(const size_type index) const
+	template<typename T, typename Allocator>
+	inline void SList<T, Allocator>::ThrowIndex(const size_type index) const
 	{
 		if (index >= Size())
 		{
@@ -1053,24 +1081,24 @@ namespace Library
 		}
 	}
 	
-	template<typename T>
-	inline void SList<T>::Copy(const SList& other)
+	template<typename T, typename Allocator>
+	inline void SList<T, Allocator>::Copy(const SList& other)
 	{
 		if (!other.IsEmpty())
 		{
 			Node* node = other.head;
-			head = tail = new Node(node->data);
+			head = tail = NewNode(node->data);
 			while (node->next)
 			{
 				node = node->next;
-				tail->next = new Node(node->data);
+				tail->next = NewNode(node->data);
 				tail = tail->next;
 			}
 		}
 	}
 
-	template<typename T>
-	inline void SList<T>::SetPostMoveState() noexcept
+	template<typename T, typename Allocator>
+	inline void SList<T, Allocator>::SetPostMoveState() noexcept
 	{
 		head = tail = nullptr;
 		size = 0;
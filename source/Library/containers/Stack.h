@@ -10,7 +10,7 @@ namespace Library
 	 * LIFO wrapper with no fixed size limit.
 	 *
 	 * @param T				the type to store
-	 * @param Container		the container to use internally
+	 * @param Container		the container to use internally, e.g. SList or ChunkedList, with PushBack, EmplaceBack, PopBack and Back
 	 */
 	template<typename T, typename Container = SList<T>>
 	class Stack
@@ -104,7 +104,7 @@ namespace Library
 		 * @param args		the arguments to construct a value_type in-place
 		 */
 		template<typename... Args>
-		auto Emplace(Args&&... args);
+		reference Emplace(Args&&... args);
 #pragma endregion
 
 #pragma region Remove
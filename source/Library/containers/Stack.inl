@@ -63,9 +63,9 @@ namespace Library
 
 	TEMPLATE
 	template<typename... Args>
-	inline auto STACK::Emplace(Args&& ...args)
+	inline typename STACK::reference STACK::Emplace(Args&& ...args)
 	{
-		return c.Emplace(std::forward<Args>(args)...);
+		return c.EmplaceBack(std::forward<Args>(args)...);
 	}
 #pragma endregion
 
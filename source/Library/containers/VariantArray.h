@@ -915,6 +915,15 @@ namespace Library
 		 */
 		template<typename T, std::predicate<T> Predicate>
 		size_type IndexOf(Predicate pred) const;
+
+		/**
+		 * does an O(n) count of the occurrences of the passed element
+		 *
+		 * @param t				the element to count
+		 * @returns				how many elements equal t
+		 */
+		template<typename T>
+		size_type Count(const T& t) const;
 #pragma endregion
 		
 #pragma region Memory
@@ -1076,6 +1085,9 @@ namespace Library
 		constexpr auto Visit(Callable&& callable) const;
 #pragma endregion
 	};
+
+	template<typename... Ts>
+	struct Util::IsTriviallyRelocatable<VariantArray<Ts...>> : std::true_type {};
 }
 
 #include "VariantArray.inl"
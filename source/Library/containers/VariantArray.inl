@@ -696,6 +696,13 @@ namespace Library
 	{
 		return GetArray<T>().IndexOf(pred);
 	}
+
+	template<typename ...Ts>
+	template<typename T>
+	inline size_t VariantArray<Ts...>::Count(const T& t) const
+	{
+		return GetArray<T>().Count(t);
+	}
 #pragma endregion
 	
 #pragma region Memory
@@ -4,6 +4,7 @@
 #include "Coroutine.h"
 
 #include "LibMath.h"
+#include "Manager.h"
 
 namespace Library
 {
@@ -165,8 +166,13 @@ namespace Library
 			case PendingOp::Type::Add:
 				if (async)
 				{
+					// the Coroutine may dereference this thread's objects, which must stay put until it's joined
+					Memory::Manager::Share();
 					auto& [func, coro] = pair;
-					asyncCoroutines.Insert({ key, { func, std::async(std::launch::async, [&c = coro] { while (c->Resume()); }) } });
+					if (!asyncCoroutines.Insert({ key, { func, std::async(std::launch::async, [&c = coro] { while (c->Resume()); }) } }).second)
+					{
+						Memory::Manager::Unshare();
+					}
 				}
 				else
 				{
@@ -176,15 +182,26 @@ namespace Library
 				
 			case PendingOp::Type::Remove:
 				blockCoroutines.Remove(key);
-				asyncCoroutines.Remove(key);
+				// destroying the future waits for the Coroutine to finish
+				if (asyncCoroutines.Remove(key))
+				{
+					Memory::Manager::Unshare();
+				}
 				break;
 				
 			case PendingOp::Type::RemoveAll:
+			{
 				blockCoroutines.Clear();
 				blockCoroutines.Resize(1);
+				const size_t numAsync = asyncCoroutines.Size();
 				asyncCoroutines.Clear();
 				asyncCoroutines.Resize(1);
+				for (size_t i = 0; i < numAsync; ++i)
+				{
+					Memory::Manager::Unshare();
+				}
 				break;
+			}
 				
 			default:;
 			}
@@ -153,7 +153,8 @@ namespace Library
 
 		static inline HashMap<Key, Pair> blockCoroutines{};
 		static inline HashMap<Key, std::pair<std::shared_ptr<Functor>, std::shared_future<void>>> asyncCoroutines{};
-		static inline SList<PendingOp> pendingOps{};
+		// Every op is applied and cleared by the next Update, so its Nodes are recycled rather than freed.
+		static inline SList<PendingOp, RecyclingAllocator<PendingOp>> pendingOps{};
 		static inline AggregateException aggregateException{};
 		
 		/**
@@ -179,6 +180,10 @@ namespace Library
 		/**
 		 * O(1)
 		 * 
+		 * An async Coroutine may dereference objects allocated by the thread which calls Update, but no other thread's.
+		 * Until it's been joined, that thread's Memory::Manager::Collect won't move anything, see Memory::Manager::Share.
+		 * Calling Memory::Manager::Defrag, DefragStep or Graduate on that thread meanwhile is not allowed.
+		 * 
 		 * @param coroutine		the Coroutine to enqueue
 		 * @param async			whether or not to run the Coroutine asynchronously
 		 */
@@ -187,6 +192,8 @@ namespace Library
 		/**
 		 * O(1)
 		 * 
+		 * Async Coroutines have the same restrictions as with the other overload.
+		 * 
 		 * @param key			the Key for this Coroutine
 		 * @param coroutine		the coroutine to enqueue
 		 * @param async			whether or not to run the Coroutine asynchronously
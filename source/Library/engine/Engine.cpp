@@ -7,6 +7,7 @@
 #include "Coroutine.h"
 #include "Entity.h"
 #include "EngineTime.h"
+#include "Frame.h"
 #include "Input.h"
 
 #ifdef _WIN32
@@ -42,7 +43,7 @@ namespace Library
 	void Engine::Init()
 	{
 		world = nullptr;
-		world = SharedPtr<Entity>::Make();
+		world = SharedPtr<Entity>::MakePinned();
 		world->SetName("World");
 		world->Init();
 
@@ -69,11 +70,22 @@ namespace Library
 	}
 
 	void Engine::Update()
-	{		
+	{
+		Memory::Frame::Reset();
 		Time::Update();
 		Input::Update();
 		Coroutines::Update();
 		world->Update();
+		Memory::Manager::Collect(collectBudget);
+	}
+
+	void Engine::Defrag()
+	{
+		assertm(Coroutines::asyncCoroutines.IsEmpty(), "async Coroutines may be dereferencing the World");
+		// the World itself is pinned, so only its descendants can move
+		Memory::Manager::Layout layout{};
+		world->Arrange(layout);
+		Memory::Manager::Defrag(layout);
 	}
 	
 	void Engine::Terminate()
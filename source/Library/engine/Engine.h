@@ -7,6 +7,7 @@
 #include "Macros.h"
 #include "SharedPtr.h"
 #include "Entity.h"
+#include "EngineTime.h"
 
 namespace Library
 {	
@@ -14,8 +15,8 @@ namespace Library
 	{
 		friend Entity;
 		
-		/** the parentmost Entity */
-		static inline SharedPtr<Entity> world{ nullptr };
+		/** the parentmost Entity, pinned since every Update starts from it */
+		static inline PinnedPtr<Entity> world{ nullptr };
 		
 		static inline std::string programName{};
 		static inline std::string pythonSourceDirectory{};
@@ -23,6 +24,9 @@ namespace Library
 		static inline const std::string shutdownFileName{ "del.py" };
 
 		static inline FILE* initFilePtr{ nullptr };
+
+		/** how long Memory::Manager may spend collecting each frame, which moves nothing while async Coroutines are running */
+		static inline Time::Millis collectBudget{ 1 };
 		
 	public:
 		STATIC_CLASS(Engine)
@@ -57,6 +61,14 @@ namespace Library
 		 */
 		static void Update();
 
+		/**
+		 * Defrags with the World laid out in the order Update() walks it, so that each subtree sits together in memory.
+		 * Worth calling after building or restructuring a large part of the World, such as after loading a level.
+		 * Must not be called while async Coroutines are running, since they may be dereferencing what it moves.
+		 * O(n) where n is the number of Entities
+		 */
+		static void Defrag();
+
 		/**
 		 * runs after the last Update()
 		 */
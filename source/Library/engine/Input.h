@@ -6,6 +6,7 @@
 #include "Event.h"
 #include "EventManager.h"
 #include "HashMap.h"
+#include "InlineArray.h"
 
 namespace Library
 {
@@ -110,8 +111,8 @@ namespace Library
 			bool seen;
 		} keys[NUM_KEYS];
 
-		/** the "stack" of keys currently held */
-		static inline Array<KeyCode> keysHeld{};
+		/** the "stack" of keys currently held, rarely more than a few */
+		static inline InlineArray<KeyCode, 8> keysHeld{};
 		/** user-friendly mappings of strings to keys */
 		static inline HashMap<std::string, KeyCode> mappings{};
 
@@ -52,8 +52,11 @@ namespace Library
 		 * - Guaranteed no duplicate listeners.
 		 */
 		HashMap<Key, Listener> listeners{};
-		/** the list of pending operations */
-		SList<PendingOp> pendingOps{};
+		/**
+		 * The list of pending operations.
+		 * It's filled and cleared on every Invoke, so its Nodes are recycled rather than freed.
+		 */
+		SList<PendingOp, RecyclingAllocator<PendingOp>> pendingOps{};
 		/**
 		 * The net number of items pending to be added.
 		 * Not necesarilly same as pendingOps.Size().
@@ -140,6 +140,17 @@ Entity::iterator Entity::end() noexcept
 	}
 #pragma endregion
 
+#pragma region Memory
+	void Entity::Arrange(Memory::Manager::Layout& layout) const
+	{
+		for (const auto& [childName, child] : children)
+		{
+			layout.PushBack(child);
+			child->Arrange(layout);
+		}
+	}
+#pragma endregion
+
 #pragma region operators
 	bool operator==(const Entity& a, const Entity& b) noexcept
 	{
@@ -582,6 +582,17 @@ namespace Library
 		void RemoveChild(const String& childName) noexcept;
 #pragma endregion
 
+#pragma region Memory
+		/**
+		 * Appends every descendant to layout in the same order Update() visits them.
+		 * This Entity itself is not appended.
+		 * O(n) where n is the number of descendants
+		 *
+		 * @param layout	where to append the descendants
+		 */
+		void Arrange(Memory::Manager::Layout& layout) const;
+#pragma endregion
+
 #pragma region operators
 		/**
 		 * O(n) where n is the number of attributes
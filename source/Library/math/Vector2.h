@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Macros.h"
+#include "Util.h"
 
 namespace Library
 {
@@ -46,4 +47,7 @@ namespace Library
 
 		friend std::ostream& operator<<(std::ostream& stream, const Vector2& v);
 	};
+
+	template<>
+	struct Util::IsBitwiseComparable<Vector2> : std::true_type {};
 }
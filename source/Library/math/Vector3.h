@@ -78,4 +78,7 @@ namespace Library
 		friend std::ostream& operator<<(std::ostream& stream, const Vector3& v);
 #pragma endregion
 	};
+
+	template<>
+	struct Util::IsBitwiseComparable<Vector3> : std::true_type {};
 }
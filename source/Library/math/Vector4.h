@@ -81,4 +81,7 @@ namespace Library
 		friend std::ostream& operator<<(std::ostream& stream, const Vector4& v);
 #pragma endregion
 	};
+
+	template<>
+	struct Util::IsBitwiseComparable<Vector4> : std::true_type {};
 }
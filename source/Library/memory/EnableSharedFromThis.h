@@ -4,13 +4,17 @@
 
 namespace Library
 {
-	template<typename Derived>
+	/**
+	 * @param <Derived>		the class inheriting from this
+	 * @param <RefCount>	how the reference counts are updated, must match the SharedPtrs which will own Derived
+	 */
+	template<typename Derived, Concept::RefCount RefCount = Memory::NonAtomicRefCount>
 	class EnableSharedFromThis
 	{
-		template<typename T>
+		template<typename T, Concept::RefCount>
 		friend class SharedPtr;
 		
-		WeakPtr<Derived> weakThis{};
+		WeakPtr<Derived, RefCount> weakThis{};
 
 	public:
 		constexpr EnableSharedFromThis() noexcept = default;
@@ -19,11 +23,11 @@ namespace Library
 		~EnableSharedFromThis() noexcept = default;
 		MOVE_SEMANTICS(EnableSharedFromThis, default)
 		
-		SharedPtr<Derived> SharedFromThis();
-		SharedPtr<const Derived> SharedFromThis() const;
+		SharedPtr<Derived, RefCount> SharedFromThis();
+		SharedPtr<const Derived, RefCount> SharedFromThis() const;
 
-		WeakPtr<Derived> WeakFromThis();
-		WeakPtr<const Derived> WeakFromThis() const;
+		WeakPtr<Derived, RefCount> WeakFromThis();
+		WeakPtr<const Derived, RefCount> WeakFromThis() const;
 	};
 }
 
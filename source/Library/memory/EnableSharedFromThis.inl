@@ -3,37 +3,37 @@
 
 namespace Library
 {
-	template<typename Derived>
-	inline EnableSharedFromThis<Derived>::EnableSharedFromThis(const EnableSharedFromThis&) noexcept :
+	template<typename Derived, Concept::RefCount RefCount>
+	inline EnableSharedFromThis<Derived, RefCount>::EnableSharedFromThis(const EnableSharedFromThis&) noexcept :
 		weakThis() {} // SmartPtr ctor will initialize weakThis
 	
-	template<typename Derived>
-	inline EnableSharedFromThis<Derived>& EnableSharedFromThis<Derived>::operator=(const EnableSharedFromThis&) noexcept
+	template<typename Derived, Concept::RefCount RefCount>
+	inline EnableSharedFromThis<Derived, RefCount>& EnableSharedFromThis<Derived, RefCount>::operator=(const EnableSharedFromThis&) noexcept
 	{
 		// assign must not change weakThis
 		return *this;
 	}
 
-	template<typename Derived>
-	inline SharedPtr<Derived> EnableSharedFromThis<Derived>::SharedFromThis()
+	template<typename Derived, Concept::RefCount RefCount>
+	inline SharedPtr<Derived, RefCount> EnableSharedFromThis<Derived, RefCount>::SharedFromThis()
 	{
-		return SharedPtr<Derived>(WeakFromThis());
+		return SharedPtr<Derived, RefCount>(WeakFromThis());
 	}
 	
-	template<typename Derived>
-	inline SharedPtr<const Derived> EnableSharedFromThis<Derived>::SharedFromThis() const
+	template<typename Derived, Concept::RefCount RefCount>
+	inline SharedPtr<const Derived, RefCount> EnableSharedFromThis<Derived, RefCount>::SharedFromThis() const
 	{
 		return const_cast<EnableSharedFromThis*>(this)->SharedFromThis();
 	}
 	
-	template<typename Derived>
-	inline WeakPtr<Derived> EnableSharedFromThis<Derived>::WeakFromThis()
+	template<typename Derived, Concept::RefCount RefCount>
+	inline WeakPtr<Derived, RefCount> EnableSharedFromThis<Derived, RefCount>::WeakFromThis()
 	{
 		return weakThis;
 	}
 	
-	template<typename Derived>
-	inline WeakPtr<const Derived> EnableSharedFromThis<Derived>::WeakFromThis() const
+	template<typename Derived, Concept::RefCount RefCount>
+	inline WeakPtr<const Derived, RefCount> EnableSharedFromThis<Derived, RefCount>::WeakFromThis() const
 	{
 		return const_cast<EnableSharedFromThis*>(this)->WeakFromThis();
 	}
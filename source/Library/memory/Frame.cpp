@@ -0,0 +1,100 @@
+#include "pch.h"
+#include "Frame.h"
+
+#include <bit>
+#include "Memory.h"
+
+namespace Library::Memory
+{
+	std::array<Frame::Arena, 2> Frame::arenas{};
+	std::atomic<size_t> Frame::current{ 0 };
+	std::mutex Frame::overflowMutex{};
+
+#pragma region Arena
+	Frame::Arena::~Arena() noexcept
+	{
+		for (void* block : overflow)
+		{
+			Free(block);
+		}
+		Free(begin);
+	}
+
+	void Frame::Arena::Rewind() noexcept
+	{
+		std::scoped_lock lock(overflowMutex);
+		if (!overflow.empty()) [[unlikely]]
+		{
+			for (void* block : overflow)
+			{
+				Free(block);
+			}
+			overflow.clear();
+			Grow(top.load(std::memory_order_relaxed) + overflowBytes);
+			overflowBytes = 0;
+		}
+		top.store(0, std::memory_order_relaxed);
+	}
+
+	void Frame::Arena::Grow(const size_t numBytes) noexcept
+	{
+		if (numBytes <= capacity)
+		{
+			return;
+		}
+		capacity = std::bit_ceil(std::max(numBytes, minCapacity));
+		Free(begin);
+		begin = Malloc<std::byte>(capacity);
+	}
+#pragma endregion
+
+	void* Frame::Alloc(const size_t numBytes, const size_t alignment) noexcept
+	{
+		assertm(alignment <= alignof(std::max_align_t), "over-aligned allocations are not supported");
+		Arena& arena = arenas[current.load(std::memory_order_acquire)];
+
+		size_t offset = arena.top.load(std::memory_order_relaxed);
+		for EVER
+		{
+			// begin is aligned to max_align_t, so aligning the offset aligns the address
+			const size_t aligned = (offset + alignment - 1) & ~(alignment - 1);
+			const size_t end = aligned + numBytes;
+			if (end > arena.capacity) [[unlikely]]
+			{
+				break;
+			}
+			if (arena.top.compare_exchange_weak(offset, end, std::memory_order_relaxed))
+			{
+				return arena.begin + aligned;
+			}
+		}
+
+		std::scoped_lock lock(overflowMutex);
+		void* ret = Malloc(numBytes);
+		arena.overflow.push_back(ret);
+		arena.overflowBytes += numBytes + alignment - 1;
+		return ret;
+	}
+
+	void Frame::Reset() noexcept
+	{
+		const size_t next = 1 - current.load(std::memory_order_relaxed);
+		arenas[next].Rewind();
+		current.store(next, std::memory_order_release);
+	}
+
+	void Frame::Reserve(const size_t numBytes) noexcept
+	{
+		for (Arena& arena : arenas)
+		{
+			arena.Grow(numBytes);
+		}
+	}
+
+	size_t Frame::BytesUsed() noexcept
+	{
+		const Arena& arena = arenas[current.load(std::memory_order_acquire)];
+		std::scoped_lock lock(overflowMutex);
+		return arena.top.load(std::memory_order_relaxed) + arena.overflowBytes;
+	}
+}
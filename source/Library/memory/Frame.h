@@ -0,0 +1,106 @@
+// MIT License Copyright (c) 2020 Jarrett Wendt
+
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+#include "Macros.h"
+
+namespace Library::Memory
+{
+	/**
+	 * Scratch memory for temporaries which never outlive the next frame.
+	 *
+	 * Allocating bumps a pointer and freeing does nothing at all.
+	 * Instead, everything is thrown away at once by Reset, which Engine::Update calls at the start of every frame.
+	 * There are two arenas which take turns, so memory allocated during one frame stays valid until the end of the next one.
+	 * An arena which runs out of space falls back on Malloc for the rest of the frame, then grows to fit the next time it's Reset.
+	 */
+	class Frame final
+	{
+		struct Arena final
+		{
+			std::byte* begin{ nullptr };
+			size_t capacity{ 0 };
+			// Offset from begin of the next free byte.
+			std::atomic<size_t> top{ 0 };
+			// Allocations which didn't fit, freed by Rewind.
+			std::vector<void*> overflow{};
+			// Bytes in overflow, used to decide how big to grow.
+			size_t overflowBytes{ 0 };
+
+			Arena() noexcept = default;
+			MOVE_COPY(Arena, delete)
+			~Arena() noexcept;
+
+			/**
+			 * O(1), unless it overflowed.
+			 *
+			 * Throws away everything in this arena, growing it if it needed more space.
+			 */
+			void Rewind() noexcept;
+
+			/**
+			 * Replaces the buffer with an empty one of at least this many bytes.
+			 */
+			void Grow(size_t numBytes) noexcept;
+		};
+
+		static std::array<Arena, 2> arenas;
+		// Index of the arena being allocated from.
+		static std::atomic<size_t> current;
+		// Guards every Arena's overflow.
+		static std::mutex overflowMutex;
+
+	public:
+		STATIC_CLASS(Frame)
+
+		/**
+		 * Arenas never shrink below this once they have had to grow.
+		 */
+		constexpr static size_t minCapacity = 4 << 10;
+
+		/**
+		 * Amortized O(1)
+		 * May be called from any thread.
+		 *
+		 * @param numBytes		how many bytes to reserve
+		 * @param alignment		alignment of the bytes, at most alignof(std::max_align_t)
+		 * @returns				memory which is valid until the end of the next frame
+		 */
+		[[nodiscard]] static void* Alloc(size_t numBytes, size_t alignment) noexcept;
+
+		/**
+		 * Let C++'s compile-time type system figure out numBytes and alignment for you.
+		 * Does not construct anything.
+		 *
+		 * @param count		how many T's worth of memory to reserve
+		 */
+		template<typename T>
+		[[nodiscard]] static T* Alloc(size_t count = 1) noexcept;
+
+		/**
+		 * O(1), unless the arena being switched to overflowed.
+		 *
+		 * Starts a new frame, throwing away everything allocated two frames ago.
+		 * Must only be called from the thread which runs the frame.
+		 */
+		static void Reset() noexcept;
+
+		/**
+		 * Grows both arenas to at least numBytes, so that the first frames don't have to overflow.
+		 * Must only be called when nothing allocated from the Frame is alive, such as at startup.
+		 */
+		static void Reserve(size_t numBytes) noexcept;
+
+		/**
+		 * @returns		how many bytes have been allocated so far this frame
+		 */
+		static size_t BytesUsed() noexcept;
+	};
+}
+
+#include "Frame.inl"
@@ -0,0 +1,11 @@
+#pragma once
+#include "Frame.h"
+
+namespace Library::Memory
+{
+	template<typename T>
+	inline T* Frame::Alloc(const size_t count) noexcept
+	{
+		return reinterpret_cast<T*>(Alloc(count * sizeof(T), alignof(T)));
+	}
+}
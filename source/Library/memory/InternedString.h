@@ -143,6 +143,9 @@ namespace Library
 		String operator""_s(const wchar_t* str, size_t length) noexcept;
 	}
 
+	template<>
+	struct Util::IsTriviallyRelocatable<String> : std::true_type {};
+
 	template<>
 	struct Hash<String>
 	{
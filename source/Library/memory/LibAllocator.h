@@ -1,15 +1,135 @@
 #pragma once
+#include <concepts>
 #include <cstddef>
 #include <limits>
 
 #include "Macros.h"
+#include "Frame.h"
 #include "Memory.h"
+#include "Pool.h"
+#include "Profiler.h"
 
-namespace Library
+namespace Library::Concept
 {
+	/**
+	 * Where an Allocator gets its memory from.
+	 */
 	template<typename T>
+	concept AllocationStrategy = requires(void* p, size_t numBytes, size_t alignment)
+	{
+		{ T::Allocate(numBytes, alignment) }->std::convertible_to<void*>;
+		T::Deallocate(p, numBytes, alignment);
+	};
+}
+
+namespace Library
+{
+	template<typename T, size_t capacity, Concept::AllocationStrategy Strategy>
+	class RecyclingAllocator;
+}
+
+namespace Library::Memory
+{
+	/**
+	 * Every allocation goes straight to Malloc.
+	 */
+	struct MallocStrategy final
+	{
+		STATIC_CLASS(MallocStrategy)
+
+		[[nodiscard]] static void* Allocate(size_t numBytes, size_t alignment) noexcept;
+		static void Deallocate(void* p, size_t numBytes, size_t alignment) noexcept;
+	};
+
+	/**
+	 * Small allocations come from the Pool, anything else goes to Malloc.
+	 * Meant for node-based containers which allocate one small node at a time.
+	 */
+	struct PoolStrategy final
+	{
+		STATIC_CLASS(PoolStrategy)
+
+		[[nodiscard]] static void* Allocate(size_t numBytes, size_t alignment) noexcept;
+		static void Deallocate(void* p, size_t numBytes, size_t alignment) noexcept;
+	};
+
+	/**
+	 * Everything comes from the Frame, and is only valid until the end of the next frame.
+	 * Deallocating does nothing.
+	 */
+	struct FrameStrategy final
+	{
+		STATIC_CLASS(FrameStrategy)
+
+		[[nodiscard]] static void* Allocate(size_t numBytes, size_t alignment) noexcept;
+		static void Deallocate(void* p, size_t numBytes, size_t alignment) noexcept;
+	};
+
+	/**
+	 * Keeps track of every RecyclingAllocator free list on each thread, so that they can all be emptied at once.
+	 */
+	class Recycler final
+	{
+		STATIC_CLASS(Recycler)
+
+		template<typename T, size_t capacity, Concept::AllocationStrategy Strategy>
+		friend class Library::RecyclingAllocator;
+
+		struct FreeBlock final
+		{
+			FreeBlock* next;
+		};
+
+		/**
+		 * One type's recycled blocks on one thread.
+		 * Registers itself with the calling thread when constructed, and gives its blocks back when destructed.
+		 * Other thread_locals and statics may still free blocks after that, which must then skip the lists, see tornDown.
+		 */
+		struct FreeList final
+		{
+			using ReleaseFunction = void(*)(FreeList&) noexcept;
+
+			FreeBlock* head{ nullptr };
+			size_t size{};
+			FreeList* nextList{ nullptr };
+			const ReleaseFunction release;
+
+			explicit FreeList(ReleaseFunction release) noexcept;
+			MOVE_COPY(FreeList, delete)
+			~FreeList() noexcept;
+
+			void Push(void* block) noexcept;
+			[[nodiscard]] void* Pop() noexcept;
+		};
+
+		static inline thread_local FreeList* lists{ nullptr };
+		// Set once any of the thread's FreeLists has been destructed, after which nothing is recycled.
+		// Trivially destructible, so it can still be read until the thread's storage is released.
+		static inline thread_local bool tornDown{ false };
+
+	public:
+		/**
+		 * O(n) where n is the number of recycled blocks on the calling thread
+		 *
+		 * Gives every block recycled on the calling thread back to where it came from.
+		 * Useful after a spike, or to balance the books before checking for leaks.
+		 */
+		static void Release() noexcept;
+
+		/**
+		 * O(n) where n is the number of types being recycled on the calling thread
+		 *
+		 * @returns		how many blocks the calling thread is holding on to for reuse
+		 */
+		[[nodiscard]] static size_t NumRecycled() noexcept;
+	};
+}
+
+namespace Library
+{
+	template<typename T, Concept::AllocationStrategy Strategy = Memory::MallocStrategy>
 	class Allocator
-	{		
+	{
 	public:
 		using size_type = size_t;
 		using difference_type = ptrdiff_t;
@@ -22,25 +142,35 @@ namespace Library
 
 	public:
 		SPECIAL_MEMBERS(Allocator, default)
-		
+
 		template<typename U>
-		constexpr Allocator(const Allocator<U>&) noexcept {}
-		
+		constexpr Allocator(const Allocator<U, Strategy>&) noexcept {}
+
 		[[nodiscard]] T* allocate(const size_type n)
 		{
 #ifdef _DEBUG
 			numAllocations++;
 #endif
-			return Memory::Malloc<T>(n);
+			T* ret = reinterpret_cast<T*>(Strategy::Allocate(n * sizeof(T), alignof(T)));
+			// Malloc records its own
+			if constexpr (!std::same_as<Strategy, Memory::MallocStrategy>)
+			{
+				Memory::Profiler::OnAlloc(Memory::Profiler::Source::Allocator, reinterpret_cast<std::uintptr_t>(ret), n * sizeof(T));
+			}
+			return ret;
 		}
 
-		void deallocate(T* p, size_type)
+		void deallocate(T* p, const size_type n)
 		{
 #ifdef _DEBUG
 			numAllocations--;
 			assertm(numAllocations != std::numeric_limits<size_type>::max(), "underflow");
 #endif
-			Memory::Free(p);
+			if constexpr (!std::same_as<Strategy, Memory::MallocStrategy>)
+			{
+				Memory::Profiler::OnFree(Memory::Profiler::Source::Allocator, reinterpret_cast<std::uintptr_t>(p));
+			}
+			Strategy::Deallocate(p, n * sizeof(T), alignof(T));
 		}
 
 		static constexpr size_type NumAllocations() noexcept
@@ -48,4 +178,78 @@ namespace Library
 			return numAllocations;
 		}
 	};
+
+	/**
+	 * Allocator for node-based containers such as SList and HashMap, e.g. `SList<T, PoolAllocator<T>>`.
+	 */
+	template<typename T>
+	using PoolAllocator = Allocator<T, Memory::PoolStrategy>;
+
+	/**
+	 * Allocator for containers which are emptied every frame, e.g. `SList<T, FrameAllocator<T>>`.
+	 */
+	template<typename T>
+	using FrameAllocator = Allocator<T, Memory::FrameStrategy>;
+
+	/**
+	 * Allocator for node-based containers which are filled and emptied over and over, e.g. `SList<T, RecyclingAllocator<T>>`.
+	 * Each thread keeps up to capacity freed blocks of each type and hands them back out before asking Strategy for more,
+	 * so push/pop cycles which stay under capacity make no allocations once they've warmed up.
+	 * Only single blocks are recycled, anything bigger goes straight to Strategy.
+	 *
+	 * Strategy shouldn't keep per-thread state of its own, since recycled blocks go back to it as the thread exits.
+	 * PoolStrategy already recycles, so there's no reason to layer the two.
+	 */
+	template<typename T, size_t capacity = 64, Concept::AllocationStrategy Strategy = Memory::MallocStrategy>
+	class RecyclingAllocator
+	{
+	public:
+		using size_type = size_t;
+		using difference_type = ptrdiff_t;
+		using value_type = T;
+		using propagate_on_container_move_assignment = std::true_type;
+		using is_always_equal = std::true_type;
+
+		template<typename U>
+		struct rebind
+		{
+			using other = RecyclingAllocator<U, capacity, Strategy>;
+		};
+
+	private:
+		using Base = Allocator<T, Strategy>;
+
+		// a free block has to fit the pointer to the next one
+		static constexpr bool recyclable = capacity > 0 && sizeof(T) >= sizeof(Memory::Recycler::FreeBlock) && alignof(T) >= alignof(Memory::Recycler::FreeBlock);
+
+		static void Release(Memory::Recycler::FreeList& list) noexcept;
+
+		inline static thread_local Memory::Recycler::FreeList freeList{ Release };
+
+	public:
+		SPECIAL_MEMBERS(RecyclingAllocator, default)
+
+		template<typename U>
+		constexpr RecyclingAllocator(const RecyclingAllocator<U, capacity, Strategy>&) noexcept {}
+
+		/**
+		 * O(1)
+		 *
+		 * @param n		number of Ts to allocate
+		 * @returns		a recycled block if n is 1 and there is one, otherwise memory from Strategy
+		 */
+		[[nodiscard]] T* allocate(size_type n);
+
+		/**
+		 * O(1)
+		 *
+		 * Recycles p if it's a single block and this thread has room for it, otherwise gives it back to Strategy.
+		 *
+		 * @param p		memory returned by allocate
+		 * @param n		same n that was passed to allocate
+		 */
+		void deallocate(T* p, size_type n);
+	};
 }
+
+#include "LibAllocator.inl"
@@ -0,0 +1,135 @@
+#pragma once
+#include "LibAllocator.h"
+
+namespace Library::Memory
+{
+	inline void* MallocStrategy::Allocate(const size_t numBytes, [[maybe_unused]] const size_t alignment) noexcept
+	{
+		return Malloc(numBytes);
+	}
+
+	inline void MallocStrategy::Deallocate(void* p, [[maybe_unused]] const size_t numBytes, [[maybe_unused]] const size_t alignment) noexcept
+	{
+		Free(p);
+	}
+
+	inline void* PoolStrategy::Allocate(const size_t numBytes, const size_t alignment) noexcept
+	{
+		return Pool::CanPool(numBytes, alignment) ? Pool::Alloc(numBytes) : Malloc(numBytes);
+	}
+
+	inline void PoolStrategy::Deallocate(void* p, const size_t numBytes, const size_t alignment) noexcept
+	{
+		if (Pool::CanPool(numBytes, alignment))
+		{
+			Pool::Free(p, numBytes);
+		}
+		else
+		{
+			Free(p);
+		}
+	}
+
+	inline void* FrameStrategy::Allocate(const size_t numBytes, const size_t alignment) noexcept
+	{
+		return Frame::Alloc(numBytes, alignment);
+	}
+
+	inline void FrameStrategy::Deallocate([[maybe_unused]] void* p, [[maybe_unused]] const size_t numBytes, [[maybe_unused]] const size_t alignment) noexcept {}
+
+#pragma region Recycler
+	inline Recycler::FreeList::FreeList(const ReleaseFunction release) noexcept :
+		nextList(lists),
+		release(release)
+	{
+		lists = this;
+	}
+
+	inline Recycler::FreeList::~FreeList() noexcept
+	{
+		release(*this);
+		for (FreeList** it = &lists; *it; it = &(*it)->nextList)
+		{
+			if (*it == this)
+			{
+				*it = nextList;
+				break;
+			}
+		}
+		tornDown = true;
+	}
+
+	inline void Recycler::FreeList::Push(void* block) noexcept
+	{
+		FreeBlock* freeBlock = reinterpret_cast<FreeBlock*>(block);
+		freeBlock->next = head;
+		head = freeBlock;
+		size++;
+	}
+
+	inline void* Recycler::FreeList::Pop() noexcept
+	{
+		FreeBlock* ret = head;
+		head = ret->next;
+		size--;
+		return ret;
+	}
+
+	inline void Recycler::Release() noexcept
+	{
+		for (FreeList* list = lists; list; list = list->nextList)
+		{
+			list->release(*list);
+		}
+	}
+
+	inline size_t Recycler::NumRecycled() noexcept
+	{
+		size_t ret = 0;
+		for (const FreeList* list = lists; list; list = list->nextList)
+		{
+			ret += list->size;
+		}
+		return ret;
+	}
+#pragma endregion
+}
+
+namespace Library
+{
+	template<typename T, size_t capacity, Concept::AllocationStrategy Strategy>
+	inline T* RecyclingAllocator<T, capacity, Strategy>::allocate(const size_type n)
+	{
+		if constexpr (recyclable)
+		{
+			if (n == 1 && !Memory::Recycler::tornDown && freeList.head)
+			{
+				return reinterpret_cast<T*>(freeList.Pop());
+			}
+		}
+		return Base{}.allocate(n);
+	}
+
+	template<typename T, size_t capacity, Concept::AllocationStrategy Strategy>
+	inline void RecyclingAllocator<T, capacity, Strategy>::deallocate(T* p, const size_type n)
+	{
+		if constexpr (recyclable)
+		{
+			if (n == 1 && !Memory::Recycler::tornDown && freeList.size < capacity)
+			{
+				freeList.Push(p);
+				return;
+			}
+		}
+		Base{}.deallocate(p, n);
+	}
+
+	template<typename T, size_t capacity, Concept::AllocationStrategy Strategy>
+	inline void RecyclingAllocator<T, capacity, Strategy>::Release(Memory::Recycler::FreeList& list) noexcept
+	{
+		while (list.head)
+		{
+			Base{}.deallocate(reinterpret_cast<T*>(list.Pop()), 1);
+		}
+	}
+}
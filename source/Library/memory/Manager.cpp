@@ -1,19 +1,302 @@
 #include "pch.h"
 #include "Manager.h"
+
+#include <bit>
 #include "Memory.h"
+#include "Pages.h"
+#include "Profiler.h"
 #include "LibMath.h"
 #include "Util.h"
 
 namespace Library::Memory
 {
+#pragma region HandleStore
+	Manager::HandleStore::~HandleStore() noexcept
+	{
+		for (Chunk* chunk : chunks)
+		{
+			delete chunk;
+		}
+		delete spare;
+	}
+
+	Manager::Handle& Manager::HandleStore::New(const Handle& handle) noexcept
+	{
+		if (chunks.empty() || chunks.back()->size == chunkSize) [[unlikely]]
+		{
+			chunks.push_back(NewChunk());
+		}
+		Chunk& chunk = *chunks.back();
+		Handle& ret = chunk.handles[chunk.size++];
+		ret = handle;
+		numHandles++;
+		return ret;
+	}
+
+	void Manager::HandleStore::Release(Handle& handle) noexcept
+	{
+		handle.ptr = nullptr;
+		numReleased++;
+		TrimBack();
+	}
+
+	void Manager::HandleStore::FreeReleasedChunks() noexcept
+	{
+		if (numReleased * 2 < numHandles)
+		{
+			return;
+		}
+		
+		numHandles = numReleased = 0;
+		std::erase_if(chunks, [this](Chunk* chunk)
+		{
+			const size_t released = std::count_if(chunk->handles.begin(), chunk->handles.begin() + chunk->size, IsReleased);
+			if (released == chunk->size)
+			{
+				FreeChunk(chunk);
+				return true;
+			}
+			numHandles += chunk->size;
+			numReleased += released;
+			return false;
+		});
+	}
+
+	Manager::HandleStore& Manager::HandleStore::Of(const void* handle) noexcept
+	{
+		return *reinterpret_cast<const Chunk*>(size_t(handle) & ~(chunkBytes - 1))->store;
+	}
+
+#pragma region helpers
+	bool Manager::HandleStore::IsReleased(const Handle& handle) noexcept
+	{
+		// Handles that are in use, or merely unused, always point somewhere in their Heap, and tombstoned ones at the tombstone
+		return handle.ptr == nullptr;
+	}
+
+	void Manager::HandleStore::TrimBack() noexcept
+	{
+		while (!chunks.empty())
+		{
+			Chunk& chunk = *chunks.back();
+			while (chunk.size && IsReleased(chunk.handles[chunk.size - 1]))
+			{
+				chunk.size--;
+				numHandles--;
+				numReleased--;
+			}
+			if (chunk.size)
+			{
+				return;
+			}
+			FreeChunk(&chunk);
+			chunks.pop_back();
+		}
+	}
+
+	Manager::HandleStore::Chunk* Manager::HandleStore::NewChunk() noexcept
+	{
+		if (spare)
+		{
+			return std::exchange(spare, nullptr);
+		}
+		return new Chunk{ this };
+	}
+
+	void Manager::HandleStore::FreeChunk(Chunk* chunk) noexcept
+	{
+		if (spare)
+		{
+			delete chunk;
+		}
+		else
+		{
+			chunk->size = 0;
+			spare = chunk;
+		}
+	}
+#pragma endregion
+#pragma endregion
+
+#pragma region HandleTable
+#pragma region iterator
+	Manager::HandleTable::iterator::iterator(HandleTable* owner, const size_t index) noexcept :
+		owner(owner),
+		index(index) {}
+
+	Manager::HandleTable::iterator& Manager::HandleTable::iterator::operator++() noexcept
+	{
+		++index;
+		SkipErased();
+		return *this;
+	}
+
+	Manager::HandleTable::iterator Manager::HandleTable::iterator::operator++(int) noexcept
+	{
+		iterator ret = *this;
+		operator++();
+		return ret;
+	}
+
+	Manager::HandleTable::iterator& Manager::HandleTable::iterator::operator--() noexcept
+	{
+		while (!owner->handles[--index]);
+		return *this;
+	}
+
+	Manager::HandleTable::iterator Manager::HandleTable::iterator::operator--(int) noexcept
+	{
+		iterator ret = *this;
+		operator--();
+		return ret;
+	}
+
+	Manager::HandleTable::iterator::reference Manager::HandleTable::iterator::operator*() const noexcept
+	{
+		return *owner->handles[index];
+	}
+
+	Manager::HandleTable::iterator::pointer Manager::HandleTable::iterator::operator->() const noexcept
+	{
+		return owner->handles[index];
+	}
+
+	bool Manager::HandleTable::iterator::operator==(const iterator& other) const noexcept
+	{
+		return owner == other.owner && index == other.index;
+	}
+
+	bool Manager::HandleTable::iterator::operator!=(const iterator& other) const noexcept
+	{
+		return !operator==(other);
+	}
+
+	void Manager::HandleTable::iterator::SkipErased() noexcept
+	{
+		while (index < owner->handles.size() && !owner->handles[index])
+		{
+			++index;
+		}
+	}
+#pragma endregion
+
+	Manager::HandleTable::HandleTable(HandleStore& store) noexcept :
+		store(store) {}
+
+#pragma region properties
+	bool Manager::HandleTable::IsEmpty() const noexcept
+	{
+		return size == 0;
+	}
+
+	size_t Manager::HandleTable::Size() const noexcept
+	{
+		return size;
+	}
+#pragma endregion
+
+	Manager::HandleTable::iterator Manager::HandleTable::begin() noexcept
+	{
+		iterator ret(this, 0);
+		ret.SkipErased();
+		return ret;
+	}
+
+	Manager::HandleTable::iterator Manager::HandleTable::end() noexcept
+	{
+		return iterator(this, handles.size());
+	}
+
+	Manager::Handle& Manager::HandleTable::Back() noexcept
+	{
+		assertm(!IsEmpty(), "HandleTable is empty");
+		// TrimBack makes sure the last Handle is never an erased one
+		return *handles.back();
+	}
+
+	Manager::Handle& Manager::HandleTable::PushBack(const Handle& handle) noexcept
+	{
+		Handle& ret = store.New(handle);
+		Append(ret);
+		return ret;
+	}
+
+	void Manager::HandleTable::Append(Handle& handle) noexcept
+	{
+		handles.push_back(&handle);
+		size++;
+	}
+
+	void Manager::HandleTable::PopBack() noexcept
+	{
+		assertm(!IsEmpty(), "HandleTable is empty");
+		Erase(iterator(this, handles.size() - 1));
+	}
+
+	void Manager::HandleTable::Erase(const iterator it) noexcept
+	{
+		Handle& handle = *it;
+		Extract(it);
+		store.Release(handle);
+	}
+
+	void Manager::HandleTable::Extract(const iterator it) noexcept
+	{
+		handles[it.index] = nullptr;
+		size--;
+		TrimBack();
+	}
+
+	void Manager::HandleTable::Replace(const iterator it, Handle& handle) noexcept
+	{
+		handles[it.index] = &handle;
+	}
+
+	void Manager::HandleTable::Splice(HandleTable& other) noexcept
+	{
+		assertm(&store == &other.store, "HandleTables belong to different Chains");
+		handles.insert(handles.end(), other.handles.begin(), other.handles.end());
+		size += other.size;
+		other.handles.clear();
+		other.size = 0;
+	}
+
+	void Manager::HandleTable::Compact() noexcept
+	{
+		std::erase(handles, nullptr);
+	}
+
+#pragma region helpers
+	void Manager::HandleTable::TrimBack() noexcept
+	{
+		while (!handles.empty() && !handles.back())
+		{
+			handles.pop_back();
+		}
+	}
+#pragma endregion
+#pragma endregion
+
 #pragma region Heap	
-	Manager::Heap::Heap(const size_t index) noexcept :
-		begin(Malloc<std::byte>(byteFactor << index)),
+	Manager::Heap::Heap(Chain& chain, const size_t index) noexcept :
+		handles(chain.handleStore),
+		mapped(canMapPages && chain.policy.mapHeaps && (byteFactor << index) >= minMappedBytes),
+		begin(mapped ? MapPages(byteFactor << index) : Malloc<std::byte>(byteFactor << index)),
 		end(begin + (byteFactor << index)),
 		top(begin),
-		index(index)
+		committed(begin),
+		index(index),
+		chain(chain)
 	{
+		assertm(index < std::numeric_limits<size_t>::digits, "too many Heaps for roomyHeaps");
 		DebugFill(begin, end);
+		Reindex();
+	}
+
+	Manager::Heap::~Heap() noexcept
+	{
+		Index(0);
+		FreeMemory(begin);
 	}
 
 #pragma region properties
@@ -35,14 +318,25 @@ namespace Library::Memory
 	Manager::Heap* Manager::Heap::Next() noexcept
 	{
 		const size_t next = index + 1;
-		return next < heaps.size() ? &heaps[next] : nullptr;
+		return next < chain.heaps.size() ? &chain.heaps[next] : nullptr;
+	}
+
+	bool Manager::Heap::IsFrozen() const noexcept
+	{
+		return chain.background.heap == this;
 	}
 #pragma endregion
 	
 	Manager::Handle* Manager::Heap::Alloc(const size_t numBytes, const size_t alignment) noexcept
 	{
+		if (Handle* ret = AllocFromFreeList(numBytes, alignment))
+		{
+			Reindex();
+			return ret;
+		}
+		
 		// calculate alignment offset
-		const size_t offset = size_t(top) % alignment;
+		const size_t offset = Padding(top, alignment);
 
 		// try to reserve bytes
 		if (CanFit(offset + numBytes))
@@ -51,89 +345,196 @@ namespace Library::Memory
 			// apply alignment offset
 			top += offset;
 			// this is our reserved address
-			handles.emplace_front(top, std::log2(alignment));
+			Handle& ret = handles.PushBack(Handle(top, std::log2(alignment)));
 			// reserve space
 			top += numBytes;
+			committed = std::max(committed, top);
 			// update max alignment
 			maxAlignment = std::max(maxAlignment, alignment);
+			Reindex();
 			// success
-			return &handles.front();
+			return &ret;
 		}
 
 		// failed to reserve
 		return nullptr;
 	}
 
+	void Manager::Heap::Sweep() noexcept
+	{
+		// a Defrag could erase Handles which are about to go into the free lists
+		CancelDefrag();
+		ShrinkToFit();
+		ClearFreeLists();
+		sweptAt = chain.Churn();
+
+		// each Handle's bytes end where the one above it begins
+		std::byte* upper = top;
+		for (auto it = handles.end(); it != handles.begin();)
+		{
+			Handle& handle = Bury(--it);
+			if (!handle.Used() && upper != handle.ptr)
+			{
+				const size_t numBytes = upper - handle.ptr;
+				const size_t sizeClass = std::bit_width(numBytes) - 1;
+				freeLists[sizeClass].push_back({ &handle, numBytes });
+				freeClasses |= size_t(1) << sizeClass;
+				DebugFill(handle.ptr, upper);
+			}
+			upper = handle.ptr;
+		}
+		Reindex();
+	}
+
+	bool Manager::Heap::ShouldSweep() const noexcept
+	{
+		return !handles.IsEmpty() && !IsFrozen() && chain.Churn() - sweptAt > handles.Size() / 2;
+	}
+
 	void Manager::Heap::ShrinkToFit() noexcept
 	{
-		while (!handles.empty() && !handles.front().Used())
+		// the top Handles may be in the free lists or part of a Defrag
+		if (!handles.IsEmpty() && (!handles.Back().Used() || handles.Back().Expired()))
 		{
-			DebugFill(handles.front().ptr, top);
-			top -= top - handles.front().ptr;
-			handles.pop_front();
+			ClearFreeLists();
+			CancelDefrag();
+		}
+		
+		while (!handles.IsEmpty() && !Bury(std::prev(handles.end())).Used())
+		{
+			DebugFill(handles.Back().ptr, top);
+			top = handles.Back().ptr;
+			handles.PopBack();
 			DebugDecCount();
 		}
+		Decommit();
+		Reindex();
 	}
 
 	void Manager::Heap::Defrag() noexcept
 	{
-		ShrinkToFit();
-		
-		if (handles.empty()) [[unlikely]]
+		CancelDefrag();
+		DefragStep(std::chrono::steady_clock::time_point::max());
+	}
+
+	bool Manager::Heap::DefragStep(const std::chrono::steady_clock::time_point deadline) noexcept
+	{
+		if (!IsDefragging())
 		{
-			return;
+			BeginDefrag();
+			if (!IsDefragging())
+			{
+				defraggedAt = chain.Churn();
+				return true;
+			}
 		}
 
-		// We're going to re-calculate this as we go.
-		// This is because the largest alignment required could have been freed.
-		maxAlignment = 1;
-
-		// keep in mind the list is in reverse order of allocation
-		// so next is the previous node but the next address
-		auto curr = handles.begin();
-		auto next = curr++;
-		while (curr != handles.end())
+		const auto start = std::chrono::steady_clock::now();
+		bool done = false;
+		do
 		{
-			if (!curr->Used()) [[unlikely]]
+			for (size_t i = 0; i < handlesPerCheck && !done; ++i)
 			{
-				// how big is this object
-				size_t byteCount = next->ptr - curr->ptr;
-
-				// shuffle memory
-				Memmove(curr->ptr, next->ptr, top - next->ptr);
-				DebugFill(top - byteCount, top);
-				
-				// adjust the top			
-				top -= byteCount;
-				maxAlignment = std::max(maxAlignment, next->Alignment());
-				const size_t offset = size_t(top) % maxAlignment;
-				top += offset;
-				byteCount -= offset;
-
-				// done with this handle
-				++curr;
-				handles.erase_after(next);
-				DebugDecCount();
+				const auto it = compaction.next++;
+				done = &*it == compaction.last;
+				Handle& handle = Bury(it);
+				// the bytes of this Handle end where the one above it begins
+				std::byte* const upper = done ? compaction.oldTop : compaction.next->ptr;
 
-				// update the handles
-				for (auto it = handles.begin(); it != curr; ++it)
+				if (handle.Used()) [[likely]]
 				{
-					it->ptr -= byteCount;
+					std::byte* const dest = compaction.dest + Padding(compaction.dest, handle.Alignment());
+					const size_t numBytes = upper - handle.ptr;
+					if (dest != handle.ptr)
+					{
+						Memmove(dest, handle.ptr, numBytes);
+						handle.ptr = dest;
+					}
+					compaction.dest = dest + numBytes;
+					compaction.maxAlignment = std::max(compaction.maxAlignment, handle.Alignment());
+				}
+				else if (!done)
+				{
+					handles.Erase(it);
+					DebugDecCount();
+				}
+				else
+				{
+					// Leave the highest one for ShrinkToFit.
+					// If anything was allocated since the Defrag began, it owns the reclaimed space until the next one.
+					handle.ptr = compaction.dest;
 				}
 			}
-			else [[likely]]
-			{
-				next = curr++;
-			}
+		} while (!done && std::chrono::steady_clock::now() < deadline);
+
+		if (!done)
+		{
+			defragTime += std::chrono::steady_clock::now() - start;
+			return false;
+		}
+
+		DebugFill(compaction.dest, compaction.oldTop);
+		if (top == compaction.oldTop)
+		{
+			// nothing was allocated in the meantime
+			top = compaction.dest;
+			maxAlignment = compaction.maxAlignment;
+		}
+		else
+		{
+			maxAlignment = std::max(maxAlignment, compaction.maxAlignment);
+		}
+		
+		if (const size_t numBytes = compaction.oldTop - begin)
+		{
+			const float survived = float(compaction.dest - begin) / numBytes;
+			survivalRate = numDefrags ? std::lerp(survivalRate, survived, chain.policy.survivalSmoothing) : survived;
 		}
+		numDefrags++;
+		
+		CancelDefrag();
+		handles.Compact();
+		chain.handleStore.FreeReleasedChunks();
+		ShrinkToFit();
+		defraggedAt = sweptAt = chain.Churn();
+		defragTime += std::chrono::steady_clock::now() - start;
+		return true;
+	}
+
+	bool Manager::Heap::ShouldDefrag() const noexcept
+	{
+		return !handles.IsEmpty() && !IsFrozen() && float(chain.Churn() - defraggedAt) > float(handles.Size()) * chain.policy.defragChurn;
+	}
+
+	bool Manager::Heap::IsDefragging() const noexcept
+	{
+		return compaction.last;
+	}
+
+	bool Manager::Heap::ShouldGraduate() const noexcept
+	{
+		const Policy& policy = chain.policy;
+		const size_t numBytes = top - begin;
+		const size_t next = index + 1;
+		return numDefrags
+			&& !IsDefragging()
+			&& !IsFrozen()
+			&& float(numBytes) >= float(TotalBytes()) * policy.graduateOccupancy
+			&& survivalRate >= policy.graduateSurvival
+			// only if the next Heap has room without having to Graduate too
+			&& next < chain.heaps.size()
+			&& !chain.heaps[next].IsFrozen()
+			&& chain.heaps[next].CanFit(numBytes + maxAlignment);
 	}
 
 	void Manager::Heap::Graduate() noexcept
 	{
-		if (handles.empty()) [[unlikely]]
+		if (handles.IsEmpty()) [[unlikely]]
 		{
 			return;
 		}
+		CancelDefrag();
+		const auto start = std::chrono::steady_clock::now();
 		
 		// Get the next Heap.
 		Heap* next = Next();
@@ -141,50 +542,39 @@ namespace Library::Memory
 		// If there isn't one, make one (acquiring more memory from the system).
 		if (!next) [[unlikely]]
 		{
-			next = &MakeHeap();
+			next = &chain.MakeHeap();
 		}
 
 		// figure out exactly how many bytes we need
 		const size_t numBytes = top - begin;
-		size_t offset = size_t(next->top) % maxAlignment;
+		// Our bytes must land somewhere with the same alignment as where they are now, at least up to maxAlignment.
+		const auto padding = [this](const std::byte* to) { return (size_t(begin) - size_t(to)) % maxAlignment; };
+		size_t offset = padding(next->top);
 		
 		// Next Heap is too full, it must Graduate too.
 		if (!next->CanFit(offset + numBytes))
 		{
 			next->Graduate();
-			offset = size_t(next->top) % maxAlignment;
+			offset = padding(next->top);
 		}
 		next->top += offset;
 
-		// The handles are in reverse-order of allocation. So the latest allocation is in the front.
-		// We need to iterate from back-to-front, so we need to reverse it before proceeding.
-		// This is an O(n) operation that could be mitigated by using a doubly-linked list (std::list).
-		// However that takes up an extra pointer per handle, which is undesired.
-		// Especially considering we would only need that functionality now during Graduation.
-		// Ideally, we'd be using a std::deque where we can control the individual sub-arrays.
-		handles.reverse();
-
 		// update the handles
-		std::byte* addr = next->top;
-		auto nextIt = handles.begin();
-		auto currIt = nextIt++;
-		while (nextIt != handles.end())
+		const ptrdiff_t distance = next->top - begin;
+		for (Handle& handle : handles)
 		{
-			const size_t byteWidth = nextIt->ptr - currIt->ptr;
-			currIt->ptr = addr;
-			addr += byteWidth;
-			currIt = nextIt++;
+			handle.ptr += distance;
 		}
-		currIt->ptr = addr;
 
 		// copy the memory
 		Memcpy(next->top, begin, numBytes);
 		next->top += numBytes;
+		next->committed = std::max(next->committed, next->top);
 		next->maxAlignment = std::max(next->maxAlignment, maxAlignment);
 		
 		// give up all of our handles
-		handles.reverse();
-		next->handles.splice_after(next->handles.before_begin(), handles);
+		next->handles.Splice(handles);
+		ClearFreeLists();
 #ifdef _DEBUG
 		next->count += count;
 		count = 0;
@@ -194,85 +584,544 @@ namespace Library::Memory
 		DebugFill(begin, top);
 		top = begin;
 		maxAlignment = 1;
+		numGraduations++;
+		Decommit();
+		Reindex();
+		next->Reindex();
+		graduateTime += std::chrono::steady_clock::now() - start;
 	}
 
-#pragma region helpers
-	void Manager::Heap::DebugFill([[maybe_unused]] std::byte* from, [[maybe_unused]] std::byte* to) noexcept
+	Manager::GenerationStats Manager::Heap::Stats() noexcept
 	{
-#ifdef _DEBUG
-		const size_t numBytes = to - from;
-		const size_t numWords = numBytes / 2;
-		Memset(from, uint16_t(0xF1EA), numWords);
-		if (numBytes % 2)
+		const size_t usedBytes = top - begin;
+		size_t numDeadHandles = 0;
+		size_t deadBytes = 0;
+
+		// each Handle's bytes end where the one above it begins
+		std::byte* upper = top;
+		for (auto it = handles.end(); it != handles.begin();)
 		{
-			*(to - 1) = std::byte(0xF1);
+			const Handle& handle = *--it;
+			if (!handle.Used() || handle.Expired())
+			{
+				numDeadHandles++;
+				deadBytes += upper - handle.ptr;
+			}
+			upper = handle.ptr;
 		}
-#endif
-	}
 
-	void Manager::Heap::DebugIncCount() noexcept
-	{
-#ifdef _DEBUG
-		count++;
-#endif
+		return
+		{
+			TotalBytes(),
+			usedBytes,
+			handles.Size(),
+			numDeadHandles,
+			deadBytes,
+			usedBytes ? float(deadBytes) / usedBytes : 0.f,
+			survivalRate,
+			numDefrags,
+			numGraduations,
+			defragTime,
+			graduateTime
+		};
 	}
 
-	void Manager::Heap::DebugDecCount() noexcept
+	void Manager::Heap::Measure(const Ranks& ranks, std::vector<Placement>& placements) noexcept
 	{
-#ifdef _DEBUG
-		if (--count == 0)
+		// each Handle's bytes end where the one above it begins
+		std::byte* upper = top;
+		for (auto it = handles.end(); it != handles.begin();)
 		{
-			assertm(top == begin, "memory leak");
+			Handle& handle = *--it;
+			if (handle.Used() && !handle.Expired())
+			{
+				if (const auto rank = ranks.find(&handle); rank != ranks.end())
+				{
+					placements[rank->second].handle = &handle;
+					placements[rank->second].numBytes = upper - handle.ptr;
+				}
+			}
+			upper = handle.ptr;
 		}
-#endif
 	}
-#pragma endregion
-#pragma endregion
 
-	bool Manager::IsEmpty() noexcept
+	void Manager::Heap::Evacuate(const Ranks& ranks, const std::vector<Placement>& placements, std::byte* const destination) noexcept
 	{
-		return Util::AllOf(heaps, [](const Heap& heap) { return heap.IsEmpty(); });
-	}
+		CancelDefrag();
+		ClearFreeLists();
+		const auto start = std::chrono::steady_clock::now();
 
-	size_t Manager::TotalBytes() noexcept
-	{
-		return Util::Accumulate(heaps, 0, [](const size_t a, const Heap& h) { return a + h.TotalBytes(); });
-	}
-	
-	Manager::Handle& Manager::Alloc(const size_t numBytes, const size_t alignment) noexcept
-	{		
-		for (Heap& heap : heaps)
+		std::byte* dest = begin;
+		size_t newMaxAlignment = 1;
+		size_t evacuatedBytes = 0;
+		const size_t oldBytes = top - begin;
+
+		bool done = handles.IsEmpty();
+		for (auto it = handles.begin(); !done;)
 		{
-			if (Handle* ret = heap.Alloc(numBytes, alignment))
+			const auto current = it++;
+			done = it == handles.end();
+			Handle& handle = *current;
+			// the bytes of this Handle end where the one above it begins
+			std::byte* const upper = done ? top : it->ptr;
+			const size_t numBytes = upper - handle.ptr;
+
+			// Checked before Used since the last reference may have been dropped by another thread since Measure.
+			if (const auto rank = ranks.find(&handle); rank != ranks.end() && placements[rank->second].handle == &handle)
 			{
-				return *ret;
+				const Placement& placement = placements[rank->second];
+				Memcpy(destination + placement.offset, handle.ptr, placement.numBytes);
+				handles.Extract(current);
+				DebugDecCount();
+				evacuatedBytes += numBytes;
 			}
-		}
-		
-		for EVER
-		{
-			if (Handle* ret = MakeHeap().Alloc(numBytes, alignment))
+			else if (!Bury(current).Used())
 			{
-				return *ret;
+				handles.Erase(current);
+				DebugDecCount();
+			}
+			else
+			{
+				std::byte* const to = dest + Padding(dest, handle.Alignment());
+				if (to != handle.ptr)
+				{
+					Memmove(to, handle.ptr, numBytes);
+					handle.ptr = to;
+				}
+				dest = to + numBytes;
+				newMaxAlignment = std::max(newMaxAlignment, handle.Alignment());
 			}
 		}
-	}
 
-	void Manager::Defrag() noexcept
-	{
-		for (Heap& heap : heaps)
+		DebugFill(dest, top);
+		top = dest;
+		maxAlignment = newMaxAlignment;
+		Reindex();
+		if (oldBytes)
 		{
-			heap.Defrag();
+			// evacuated objects survived, they just live somewhere else now
+			const float survived = float(top - begin + evacuatedBytes) / oldBytes;
+			survivalRate = numDefrags ? std::lerp(survivalRate, survived, chain.policy.survivalSmoothing) : survived;
 		}
+		numDefrags++;
+
+		handles.Compact();
+		defraggedAt = sweptAt = chain.Churn();
+		defragTime += std::chrono::steady_clock::now() - start;
 	}
 
-	void Manager::Graduate() noexcept
+	void Manager::Heap::Append(const std::vector<Placement>& placements, const std::byte* const source, const size_t numBytes, const size_t alignment) noexcept
 	{
-		heaps.front().Graduate();
+		assertm(CanFit(Padding(top, alignment) + numBytes), "Heap is too full to Append");
+		CancelDefrag();
+		ClearFreeLists();
+
+		// any padding gets attributed to the Handle below, just like Alloc
+		top += Padding(top, alignment);
+		Memcpy(top, source, numBytes);
+		for (const Placement& placement : placements)
+		{
+			if (placement.handle)
+			{
+				placement.handle->ptr = top + placement.offset;
+				handles.Append(*placement.handle);
+				DebugIncCount();
+			}
+		}
+		top += numBytes;
+		committed = std::max(committed, top);
+		maxAlignment = std::max(maxAlignment, alignment);
+		Reindex();
 	}
 
-	void Manager::ShrinkToFit() noexcept
+#pragma region helpers
+	Manager::Handle* Manager::Heap::AllocFromFreeList(const size_t numBytes, const size_t alignment) noexcept
+	{
+		// smallest size class guaranteed to fit numBytes
+		const size_t sizeClass = std::bit_width(numBytes - 1);
+		if (sizeClass >= numSizeClasses)
+		{
+			return nullptr;
+		}
+		
+		const size_t candidates = freeClasses >> sizeClass << sizeClass;
+		if (!candidates)
+		{
+			return nullptr;
+		}
+
+		const size_t bestClass = std::countr_zero(candidates);
+		std::vector<Hole>& freeList = freeLists[bestClass];
+		const auto [handle, holeBytes] = freeList.back();
+		
+		// Any padding gets attributed to the Handle below this one, just like when reserving from the top.
+		const size_t offset = Padding(handle->ptr, alignment);
+		if (offset + numBytes > holeBytes)
+		{
+			return nullptr;
+		}
+
+		freeList.pop_back();
+		if (freeList.empty())
+		{
+			freeClasses &= ~(size_t(1) << bestClass);
+		}
+
+		*handle = Handle(handle->ptr + offset, std::log2(alignment));
+		maxAlignment = std::max(maxAlignment, alignment);
+		return handle;
+	}
+
+	void Manager::Heap::BeginDefrag() noexcept
+	{
+		ShrinkToFit();
+		ClearFreeLists();
+		if (handles.IsEmpty())
+		{
+			return;
+		}
+		
+		compaction.next = handles.begin();
+		compaction.last = &handles.Back();
+		compaction.dest = begin;
+		compaction.oldTop = top;
+		compaction.maxAlignment = 1;
+	}
+
+	void Manager::Heap::CancelDefrag() noexcept
+	{
+		compaction.last = nullptr;
+	}
+
+	void Manager::Heap::Decommit() noexcept
+	{
+#ifndef _DEBUG
+		// in debug builds unused bytes must keep DebugFill's pattern, which decommitting would zero out
+		if (mapped && size_t(committed - top) >= minMappedBytes)
+		{
+			DecommitPages(top, committed);
+			committed = top;
+		}
+#endif
+	}
+
+	void Manager::Heap::ClearFreeLists() noexcept
+	{
+		while (freeClasses)
+		{
+			const size_t sizeClass = std::countr_zero(freeClasses);
+			freeLists[sizeClass].clear();
+			freeClasses &= freeClasses - 1;
+		}
+		Reindex();
+	}
+
+	void Manager::Heap::Reindex() noexcept
+	{
+		// CanFit needs top to stay below end
+		const size_t topBytes = top < end ? end - top - 1 : 0;
+		// every hole in freeLists[i] has at least `1 << i` bytes
+		const size_t holeBytes = freeClasses ? std::bit_floor(freeClasses) : 0;
+		// nothing may be allocated from a frozen Heap
+		Index(IsFrozen() ? 0 : std::bit_width(std::max(topBytes, holeBytes)));
+	}
+
+	void Manager::Heap::Index(const size_t numClasses) noexcept
+	{
+		const size_t bit = size_t(1) << index;
+		for (; numRoomyClasses < numClasses; ++numRoomyClasses)
+		{
+			chain.roomyHeaps[numRoomyClasses] |= bit;
+		}
+		while (numRoomyClasses > numClasses)
+		{
+			chain.roomyHeaps[--numRoomyClasses] &= ~bit;
+		}
+	}
+
+	Manager::Handle& Manager::Heap::Bury(const HandleTable::iterator it) noexcept
+	{
+		Handle& handle = *it;
+		if (!handle.Expired()) [[likely]]
+		{
+			return handle;
+		}
+		// same address, so the bytes above it are still attributed to this spot in the table
+		Handle& hole = chain.handleStore.New(Handle(handle.ptr, handle.weakCountAndAlignment & (Handle::touchedBit - 1)));
+		handles.Replace(it, hole);
+		chain.Entomb(handle);
+		return hole;
+	}
+
+	size_t Manager::Heap::Padding(const std::byte* ptr, const size_t alignment) noexcept
+	{
+		return (alignment - size_t(ptr) % alignment) % alignment;
+	}
+
+	void Manager::Heap::DebugFill([[maybe_unused]] std::byte* from, [[maybe_unused]] std::byte* to) noexcept
+	{
+#ifdef _DEBUG
+		Fill(from, uint16_t(0xF1EA), to - from);
+#endif
+	}
+
+	void Manager::Heap::FreeMemory(std::byte* memory) noexcept
+	{
+		if (mapped)
+		{
+			UnmapPages(memory, TotalBytes());
+		}
+		else
+		{
+			Free(memory);
+		}
+	}
+
+	void Manager::Heap::DebugIncCount() noexcept
+	{
+#ifdef _DEBUG
+		count++;
+#endif
+	}
+
+	void Manager::Heap::DebugDecCount() noexcept
+	{
+#ifdef _DEBUG
+		if (--count == 0)
+		{
+			assertm(top == begin, "memory leak");
+		}
+#endif
+	}
+#pragma endregion
+#pragma endregion
+
+#pragma region Chain
+	Manager::Chain::Chain() noexcept
+	{
+		heaps.emplace_back(*this, 0);
+		heaps.emplace_back(*this, 1);
+	}
+
+	Manager::Chain::~Chain() noexcept
+	{
+		FinishBackgroundDefrag();
+	}
+
+	bool Manager::Chain::IsEmpty() const noexcept
+	{
+		return pinned.empty() && tombstones.empty() && Util::AllOf(heaps, [](const Heap& heap) { return heap.IsEmpty(); });
+	}
+
+	size_t Manager::Chain::TotalBytes() const noexcept
+	{
+		return Util::Accumulate(heaps, size_t(0), [](const size_t a, const Heap& h) { return a + h.TotalBytes(); });
+	}
+
+	size_t Manager::Chain::Churn() const noexcept
+	{
+		return churn + handleStore.numFreed.load(std::memory_order_relaxed);
+	}
+
+	Manager::Handle& Manager::Chain::Alloc(const size_t numBytes, const size_t alignment) noexcept
 	{
+		churn++;
+		allocationStats.sizes[std::bit_width(numBytes)]++;
+		allocationStats.alignments[std::countr_zero(alignment)]++;
+		allocationStats.numAllocations++;
+		
+		// Youngest first, skipping every Heap without room for at least the highest power of 2 in numBytes.
+		// The rest may still be too full once alignment is taken into account.
+		const size_t sizeClass = numBytes ? std::bit_width(numBytes) - 1 : 0;
+		for (size_t candidates = roomyHeaps[sizeClass]; candidates; candidates &= candidates - 1)
+		{
+			if (Handle* ret = heaps[std::countr_zero(candidates)].Alloc(numBytes, alignment))
+			{
+				return *ret;
+			}
+		}
+
+		// Every Heap is full.
+		// Before asking the system for more memory, see if any of them have holes that were freed since they were last swept.
+		for (Heap& heap : heaps)
+		{
+			if (heap.ShouldSweep())
+			{
+				heap.Sweep();
+				if (Handle* ret = heap.Alloc(numBytes, alignment))
+				{
+					return *ret;
+				}
+			}
+		}
+		
+		for EVER
+		{
+			if (Handle* ret = MakeHeap().Alloc(numBytes, alignment))
+			{
+				return *ret;
+			}
+		}
+	}
+
+	Manager::Handle& Manager::Chain::AllocPinned(const size_t numBytes, const size_t alignment) noexcept
+	{
+		assertm(alignment <= alignof(std::max_align_t), "Malloc can't satisfy over-aligned pinned allocations");
+		churn++;
+		allocationStats.sizes[std::bit_width(numBytes)]++;
+		allocationStats.alignments[std::countr_zero(alignment)]++;
+		allocationStats.numAllocations++;
+
+		// never nullptr, since that would read as released
+		Handle& ret = handleStore.New(Handle(Malloc<std::byte>(std::max(numBytes, size_t(1))), std::log2(alignment)));
+		pinned.push_back(&ret);
+		return ret;
+	}
+
+	void Manager::Chain::Defrag() noexcept
+	{
+		FinishBackgroundDefrag();
+		SweepPinned();
+		SweepTombstones();
+		for (Heap& heap : heaps)
+		{
+			heap.Defrag();
+		}
+		defragIndex = 0;
+	}
+
+	void Manager::Chain::Defrag(const Layout& layout) noexcept
+	{
+		FinishBackgroundDefrag();
+
+		// where each object first appears in layout
+		Ranks ranks{};
+		ranks.reserve(layout.handles.size());
+		for (const Handle* handle : layout.handles)
+		{
+			ranks.try_emplace(handle, ranks.size());
+		}
+
+		// Find every object in layout which lives in this Chain, and how big it is.
+		// Anything not found stays nullptr and is skipped.
+		std::vector<Placement> placements(ranks.size());
+		for (Heap& heap : heaps)
+		{
+			heap.ShrinkToFit();
+			heap.Measure(ranks, placements);
+		}
+
+		// lay them out one after another, relative to an address aligned to all of them
+		size_t numBytes = 0;
+		size_t alignment = 1;
+		for (Placement& placement : placements)
+		{
+			if (placement.handle)
+			{
+				const size_t align = placement.handle->Alignment();
+				numBytes += (align - numBytes % align) % align;
+				placement.offset = numBytes;
+				numBytes += placement.numBytes;
+				alignment = std::max(alignment, align);
+			}
+		}
+
+		// Objects may move to and from any Heap, so stage them somewhere none of them can overlap.
+		std::byte* buffer = Malloc<std::byte>(numBytes + alignment);
+		std::byte* const staging = buffer + Heap::Padding(buffer, alignment);
+		for (Heap& heap : heaps)
+		{
+			heap.Evacuate(ranks, placements, staging);
+		}
+
+		// They're expected to stick around, so they go in the oldest Heap.
+		Heap* dest = &heaps.back();
+		while (!dest->CanFit(Heap::Padding(dest->top, alignment) + numBytes))
+		{
+			dest = &MakeHeap();
+		}
+		dest->Append(placements, staging, numBytes, alignment);
+		Free(buffer);
+
+		handleStore.FreeReleasedChunks();
+		defragIndex = 0;
+	}
+
+	bool Manager::Chain::DefragStep(const std::chrono::steady_clock::time_point deadline) noexcept
+	{
+		for (bool first = true; defragIndex < heaps.size(); ++defragIndex)
+		{
+			Heap& heap = heaps[defragIndex];
+			if (!heap.IsDefragging() && !heap.ShouldDefrag())
+			{
+				continue;
+			}
+			
+			// only start on another Heap if there's time left, but always do something
+			if (!first && std::chrono::steady_clock::now() >= deadline)
+			{
+				return false;
+			}
+			first = false;
+
+			// big Heaps which haven't started a DefragStep are handed off instead, one at a time, unless other threads may touch them meanwhile
+			if (policy.defragInBackground && !numSharers && heap.TotalBytes() >= Heap::minBackgroundBytes && !heap.IsDefragging())
+			{
+				if (!background.heap)
+				{
+					BeginBackgroundDefrag(heap);
+				}
+				continue;
+			}
+			
+			if (!heap.DefragStep(deadline))
+			{
+				return false;
+			}
+		}
+		defragIndex = 0;
+		return !background.heap;
+	}
+
+	void Manager::Chain::Collect(const std::chrono::steady_clock::time_point deadline) noexcept
+	{
+		SweepPinned();
+		SweepTombstones();
+		// other threads may be dereferencing this Chain's objects, so they have to stay where they are
+		if (numSharers)
+		{
+			return;
+		}
+		// only if it won't have to wait
+		if (background.copied.load(std::memory_order_acquire))
+		{
+			FinishBackgroundDefrag();
+		}
+		DefragStep(deadline);
+
+		// Oldest first, so each generation makes room before the one below it moves in.
+		// The nursery is small enough that it may always Graduate.
+		for (size_t i = heaps.size() - 1; i-- > 0;)
+		{
+			Heap& heap = heaps[i];
+			if (heap.ShouldGraduate() && (i == 0 || std::chrono::steady_clock::now() < deadline))
+			{
+				heap.Graduate();
+			}
+		}
+	}
+
+	void Manager::Chain::Graduate() noexcept
+	{
+		FinishBackgroundDefrag();
+		heaps.front().Graduate();
+	}
+
+	void Manager::Chain::ShrinkToFit() noexcept
+	{
+		FinishBackgroundDefrag();
+		SweepPinned();
+		SweepTombstones();
 		for (Heap& heap : heaps)
 		{
 			heap.ShrinkToFit();
@@ -283,8 +1132,393 @@ namespace Library::Memory
 		}
 	}
 
-	Manager::Heap& Manager::MakeHeap() noexcept
+	Manager::Heap& Manager::Chain::MakeHeap() noexcept
+	{
+		return heaps.emplace_back(*this, heaps.size());
+	}
+
+	void Manager::Chain::SweepPinned() noexcept
+	{
+		std::erase_if(pinned, [this](Handle* handle)
+		{
+			if (handle->Used() && !handle->Expired())
+			{
+				return false;
+			}
+			Free(handle->ptr);
+			if (handle->Expired())
+			{
+				Entomb(*handle);
+			}
+			else
+			{
+				handleStore.Release(*handle);
+			}
+			return true;
+		});
+	}
+
+	void Manager::Chain::Entomb(Handle& handle) noexcept
+	{
+		handle.ptr = &tombstone;
+		tombstones.push_back(&handle);
+	}
+
+	void Manager::Chain::SweepTombstones() noexcept
+	{
+		std::erase_if(tombstones, [this](Handle* handle)
+		{
+			if (handle->Used())
+			{
+				return false;
+			}
+			handleStore.Release(*handle);
+			return true;
+		});
+	}
+
+	void Manager::Chain::BeginBackgroundDefrag(Heap& heap) noexcept
+	{
+		assertm(!background.heap, "a background Defrag is already in progress");
+		assertm(!numSharers, "other threads may dereference this Chain's objects without marking them");
+		heap.CancelDefrag();
+		heap.ShrinkToFit();
+		heap.ClearFreeLists();
+		background.heap = &heap;
+		background.copied.store(false, std::memory_order_relaxed);
+		heap.Reindex();
+
+		// each Handle's bytes end where the one above it begins
+		background.totalBytes = heap.TotalBytes();
+		bool done = heap.handles.IsEmpty();
+		for (auto it = heap.handles.begin(); !done;)
+		{
+			Handle& handle = *it++;
+			done = it == heap.handles.end();
+			// Objects can't come back to life, so only live ones need copying.
+			if (std::atomic_ref(handle.sharedCount).load(std::memory_order_acquire))
+			{
+				std::byte* const upper = done ? heap.top : it->ptr;
+				background.sources.push_back({ &handle, handle.ptr, size_t(upper - handle.ptr), handle.Alignment() });
+			}
+		}
+
+		// From here on, anything dereferenced may be written to while it's being copied.
+		// Only this thread may dereference this Chain's objects until then, so relaxed is enough, see Memory::MayTouch.
+		numBackgroundDefrags.fetch_add(1, std::memory_order_relaxed);
+		handleStore.inBackgroundDefrag.store(true, std::memory_order_relaxed);
+		background.thread = std::thread([this] { CopyInBackground(); });
+	}
+
+	void Manager::Chain::FinishBackgroundDefrag() noexcept
+	{
+		if (!background.heap)
+		{
+			return;
+		}
+		const auto start = std::chrono::steady_clock::now();
+		background.thread.join();
+		numBackgroundDefrags.fetch_sub(1, std::memory_order_relaxed);
+		handleStore.inBackgroundDefrag.store(false, std::memory_order_relaxed);
+		background.sources.clear();
+
+		Heap& heap = *background.heap;
+		background.heap = nullptr;
+		if (!background.memory) [[unlikely]]
+		{
+			heap.Reindex();
+			return;
+		}
+
+		const size_t oldBytes = heap.top - heap.begin;
+		auto copy = background.copies.begin();
+		bool done = heap.handles.IsEmpty();
+		for (auto it = heap.handles.begin(); !done;)
+		{
+			const auto current = it++;
+			done = it == heap.handles.end();
+			Handle& handle = *current;
+
+			if (copy != background.copies.end() && copy->handle == &handle)
+			{
+				// The object may have changed since it was copied, or even been destroyed, in which case it's just another unused Handle.
+				if (std::atomic_ref(handle.weakCountAndAlignment).fetch_and(~Handle::touchedBit, std::memory_order_relaxed) & Handle::touchedBit)
+				{
+					Memcpy(copy->ptr, handle.ptr, copy->numBytes);
+				}
+				handle.ptr = copy->ptr;
+				++copy;
+			}
+			else
+			{
+				// Already unused when copying began, so it was left behind.
+				if (handle.Expired())
+				{
+					heap.handles.Extract(current);
+					Entomb(handle);
+				}
+				else
+				{
+					heap.handles.Erase(current);
+				}
+				heap.DebugDecCount();
+			}
+		}
+
+		heap.FreeMemory(heap.begin);
+		heap.begin = background.memory;
+		heap.end = heap.begin + heap.TotalBytes();
+		heap.top = heap.committed = background.top;
+		heap.maxAlignment = background.maxAlignment;
+		background.memory = nullptr;
+		background.copies.clear();
+
+		if (oldBytes)
+		{
+			const float survived = float(heap.top - heap.begin) / oldBytes;
+			heap.survivalRate = heap.numDefrags ? std::lerp(heap.survivalRate, survived, policy.survivalSmoothing) : survived;
+		}
+		heap.numDefrags++;
+		heap.handles.Compact();
+		heap.defraggedAt = heap.sweptAt = Churn();
+		heap.Reindex();
+		handleStore.FreeReleasedChunks();
+		heap.defragTime += std::chrono::steady_clock::now() - start;
+	}
+
+	void Manager::Chain::CopyInBackground() noexcept
+	{
+		// the frozen Heap's bookkeeping doesn't change until FinishBackgroundDefrag, only its objects may
+		Heap& heap = *background.heap;
+		const size_t totalBytes = background.totalBytes;
+		std::byte* const memory = heap.mapped ? MapPages(totalBytes) : Malloc<std::byte>(totalBytes);
+		std::byte* dest = memory;
+		size_t maxAlignment = 1;
+
+		for (const BackgroundDefrag::Source& source : background.sources)
+		{
+			// Destroyed since copying began, possibly by another thread, so there's no need to copy it.
+			// One may still be destroyed at any moment, FinishBackgroundDefrag deals with that.
+			if (!std::atomic_ref(source.handle->sharedCount).load(std::memory_order_acquire))
+			{
+				continue;
+			}
+			std::byte* const to = dest + Heap::Padding(dest, source.alignment);
+			// only possible if memory is aligned differently than the Heap's was, see Graduate
+			if (to + source.numBytes > memory + totalBytes) [[unlikely]]
+			{
+				heap.FreeMemory(memory);
+				background.memory = nullptr;
+				background.copies.clear();
+				background.copied.store(true, std::memory_order_release);
+				return;
+			}
+			Memcpy(to, source.ptr, source.numBytes);
+			background.copies.push_back({ source.handle, to, source.numBytes });
+			dest = to + source.numBytes;
+			maxAlignment = std::max(maxAlignment, source.alignment);
+		}
+
+		heap.DebugFill(dest, memory + totalBytes);
+		background.memory = memory;
+		background.top = dest;
+		background.maxAlignment = maxAlignment;
+		background.copied.store(true, std::memory_order_release);
+	}
+#pragma endregion
+
+#pragma region ThreadChain
+	Manager::ThreadChain::ThreadChain() noexcept
+	{
+		localChain = new Chain();
+	}
+
+	Manager::ThreadChain::~ThreadChain() noexcept
+	{
+		Chain* const chain = localChain;
+		chain->ShrinkToFit();
+		localChain = nullptr;
+		if (chain->IsEmpty())
+		{
+			delete chain;
+		}
+		else
+		{
+			// Other threads still reference this memory, so leave it for CollectOrphans.
+			std::scoped_lock lock(orphansMutex);
+			orphans.push_back(chain);
+		}
+	}
+#pragma endregion
+
+	bool Manager::IsEmpty() noexcept
+	{
+		return LocalChain().IsEmpty();
+	}
+
+	size_t Manager::TotalBytes() noexcept
+	{
+		return LocalChain().TotalBytes();
+	}
+	
+	size_t Manager::OrphanedBytes() noexcept
+	{
+		std::scoped_lock lock(orphansMutex);
+		return Util::Accumulate(orphans, size_t(0), [](const size_t a, const Chain* chain) { return a + chain->TotalBytes(); });
+	}
+
+	const Manager::Policy& Manager::GetPolicy() noexcept
+	{
+		return LocalChain().policy;
+	}
+
+	void Manager::SetPolicy(const Policy& policy) noexcept
+	{
+		LocalChain().policy = policy;
+	}
+
+	std::vector<Manager::GenerationStats> Manager::GetGenerationStats() noexcept
+	{
+		Chain& chain = LocalChain();
+		std::vector<GenerationStats> ret{};
+		ret.reserve(chain.heaps.size());
+		for (Heap& heap : chain.heaps)
+		{
+			ret.push_back(heap.Stats());
+		}
+		return ret;
+	}
+
+	const Manager::AllocationStats& Manager::GetAllocationStats() noexcept
+	{
+		return LocalChain().allocationStats;
+	}
+
+	void Manager::ResetAllocationStats() noexcept
+	{
+		LocalChain().allocationStats = {};
+	}
+	
+	Manager::Handle& Manager::Alloc(const size_t numBytes, const size_t alignment) noexcept
+	{
+		Handle& ret = LocalChain().Alloc(numBytes, alignment);
+		// keyed by Handle rather than by address since Defrag moves objects around
+		Profiler::OnAlloc(Profiler::Source::Manager, reinterpret_cast<std::uintptr_t>(&ret), numBytes);
+		return ret;
+	}
+
+	Manager::Handle& Manager::AllocPinned(const size_t numBytes, const size_t alignment) noexcept
+	{
+		Handle& ret = LocalChain().AllocPinned(numBytes, alignment);
+		Profiler::OnAlloc(Profiler::Source::Manager, reinterpret_cast<std::uintptr_t>(&ret), numBytes);
+		return ret;
+	}
+
+	void Manager::NotifyFreed(const void* handle) noexcept
+	{
+		Profiler::OnFree(Profiler::Source::Manager, reinterpret_cast<std::uintptr_t>(handle));
+		// Counted by the Chain which owns the Handle, since that's the one which can reclaim it.
+		HandleStore::Of(handle).numFreed.fetch_add(1, std::memory_order_relaxed);
+		// The calling thread may be exiting, with its Chain already gone.
+		if (Chain* chain = localChain)
+		{
+			chain->allocationStats.numFrees++;
+		}
+	}
+
+	void Manager::Defrag() noexcept
+	{
+		LocalChain().Defrag();
+	}
+
+	void Manager::Defrag(const Layout& layout) noexcept
+	{
+		LocalChain().Defrag(layout);
+	}
+
+	bool Manager::DefragStep(const std::chrono::nanoseconds budget) noexcept
+	{
+		return LocalChain().DefragStep(std::chrono::steady_clock::now() + budget);
+	}
+
+	void Manager::Collect(const std::chrono::nanoseconds budget) noexcept
+	{
+		Chain& chain = LocalChain();
+		chain.Collect(std::chrono::steady_clock::now() + budget);
+
+		const size_t interval = chain.policy.shrinkInterval;
+		if (interval && ++chain.numCollects % interval == 0)
+		{
+			ShrinkToFit();
+		}
+	}
+
+	void Manager::Share() noexcept
+	{
+		Chain& chain = LocalChain();
+		// anything the other threads write from here on has to land in the memory that's kept
+		chain.FinishBackgroundDefrag();
+		chain.numSharers++;
+	}
+
+	void Manager::Unshare() noexcept
+	{
+		Chain& chain = LocalChain();
+		assertm(chain.numSharers, "Unshare without a matching Share");
+		chain.numSharers--;
+	}
+
+	void Manager::Graduate() noexcept
+	{
+		LocalChain().Graduate();
+	}
+
+	void Manager::ShrinkToFit() noexcept
+	{
+		LocalChain().ShrinkToFit();
+		CollectOrphans();
+	}
+
+	Manager::Chain& Manager::LocalChain() noexcept
+	{
+		if (!localChain) [[unlikely]]
+		{
+			NewLocalChain();
+		}
+		return *localChain;
+	}
+
+	void Manager::NewLocalChain() noexcept
+	{
+		// threadChain is only ever constructed once per thread
+		static_cast<void>(threadChain);
+		if (!localChain)
+		{
+			// So this is a destructor running after threadChain's, which gets a Chain of its own that's orphaned in turn.
+			static thread_local ThreadChain lateThreadChain{};
+		}
+		assertm(localChain, "Memory::Manager used by a thread_local or static destroyed after both of the thread's Chains");
+	}
+
+	void Manager::CollectOrphans() noexcept
+	{
+		std::scoped_lock lock(orphansMutex);
+		std::erase_if(orphans, [](Chain* chain)
+		{
+			chain->ShrinkToFit();
+			if (chain->IsEmpty())
+			{
+				delete chain;
+				return true;
+			}
+			return false;
+		});
+	}
+
+	bool MayTouch(const void* handle) noexcept
 	{
-		return heaps.emplace_back(heaps.size());
+		const Manager::HandleStore& store = Manager::HandleStore::Of(handle);
+		return !store.inBackgroundDefrag.load(std::memory_order_relaxed)
+			|| (Manager::localChain && &Manager::localChain->handleStore == &store);
 	}
 }
@@ -1,6 +1,14 @@
 #pragma once
+#include <array>
+#include <atomic>
+#include <chrono>
 #include <deque>
-#include <forward_list>
+#include <iterator>
+#include <limits>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
 #include "Macros.h"
 #include "SmartPtr.h"
@@ -9,31 +17,377 @@ namespace Library::Memory
 {
 	/**
 	 * Memory Manager used by SmartPtr 
+	 *
+	 * Every thread allocates from its own Chain of Heaps, so Alloc never needs to synchronize.
+	 * Handles may be freed from any thread, the memory behind them is reclaimed by the thread which owns the Chain.
 	 */
 	class Manager final
 	{
+	public:
+		/**
+		 * Thresholds which decide what Collect does with each of a thread's Heaps.
+		 * Heap 0 is the nursery where everything is first allocated, each Heap after it is an older generation.
+		 */
+		struct Policy final
+		{
+			/**
+			 * A Heap is Defragged once the number of allocations and frees since its last Defrag reaches this fraction of its Handles.
+			 */
+			float defragChurn{ 0.5f };
+			/**
+			 * A Heap Graduates into the next once it's at least this full...
+			 */
+			float graduateOccupancy{ 0.5f };
+			/**
+			 * ...and at least this fraction of its bytes have been surviving its Defrags.
+			 * Otherwise Defragging is what frees up space, so there's no point in moving anything.
+			 */
+			float graduateSurvival{ 0.75f };
+			/**
+			 * How much the latest Defrag counts towards a Heap's running survival rate, the rest is its history.
+			 */
+			float survivalSmoothing{ 0.25f };
+			/**
+			 * Empty Heaps are given back to the system every this many Collects.
+			 * 0 means never.
+			 */
+			size_t shrinkInterval{ 60 };
+			/**
+			 * Whether Heaps created from now on map their memory straight from the OS instead of using Malloc.
+			 * Mapped Heaps give the unused pages at their top back to the OS whenever they shrink.
+			 * Only applies to big enough Heaps, and only where Memory::canMapPages.
+			 */
+			bool mapHeaps{ true };
+			/**
+			 * Whether big Heaps are Defragged on another thread rather than by DefragStep.
+			 * Their live objects are copied to new memory while this thread keeps running, then a later Collect moves them over.
+			 * Objects dereferenced in the meantime are copied again at that point, so raw pointers must not be written through across a Collect.
+			 * While copying, every dereference on every thread must mark its object as touched, which makes them a little slower.
+			 * Meanwhile the Chain's objects must only be dereferenced by its own thread, since another could miss that copying has begun.
+			 * So none is started while the Chain is shared, see Share, and Memory::MayTouch asserts the rest.
+			 */
+			bool defragInBackground{ false };
+		};
+
+		/**
+		 * A snapshot of one Heap, see GetGenerationStats.
+		 */
+		struct GenerationStats final
+		{
+			size_t capacity;
+			// Bytes between the bottom and top of the Heap, some of which may be unused.
+			size_t usedBytes;
+			size_t numHandles;
+			// How many of those Handles are no longer referenced but still hold on to bytes.
+			size_t numDeadHandles;
+			// Bytes below the top which a Defrag or Sweep could reclaim.
+			size_t deadBytes;
+			// deadBytes / usedBytes, 0 when the Heap is empty.
+			float fragmentation;
+			// Running fraction of bytes which survive a Defrag.
+			float survivalRate;
+			size_t numDefrags;
+			size_t numGraduations;
+			// Total time spent in DefragStep on this Heap.
+			std::chrono::nanoseconds defragTime;
+			// Total time spent Graduating this Heap, including any Graduating of older Heaps it caused.
+			std::chrono::nanoseconds graduateTime;
+		};
+
+		/**
+		 * Running histograms of the calling thread's allocations, see GetAllocationStats.
+		 */
+		struct AllocationStats final
+		{
+			// sizes[i] counts allocations of at least `1 << (i - 1)` and less than `1 << i` bytes, sizes[0] counts empty ones.
+			std::array<size_t, std::numeric_limits<size_t>::digits + 1> sizes{};
+			// alignments[i] counts allocations aligned to `1 << i` bytes.
+			std::array<size_t, std::numeric_limits<size_t>::digits> alignments{};
+			size_t numAllocations{ 0 };
+			// Objects destroyed on this thread, no matter which thread allocated them.
+			size_t numFrees{ 0 };
+		};
+
+		/**
+		 * The order in which objects are used, such as the order some tree of them is traversed in every frame.
+		 * Given to Defrag so it can put them next to each other.
+		 */
+		class Layout final
+		{
+			friend Manager;
+
+			std::vector<SmartPtr<std::byte>::Handle*> handles{};
+
+		public:
+			/**
+			 * O(1)
+			 *
+			 * Adds an object after every one already in this Layout.
+			 * Does nothing if ptr is null.
+			 */
+			template<typename T>
+			void PushBack(const SmartPtr<T>& ptr) noexcept;
+
+			void Clear() noexcept;
+			size_t Size() const noexcept;
+		};
+
+	private:
 		using Handle = SmartPtr<std::byte>::Handle;
 
+		class Chain;
+
+		/**
+		 * Storage for all of a Chain's Handles.
+		 * Handles live in Chunks and never move once created, which SmartPtr relies on.
+		 * Releasing a Handle leaves a gap, which is only reused if it's at the very end.
+		 * A Chunk is only freed once every Handle in it has been released.
+		 */
+		class HandleStore final
+		{
+			// Chunks are aligned to their size, so any Handle can find the HandleStore it lives in, see Of.
+			constexpr static size_t chunkBytes = 1024;
+			// How many Handles are in a Chunk.
+			constexpr static size_t chunkSize = (chunkBytes - sizeof(HandleStore*) - sizeof(size_t)) / sizeof(Handle);
+
+			struct alignas(chunkBytes) Chunk final
+			{
+				HandleStore* store{ nullptr };
+				// How many Handles have been created in this Chunk.
+				size_t size{ 0 };
+				std::array<Handle, chunkSize> handles{};
+			};
+
+			std::vector<Chunk*> chunks{};
+			// Kept after being emptied so that creating and releasing across a Chunk boundary doesn't thrash the system allocator.
+			Chunk* spare{ nullptr };
+			// How many Handles have been created in all Chunks, and how many of those have since been released.
+			size_t numHandles{ 0 };
+			size_t numReleased{ 0 };
+
+		public:
+			/**
+			 * How many objects behind these Handles have been destroyed, by any thread, see NotifyFreed.
+			 */
+			std::atomic<size_t> numFreed{ 0 };
+			/**
+			 * Whether the owning Chain is Defragging one of its Heaps in the background, see Memory::MayTouch.
+			 */
+			std::atomic<bool> inBackgroundDefrag{ false };
+
+			HandleStore() noexcept = default;
+			MOVE_COPY(HandleStore, delete)
+			~HandleStore() noexcept;
+
+			/**
+			 * Amortized O(1)
+			 *
+			 * @returns		a copy of handle whose address will never change
+			 */
+			Handle& New(const Handle& handle) noexcept;
+
+			/**
+			 * Amortized O(1)
+			 *
+			 * Marks the Handle as no longer in use, it must not be referenced again.
+			 */
+			void Release(Handle& handle) noexcept;
+
+			/**
+			 * Amortized O(1)
+			 *
+			 * Once at least half of the Handles have been released, frees any Chunk where every Handle has been.
+			 */
+			void FreeReleasedChunks() noexcept;
+
+			/**
+			 * O(1)
+			 *
+			 * @param handle	any Handle which hasn't been released
+			 * @returns			the HandleStore handle lives in
+			 */
+			static HandleStore& Of(const void* handle) noexcept;
+
+		private:
+			static bool IsReleased(const Handle& handle) noexcept;
+			void TrimBack() noexcept;
+			Chunk* NewChunk() noexcept;
+			void FreeChunk(Chunk* chunk) noexcept;
+		};
+
+		/**
+		 * A Heap's Handles, kept in the same order as the bytes they point to.
+		 * The Handles themselves live in the Chain's HandleStore, so changing their order never changes their addresses.
+		 * Erasing a Handle leaves a gap that iteration skips over until Compact.
+		 */
+		class HandleTable final
+		{
+			HandleStore& store;
+			// nullptr where a Handle has been erased.
+			std::vector<Handle*> handles{};
+			// How many Handles haven't been erased.
+			size_t size{ 0 };
+
+		public:
+			/**
+			 * Bidirectional iterator which skips erased Handles.
+			 * Stays valid through PushBack, Append, Splice, and Erasing or Extracting other Handles.
+			 */
+			class iterator final
+			{
+				friend HandleTable;
+				
+				HandleTable* owner{ nullptr };
+				size_t index{ 0 };
+
+			public:
+				using iterator_category = std::bidirectional_iterator_tag;
+				using value_type = Handle;
+				using difference_type = ptrdiff_t;
+				using pointer = Handle*;
+				using reference = Handle&;
+
+			private:
+				iterator(HandleTable* owner, size_t index) noexcept;
+			public:
+				SPECIAL_MEMBERS(iterator, default)
+
+				iterator& operator++() noexcept;
+				iterator operator++(int) noexcept;
+				iterator& operator--() noexcept;
+				iterator operator--(int) noexcept;
+				reference operator*() const noexcept;
+				pointer operator->() const noexcept;
+				bool operator==(const iterator& other) const noexcept;
+				bool operator!=(const iterator& other) const noexcept;
+
+			private:
+				/**
+				 * Moves forward until this iterator is on a Handle that hasn't been erased, or is at the end.
+				 */
+				void SkipErased() noexcept;
+			};
+
+			HandleTable() = delete;
+			explicit HandleTable(HandleStore& store) noexcept;
+			MOVE_COPY(HandleTable, delete)
+			~HandleTable() noexcept = default;
+
+#pragma region properties
+			bool IsEmpty() const noexcept;
+			size_t Size() const noexcept;
+#pragma endregion
+
+			iterator begin() noexcept;
+			iterator end() noexcept;
+
+			/**
+			 * O(1)
+			 *
+			 * @returns		the highest Handle
+			 */
+			Handle& Back() noexcept;
+
+			/**
+			 * Amortized O(1)
+			 *
+			 * @returns		the newly added highest Handle, whose address will never change
+			 */
+			Handle& PushBack(const Handle& handle) noexcept;
+
+			/**
+			 * Amortized O(1)
+			 *
+			 * Adds an existing Handle taken from another table with Extract as the highest.
+			 */
+			void Append(Handle& handle) noexcept;
+
+			/**
+			 * Amortized O(1)
+			 *
+			 * Releases the highest Handle, along with any erased ones directly below it.
+			 */
+			void PopBack() noexcept;
+
+			/**
+			 * O(1), unless it's the highest Handle in which case it's the same as PopBack.
+			 *
+			 * Releases the Handle.
+			 */
+			void Erase(iterator it) noexcept;
+
+			/**
+			 * O(1), unless it's the highest Handle.
+			 *
+			 * Removes the Handle from this table without releasing it, so that it may be Appended to another.
+			 */
+			void Extract(iterator it) noexcept;
+
+			/**
+			 * O(1)
+			 *
+			 * Puts an existing Handle in place of the one at it, which is neither released nor kept anywhere else.
+			 */
+			void Replace(iterator it, Handle& handle) noexcept;
+
+			/**
+			 * O(n) where n is the size of other.
+			 *
+			 * Moves every Handle from other to the end of this table without changing their addresses.
+			 * Both tables must share the same HandleStore.
+			 */
+			void Splice(HandleTable& other) noexcept;
+
+			/**
+			 * O(n)
+			 *
+			 * Forgets the gaps left by erasing.
+			 * Invalidates iterators.
+			 */
+			void Compact() noexcept;
+
+		private:
+			void TrimBack() noexcept;
+		};
+
+		/**
+		 * Where an object in a Layout ends up, see Manager::Defrag(const Layout&).
+		 */
+		struct Placement final
+		{
+			Handle* handle{ nullptr };
+			size_t numBytes{ 0 };
+			// Bytes from the start of where all of the Layout's objects go.
+			size_t offset{ 0 };
+		};
+
+		// Position of each Handle in a Layout.
+		using Ranks = std::unordered_map<const Handle*, size_t>;
+
 		/**
 		 * A single contiguous block of memory from which objects may reserve space.
 		 */
 		class Heap final
 		{
+			friend Chain;
+
 			// Heap i will be `byteFactor << i` bytes big.
 			constexpr static size_t byteFactor = 1024;
 			
-			// TODO: A semi-contiguous array such as std::deque would be better.
-			// That way, we have a better chance of things being in the cache.
-			// This is assuming that things allocated at roughly the same time are likely to be used together.
-			// However, we'd want to be able to guarantee that all nodes are the size of a cache line.
-			// We'd also want to only delete a node if all Handles in it are unused.
-			using Handles = std::forward_list<Handle>;
-			Handles handles{};
+			HandleTable handles;
+
+			// Heaps at least this big may be mapped, and at least this many bytes must be unused at once before they're decommitted.
+			constexpr static size_t minMappedBytes = 64 << 10;
+			// Whether this Heap's memory came from MapPages rather than Malloc.
+			const bool mapped;
 
 			// these pointers make up the "stack" of our heap
-			std::byte* const begin;
-			std::byte* const end;
+			// begin and end only change when a background Defrag swaps in the memory it copied to
+			std::byte* begin;
+			std::byte* end;
 			std::byte* top;
+			// Highest top has been since the last Decommit, everything above it hasn't been touched.
+			std::byte* committed;
 
 #ifdef _DEBUG
 			size_t count{ 0 };
@@ -41,19 +395,78 @@ namespace Library::Memory
 			
 			/**
 			 * Size of this heap can be calculated from `byteFactor << index`
-			 * Also used to get the next Heap from the Manager.
+			 * Also used to get the next Heap from the Chain.
 			 */
 			const size_t index;
+			/**
+			 * The Chain this Heap belongs to.
+			 */
+			Chain& chain;
 			/**
 			 * The overall alignment of this Heap is that of the largest allocation within it.
 			 * Used when Graduating.
 			 */
 			size_t maxAlignment{ 1 };
 
+			/**
+			 * An unused Handle whose bytes can be handed out again without Defragging.
+			 */
+			struct Hole final
+			{
+				Handle* handle;
+				size_t numBytes;
+			};
+
+			// Holes in freeLists[i] can fit at least `1 << i` bytes.
+			constexpr static size_t numSizeClasses = std::numeric_limits<size_t>::digits;
+			std::array<std::vector<Hole>, numSizeClasses> freeLists{};
+			// Bit i is set iff freeLists[i] is non-empty.
+			size_t freeClasses{ 0 };
+			// How many size classes this Heap is filed under in the Chain's roomyHeaps.
+			size_t numRoomyClasses{ 0 };
+
+			/**
+			 * Value of Chain::Churn() the last time this Heap was swept.
+			 */
+			size_t sweptAt{ 0 };
+			/**
+			 * Value of Chain::Churn() the last time this Heap finished Defragging.
+			 */
+			size_t defraggedAt{ 0 };
+
+			// See GenerationStats.
+			float survivalRate{ 0.f };
+			size_t numDefrags{ 0 };
+			size_t numGraduations{ 0 };
+			std::chrono::nanoseconds defragTime{ 0 };
+			std::chrono::nanoseconds graduateTime{ 0 };
+
+			/**
+			 * Progress of a Defrag which may be spread across several calls to DefragStep.
+			 * Everything below dest is compact and every Handle before next has been dealt with.
+			 * Handles allocated after the Defrag began are above last and are left alone until the next one.
+			 */
+			struct Compaction final
+			{
+				HandleTable::iterator next{};
+				// The highest Handle when the Defrag began, nullptr when there's no Defrag in progress.
+				Handle* last{ nullptr };
+				std::byte* dest{ nullptr };
+				std::byte* oldTop{ nullptr };
+				size_t maxAlignment{ 1 };
+			};
+			Compaction compaction{};
+
+			// How many Handles to move between checks of the clock.
+			constexpr static size_t handlesPerCheck = 64;
+			// Smaller Heaps are quicker to Defrag in place than to hand off to another thread.
+			constexpr static size_t minBackgroundBytes = 64 << 10;
+
 		public:
 			Heap() = delete;
-			explicit Heap(size_t index) noexcept;
-			MOVE_COPY_DTOR(Heap, default)
+			explicit Heap(Chain& chain, size_t index) noexcept;
+			MOVE_COPY(Heap, delete)
+			~Heap() noexcept;
 
 #pragma region properties
 			/**
@@ -82,23 +495,81 @@ namespace Library::Memory
 			 * 
 			 */
 			Heap* Next() noexcept;
+
+			/**
+			 * Whether this Heap is being Defragged in the background.
+			 * Until that's finished nothing may be allocated from it, and nothing in it may be moved or erased.
+			 */
+			bool IsFrozen() const noexcept;
 #pragma endregion
 
 			/**
 			 * O(1)
 			 *
+			 * Reuses a freed hole if one of the right size class is known, otherwise reserves from the top.
+			 *
 			 * @returns pointer that satisfies alignment and has at least numBytes reserved after it
-			 * @returns nullptr	if no allocation could be made (might need to Defrag or Graduate)
+			 * @returns nullptr	if no allocation could be made (might need to Sweep, Defrag or Graduate)
 			 */
 			Handle* Alloc(size_t numBytes, size_t alignment) noexcept;
 
 			/**
-			 * O(n^2)
+			 * O(n)
+			 *
+			 * Finds every unused Handle and files it into the free lists so Alloc can reuse its bytes.
+			 * Objects which are only weakly referenced count as unused, their Handles are Buried first.
+			 * Also calls ShrinkToFit.
+			 * Nothing is moved, so unlike Defrag this never touches live objects.
+			 */
+			void Sweep() noexcept;
+
+			/**
+			 * O(1)
+			 *
+			 * Whether enough allocations and frees have happened in the Chain since the last Sweep for another one to be worth it.
+			 * This keeps the cost of sweeping amortized O(1) per allocation.
+			 */
+			bool ShouldSweep() const noexcept;
+
+			/**
+			 * O(n)
 			 *
 			 * Shuffles memory such that all unused memory is at the end.
+			 * Slides every used Handle down in a single pass from the bottom of the Heap.
 			 */
 			void Defrag() noexcept;
 
+			/**
+			 * Amortized O(n) per Defrag.
+			 *
+			 * Does as much of a Defrag as fits before the deadline, resuming wherever the last call left off.
+			 * Always makes some progress, even if the deadline has already passed.
+			 * The Heap is in a valid state between calls, with any space that hasn't been reclaimed yet attributed to the Handle below it.
+			 *
+			 * @param deadline	when to stop
+			 * @returns			whether the Defrag finished
+			 */
+			bool DefragStep(std::chrono::steady_clock::time_point deadline) noexcept;
+
+			/**
+			 * O(1)
+			 *
+			 * Whether enough allocations and frees have happened in the Chain since the last Defrag for another one to be worth it.
+			 */
+			bool ShouldDefrag() const noexcept;
+
+			/**
+			 * Whether a Defrag has been started by DefragStep but not yet finished.
+			 */
+			bool IsDefragging() const noexcept;
+
+			/**
+			 * O(1)
+			 *
+			 * Whether this Heap is full of objects which keep surviving Defrags, according to the Chain's Policy.
+			 */
+			bool ShouldGraduate() const noexcept;
+
 			/**
 			 * O(n)
 			 *
@@ -109,6 +580,38 @@ namespace Library::Memory
 			 */
 			void Graduate() noexcept;
 
+			/**
+			 * O(n)
+			 */
+			GenerationStats Stats() noexcept;
+
+			/**
+			 * O(n)
+			 *
+			 * Fills in the handle and numBytes of the Placement of every live object in this Heap which has a rank.
+			 */
+			void Measure(const Ranks& ranks, std::vector<Placement>& placements) noexcept;
+
+			/**
+			 * O(n)
+			 *
+			 * Defrag which also takes every object that was Measured out of this Heap, copying its bytes to its offset from destination.
+			 */
+			void Evacuate(const Ranks& ranks, const std::vector<Placement>& placements, std::byte* destination) noexcept;
+
+			/**
+			 * O(number of placements)
+			 *
+			 * Moves objects which were Evacuated from any Heap of this Chain onto the top of this one.
+			 * They land in the order of their offsets.
+			 *
+			 * @param placements	where each object goes, ones without a handle are skipped
+			 * @param source		where the objects were Evacuated to
+			 * @param numBytes		how many bytes the objects take up in total
+			 * @param alignment		the largest alignment of any of the objects
+			 */
+			void Append(const std::vector<Placement>& placements, const std::byte* source, size_t numBytes, size_t alignment) noexcept;
+
 			/**
 			 * O(n) where n is the number of Unused Handles at the top of the Heap.
 			 *
@@ -119,6 +622,70 @@ namespace Library::Memory
 
 		private:
 #pragma region helpers
+			/**
+			 * O(1)
+			 *
+			 * @returns		a reused Handle, or nullptr if no known hole fits
+			 */
+			Handle* AllocFromFreeList(size_t numBytes, size_t alignment) noexcept;
+
+			/**
+			 * O(n)
+			 *
+			 * Begins a Compaction from the bottom of the Heap.
+			 */
+			void BeginDefrag() noexcept;
+
+			/**
+			 * O(1)
+			 *
+			 * Abandons the current Compaction, if any.
+			 * Must be called whenever Handles are erased or moved by anything else.
+			 */
+			void CancelDefrag() noexcept;
+
+			/**
+			 * O(1)
+			 *
+			 * Gives the pages above top back to the OS if this Heap is mapped and enough of them are unused.
+			 */
+			void Decommit() noexcept;
+
+			/**
+			 * Forgets every known hole.
+			 * Must be called whenever Handles are erased or moved out of this Heap.
+			 */
+			void ClearFreeLists() noexcept;
+
+			/**
+			 * O(1) unless the biggest contiguous room has crossed a power of 2, then O(number of size classes crossed).
+			 *
+			 * Files this Heap under every size class it has room for in the Chain's roomyHeaps.
+			 * Must be called whenever top or the free lists change.
+			 */
+			void Reindex() noexcept;
+
+			/**
+			 * Files this Heap under size classes [0, numClasses) and no others.
+			 */
+			void Index(size_t numClasses) noexcept;
+
+			/**
+			 * O(1)
+			 *
+			 * If the object at it has been destroyed but is still weakly referenced, its Handle is tombstoned and an unused one takes its place.
+			 * Its bytes are then reclaimed like any other unused Handle's, rather than waiting on the WeakPtrs.
+			 * Must not be called on the last Handle of a Compaction in progress.
+			 *
+			 * @returns		the Handle now at it
+			 */
+			Handle& Bury(HandleTable::iterator it) noexcept;
+
+			/**
+			 * @returns		how many bytes must be skipped after ptr to satisfy alignment
+			 */
+			static size_t Padding(const std::byte* ptr, size_t alignment) noexcept;
+
 			/**
 			 * Fill memory with debug values (only in debug compilations).
 			 * 
@@ -127,21 +694,258 @@ namespace Library::Memory
 			 */
 			void DebugFill(std::byte* from, std::byte* to) noexcept;
 
+			/**
+			 * Gives memory that was the size of this Heap back to wherever it came from.
+			 */
+			void FreeMemory(std::byte* memory) noexcept;
+
 			void DebugIncCount() noexcept;
 			void DebugDecCount() noexcept;
 #pragma endregion
 		};
 
+		/**
+		 * A sequence of geometrically growing Heaps owned by a single thread.
+		 */
+		class Chain final
+		{
+			friend Heap;
+			friend Manager;
+			friend bool MayTouch(const void* handle) noexcept;
+
+			// Declared before the Heaps so that it outlives them.
+			HandleStore handleStore{};
+			/**
+			 * Bit i of roomyHeaps[c] is set iff Heap i has at least `1 << c` contiguous bytes free, at its top or in a hole.
+			 * Lets Alloc go straight to the Heaps which may fit an allocation instead of asking every one.
+			 * Also outlives the Heaps, which unfile themselves when destroyed.
+			 */
+			std::array<size_t, Heap::numSizeClasses> roomyHeaps{};
+			std::deque<Heap> heaps{};
+			/**
+			 * Allocations which live outside of the Heaps, in no particular order.
+			 */
+			std::vector<Handle*> pinned{};
+			/**
+			 * Handles whose objects are gone but which are still weakly referenced, see Entomb.
+			 */
+			std::vector<Handle*> tombstones{};
+			/**
+			 * Which Heap DefragStep is working on.
+			 */
+			size_t defragIndex{ 0 };
+			/**
+			 * Running count of every allocation made from this Chain, see Churn.
+			 */
+			size_t churn{ 0 };
+
+			Policy policy{};
+			size_t numCollects{ 0 };
+			AllocationStats allocationStats{};
+			/**
+			 * How many Shares haven't been matched by an Unshare yet, while which Collect doesn't move anything.
+			 */
+			size_t numSharers{ 0 };
+
+			/**
+			 * A Defrag of one Heap being done on another thread, see Policy::defragInBackground.
+			 */
+			struct BackgroundDefrag final
+			{
+				/**
+				 * Where a live object was copied to.
+				 */
+				struct Copy final
+				{
+					Handle* handle;
+					std::byte* ptr;
+					size_t numBytes;
+				};
+
+				/**
+				 * A live object to copy, recorded by this thread before the other one starts so that it never reads the Heap.
+				 */
+				struct Source final
+				{
+					Handle* handle;
+					std::byte* ptr;
+					size_t numBytes;
+					size_t alignment;
+				};
+
+				// The frozen Heap, nullptr when there's no background Defrag in progress.
+				Heap* heap{ nullptr };
+				// In the same order as the Heap's Handles.
+				std::vector<Source> sources{};
+				size_t totalBytes{ 0 };
+				// The same size as the Heap's memory, which it replaces once finished.
+				// nullptr if the objects didn't fit, in which case nothing is moved.
+				std::byte* memory{ nullptr };
+				// In the same order as the Heap's Handles.
+				std::vector<Copy> copies{};
+				std::byte* top{ nullptr };
+				size_t maxAlignment{ 1 };
+				// Set by the other thread once it's done copying.
+				std::atomic<bool> copied{ false };
+				std::thread thread{};
+			};
+			BackgroundDefrag background{};
+
+		public:
+			Chain() noexcept;
+			MOVE_COPY(Chain, delete)
+			~Chain() noexcept;
+
+			bool IsEmpty() const noexcept;
+			size_t TotalBytes() const noexcept;
+
+			/**
+			 * @returns		running count of every allocation made from this Chain plus every one of its objects freed, on any thread
+			 */
+			size_t Churn() const noexcept;
+
+			Handle& Alloc(size_t numBytes, size_t alignment) noexcept;
+			Handle& AllocPinned(size_t numBytes, size_t alignment) noexcept;
+			void Defrag() noexcept;
+			void Defrag(const Layout& layout) noexcept;
+			bool DefragStep(std::chrono::steady_clock::time_point deadline) noexcept;
+			void Collect(std::chrono::steady_clock::time_point deadline) noexcept;
+			void Graduate() noexcept;
+			void ShrinkToFit() noexcept;
+
+			/**
+			 * Constructs a new Heap at twice the size of the current largest Heap.
+			 */
+			Heap& MakeHeap() noexcept;
+
+			/**
+			 * O(n) where n is the number of pinned Handles
+			 *
+			 * Frees the bytes and Handle of every unused pinned allocation.
+			 */
+			void SweepPinned() noexcept;
+
+			/**
+			 * Amortized O(1)
+			 *
+			 * Keeps the Handle of a destroyed object alive for its WeakPtrs, without the bytes it pointed to.
+			 * The Handle must already be out of any Heap's HandleTable and pinned.
+			 */
+			void Entomb(Handle& handle) noexcept;
+
+			/**
+			 * O(n) where n is the number of tombstones
+			 *
+			 * Releases every tombstoned Handle which is no longer weakly referenced.
+			 */
+			void SweepTombstones() noexcept;
+
+			/**
+			 * O(n) where n is the number of Handles in the Heap, the copying itself is done on another thread.
+			 *
+			 * Freezes the Heap, records where its live objects are, and starts copying them to new memory on another thread.
+			 * There must not already be a background Defrag in progress.
+			 */
+			void BeginBackgroundDefrag(Heap& heap) noexcept;
+
+			/**
+			 * O(n) where n is the number of Handles in the frozen Heap, plus however long the copying has left.
+			 *
+			 * Waits for the copying to finish, then points every Handle at its copy, swaps in the new memory and unfreezes the Heap.
+			 * Objects touched since copying began are copied again.
+			 * Does nothing if there's no background Defrag in progress.
+			 */
+			void FinishBackgroundDefrag() noexcept;
+
+		private:
+			/**
+			 * Runs on the background Defrag's thread.
+			 * Only reads background.sources, the objects they point to and their shared counts.
+			 * Writes to nothing but the new memory and background.
+			 */
+			void CopyInBackground() noexcept;
+		};
+
+		/**
+		 * Owns the Chain of the calling thread, which it creates as localChain.
+		 * When the thread exits its Chain is orphaned rather than destroyed since other threads may still reference its Handles.
+		 */
+		struct ThreadChain final
+		{
+			ThreadChain() noexcept;
+			MOVE_COPY(ThreadChain, delete)
+			~ThreadChain() noexcept;
+		};
+
 		friend Heap;
+		friend Chain;
+		friend bool MayTouch(const void* handle) noexcept;
 		
-		static inline std::deque<Heap> heaps{ Heap(0), Heap(1) };
+		// Trivially destructible so that it can still be read by thread_locals and statics destroyed after threadChain.
+		static inline thread_local Chain* localChain{ nullptr };
+		static inline thread_local ThreadChain threadChain{};
+
+		/**
+		 * Where every tombstoned Handle points, since nullptr would read as released.
+		 */
+		static inline std::byte tombstone{};
+
+		/**
+		 * Chains whose threads have exited but still have live allocations.
+		 * They are never moved, only shrunk, and are deleted once they become empty.
+		 */
+		static inline std::vector<Chain*> orphans{};
+		static inline std::mutex orphansMutex{};
 		
 	public:
 		STATIC_CLASS(Manager)
 
 #pragma region properties
+		/**
+		 * @returns		whether or not the calling thread's Heaps are free of any allocations
+		 */
 		static bool IsEmpty() noexcept;
+
+		/**
+		 * @returns		how many bytes the calling thread's Heaps have reserved from the system
+		 */
 		static size_t TotalBytes() noexcept;
+
+		/**
+		 * O(n) where n is the number of orphaned Chains
+		 *
+		 * @returns		how many bytes the Heaps of exited threads still hold, until ShrinkToFit finds them empty
+		 */
+		static size_t OrphanedBytes() noexcept;
+
+		/**
+		 * @returns		the Policy Collect follows for the calling thread
+		 */
+		static const Policy& GetPolicy() noexcept;
+
+		/**
+		 * Changes the Policy Collect follows for the calling thread.
+		 */
+		static void SetPolicy(const Policy& policy) noexcept;
+
+		/**
+		 * O(number of Handles)
+		 *
+		 * @returns		a snapshot of each of the calling thread's Heaps, youngest first
+		 */
+		static std::vector<GenerationStats> GetGenerationStats() noexcept;
+
+		/**
+		 * O(1)
+		 *
+		 * @returns		histograms of every allocation made by the calling thread since the last ResetAllocationStats
+		 */
+		static const AllocationStats& GetAllocationStats() noexcept;
+
+		/**
+		 * Zeroes the calling thread's AllocationStats, e.g. to get per-frame numbers.
+		 */
+		static void ResetAllocationStats() noexcept;
 #pragma endregion
 		
 #pragma region alloc
@@ -158,7 +962,7 @@ namespace Library::Memory
 		static typename SmartPtr<T>::Handle& Emplace(Args... args);
 
 		/**
-		 * Allocate space.
+		 * Allocate space from the calling thread's Heaps.
 		 * Will end up reserving potentially more than numBytes due to padding to satisfy alignment.
 		 * Guarantees no other managed memory will be touched.
 		 *
@@ -166,33 +970,121 @@ namespace Library::Memory
 		 * @param alignment		desired alignment of the bytes
 		 */
 		static Handle& Alloc(size_t numBytes, size_t alignment) noexcept;
+
+		/**
+		 * Allocate and construct in-place, somewhere the object will never be moved.
+		 */
+		template<typename T, typename... Args>
+		static typename SmartPtr<T>::Handle& EmplacePinned(Args... args);
+
+		/**
+		 * Allocate space outside of the Heaps, which Defrag and Graduate never move.
+		 * The bytes come from Malloc and are freed once the Handle is unused and the calling thread next Collects, Defrags or shrinks.
+		 * Meant for long-lived objects which are dereferenced often, so that their raw pointer can be kept.
+		 *
+		 * @param numBytes		minimum number of bytes to reserve
+		 * @param alignment		desired alignment of the bytes, no more than alignof(std::max_align_t)
+		 */
+		static Handle& AllocPinned(size_t numBytes, size_t alignment) noexcept;
+
+		/**
+		 * To be called by SharedPtr whenever it destroys an object, before the Handle reads as unused.
+		 * Lets the Chain which owns the Handle know that sweeping for holes might be worthwhile, no matter which thread this is.
+		 * Safe to call after the calling thread's Chain has been torn down.
+		 *
+		 * @param handle		the Handle of the destroyed object
+		 */
+		static void NotifyFreed(const void* handle) noexcept;
 #pragma endregion
 
 #pragma region gc
 		/**
-		 * Removes fragments from all managed Heaps.
+		 * Removes fragments from all of the calling thread's Heaps.
+		 * Must not race with other threads dereferencing objects allocated by this thread.
 		 */
 		static void Defrag() noexcept;
 
 		/**
-		 * Graduates the smallest Heap to the next.
+		 * O(n)
+		 *
+		 * Defrag which also moves the objects in layout to the top of the calling thread's oldest Heap, next to each other and in that order.
+		 * Repeated objects go where they first appear, and ones allocated by other threads are left where they are.
+		 * Everything else keeps its relative order.
+		 * Must not race with other threads dereferencing objects allocated by this thread.
+		 */
+		static void Defrag(const Layout& layout) noexcept;
+
+		/**
+		 * Spends roughly at most budget Defragging the calling thread's Heaps, picking up where the last call left off.
+		 * Meant to be called once per frame so that Defragging never causes a spike.
+		 * Heaps which haven't seen much churn since they were last Defragged are skipped.
+		 * Must not race with other threads dereferencing objects allocated by this thread.
+		 *
+		 * @param budget	how long to spend
+		 * @returns			whether the calling thread's Heaps have no more Defragging to do
+		 */
+		static bool DefragStep(std::chrono::nanoseconds budget) noexcept;
+
+		/**
+		 * Applies the calling thread's Policy, spending roughly at most budget.
+		 * Continues any DefragStep in progress, Graduates Heaps which are full of survivors and periodically calls ShrinkToFit.
+		 * Also finishes a background Defrag once it's done copying, see Policy::defragInBackground.
+		 * Meant to be called at frame boundaries.
+		 * Must not race with other threads dereferencing objects allocated by this thread, unless they've been declared with Share.
+		 *
+		 * @param budget	how long to spend
+		 */
+		static void Collect(std::chrono::nanoseconds budget) noexcept;
+
+		/**
+		 * O(1), unless it has to wait for a background Defrag to finish copying.
+		 *
+		 * Declares that other threads may dereference the calling thread's objects until a matching Unshare, e.g. while a task runs on another thread.
+		 * Meanwhile Collect only frees what it can without moving anything, and no background Defrag is started.
+		 * Defrag, DefragStep and Graduate still move objects when called directly, and must not be.
+		 */
+		static void Share() noexcept;
+
+		/**
+		 * O(1)
+		 *
+		 * Ends a Share, once the other threads are done dereferencing the calling thread's objects.
+		 */
+		static void Unshare() noexcept;
+
+		/**
+		 * Graduates the calling thread's smallest Heap to the next.
 		 * If the next Heap doesn't have enough space, it must Graduate too, starting a chain reaction.
 		 * Will potentially allocate a new Heap if there's not enough space to Graduate all the way up.
 		 */
 		static void Graduate() noexcept;
 
 		/**
-		 * Keeps deleting the last Heap as long as the last Heap is empty.
+		 * Keeps deleting the calling thread's last Heap as long as the last Heap is empty.
 		 * Will not delete the 0th or 1st Heap.
+		 * Also shrinks the Chains of exited threads, deleting them once they are empty.
 		 */
 		static void ShrinkToFit() noexcept;
 #pragma endregion
 
 	private:
 		/**
-		 * Constructs a new Heap at twice the size of the current largest Heap.
+		 * @returns		the calling thread's Chain, a new one if the thread's first Chain has already been orphaned
+		 */
+		static Chain& LocalChain() noexcept;
+
+		/**
+		 * Creates the calling thread's Chain the first time, and again for destructors which run after it's been orphaned.
+		 */
+		static void NewLocalChain() noexcept;
+
+		/**
+		 * Shrinks every orphaned Chain and deletes the ones which are empty.
 		 */
-		static Heap& MakeHeap() noexcept;
+		static void CollectOrphans() noexcept;
+
+		template<typename T>
+		static Handle* HandleOf(const SmartPtr<T>& ptr) noexcept;
 	};
 }
 
@@ -16,4 +16,37 @@ namespace Library::Memory
 		new (ret.ptr) T(std::forward<Args>(args)...);
 		return ret;
 	}
+
+	template<typename T, typename ...Args>
+	inline typename SmartPtr<T>::Handle& Manager::EmplacePinned(Args ...args)
+	{
+		auto& ret = reinterpret_cast<typename SmartPtr<T>::Handle&>(AllocPinned(sizeof(T), alignof(T)));
+		new (ret.ptr) T(std::forward<Args>(args)...);
+		return ret;
+	}
+
+	template<typename T>
+	inline void Manager::Layout::PushBack(const SmartPtr<T>& ptr) noexcept
+	{
+		if (Handle* handle = HandleOf(ptr))
+		{
+			handles.push_back(handle);
+		}
+	}
+
+	inline void Manager::Layout::Clear() noexcept
+	{
+		handles.clear();
+	}
+
+	inline size_t Manager::Layout::Size() const noexcept
+	{
+		return handles.size();
+	}
+
+	template<typename T>
+	inline Manager::Handle* Manager::HandleOf(const SmartPtr<T>& ptr) noexcept
+	{
+		return reinterpret_cast<Handle*>(ptr.handle);
+	}
 }
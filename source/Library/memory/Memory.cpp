@@ -17,14 +17,14 @@
 	return Library::Memory::Malloc(count);
 }
 
-[[nodiscard]] void* operator new(const std::size_t count, [[maybe_unused]] const std::align_val_t al)
+[[nodiscard]] void* operator new(const std::size_t count, const std::align_val_t al)
 {
-	return Library::Memory::Malloc(count);
+	return Library::Memory::AlignedMalloc(count, size_t(al));
 }
 
-[[nodiscard]] void* operator new[](const std::size_t count, [[maybe_unused]] const std::align_val_t al)
+[[nodiscard]] void* operator new[](const std::size_t count, const std::align_val_t al)
 {
-	return Library::Memory::Malloc(count);
+	return Library::Memory::AlignedMalloc(count, size_t(al));
 }
 #pragma endregion
 
@@ -39,14 +39,14 @@
 	return std::malloc(count);
 }
 
-[[nodiscard]] void* operator new(const std::size_t count, [[maybe_unused]] const std::align_val_t al, [[maybe_unused]] const std::nothrow_t& tag) noexcept
+[[nodiscard]] void* operator new(const std::size_t count, const std::align_val_t al, [[maybe_unused]] const std::nothrow_t& tag) noexcept
 {
-	return std::malloc(count);
+	return Library::Memory::AlignedMalloc(count, size_t(al));
 }
 
-[[nodiscard]] void* operator new[](const std::size_t count, [[maybe_unused]] const std::align_val_t al, [[maybe_unused]] const std::nothrow_t& tag) noexcept
+[[nodiscard]] void* operator new[](const std::size_t count, const std::align_val_t al, [[maybe_unused]] const std::nothrow_t& tag) noexcept
 {
-	return std::malloc(count);
+	return Library::Memory::AlignedMalloc(count, size_t(al));
 }
 #pragma endregion
 #pragma endregion
@@ -66,12 +66,12 @@ void operator delete[](void* ptr) noexcept
 
 void operator delete(void* ptr, [[maybe_unused]] const std::align_val_t al) noexcept
 {
-	Library::Memory::Free(ptr);
+	Library::Memory::AlignedFree(ptr);
 }
 
 void operator delete[](void* ptr, [[maybe_unused]] const std::align_val_t al) noexcept
 {
-	Library::Memory::Free(ptr);
+	Library::Memory::AlignedFree(ptr);
 }
 
 void operator delete(void* ptr, [[maybe_unused]] const std::size_t sz) noexcept
@@ -86,12 +86,12 @@ void operator delete[](void* ptr, [[maybe_unused]] const std::size_t sz) noexcep
 
 void operator delete(void* ptr, [[maybe_unused]] const std::size_t sz, [[maybe_unused]] const std::align_val_t al) noexcept
 {
-	Library::Memory::Free(ptr);
+	Library::Memory::AlignedFree(ptr);
 }
 
 void operator delete[](void* ptr, [[maybe_unused]] const std::size_t sz, [[maybe_unused]] const std::align_val_t al) noexcept
 {
-	Library::Memory::Free(ptr);
+	Library::Memory::AlignedFree(ptr);
 }
 #pragma endregion
 
@@ -108,12 +108,12 @@ void operator delete[](void* ptr, [[maybe_unused]] const std::nothrow_t& tag) no
 
 void operator delete(void* ptr, [[maybe_unused]] std::align_val_t al, [[maybe_unused]] const std::nothrow_t& tag ) noexcept
 {
-	Library::Memory::Free(ptr);
+	Library::Memory::AlignedFree(ptr);
 }
 
 void operator delete[](void* ptr, [[maybe_unused]] std::align_val_t al, [[maybe_unused]] const std::nothrow_t& tag ) noexcept
 {
-	Library::Memory::Free(ptr);
+	Library::Memory::AlignedFree(ptr);
 }
 #pragma endregion
 #pragma endregion
@@ -4,7 +4,6 @@
 #include <cstdint>
 #include <cstdlib>
 #include <cstring>
-#include <cwchar>
 
 #include "Macros.h"
 
@@ -52,6 +51,21 @@ namespace Library::Memory
 	template<typename T>
 	static void Free(T*& array) noexcept;
 
+	/**
+	 * Malloc for alignments stricter than std::malloc guarantees, such as over-aligned operator new.
+	 * The offset from what Malloc returned is kept just before the returned pointer.
+	 *
+	 * @param count			How many bytes of memory to allocate.
+	 * @param alignment		Power of 2 the returned address is a multiple of.
+	 * @returns				A pointer to newly allocated memory, which must be freed with AlignedFree.
+	 */
+	static void* AlignedMalloc(size_t count, size_t alignment) noexcept;
+
+	/**
+	 * Frees memory returned by AlignedMalloc, does nothing if p is nullptr.
+	 */
+	static void AlignedFree(void* p) noexcept;
+
 	/**
 	 * Templated wrapper to std::realloc which takes a number of elements rather than a byte count.
 	 * Asserts if std::realloc fails.
@@ -154,6 +168,17 @@ namespace Library::Memory
 	 */
 	template<>
 	void Memset<void>(void* dest, uint8_t byte, size_t byteCount) noexcept;
+
+	/**
+	 * Repeats a 2 byte pattern across dest.
+	 * Unlike std::wmemset it doesn't depend on the size of wchar_t, which is 4 bytes outside of Windows.
+	 * If byteCount is odd the last byte gets the pattern's first byte.
+	 *
+	 * @param dest			destination memory address
+	 * @param pattern		2 bytes to repeat, as they're laid out in memory
+	 * @param byteCount		number of bytes to fill
+	 */
+	static void Fill(void* dest, uint16_t pattern, size_t byteCount) noexcept;
 }
 
 #include "Memory.inl"
@@ -2,6 +2,8 @@
 
 #pragma once
 #include "Memory.h"
+#include "Profiler.h"
+#include "Simd.h"
 
 namespace Library::Memory
 {
@@ -13,6 +15,7 @@ namespace Library::Memory
 		}
 		void* ret = std::malloc(count);
 		assertm(ret, "std::malloc returned nullptr");
+		Profiler::OnAlloc(Profiler::Source::Malloc, reinterpret_cast<std::uintptr_t>(ret), count);
 		return ret;
 	}
 	
@@ -31,10 +34,30 @@ namespace Library::Memory
 	template<typename T>
 	void Free(T*& array) noexcept
 	{
+		Profiler::OnFree(Profiler::Source::Malloc, reinterpret_cast<std::uintptr_t>(array));
 		std::free(reinterpret_cast<void*>(array));
 		array = nullptr;
 	}
 
+	inline void* AlignedMalloc(const size_t count, size_t alignment) noexcept
+	{
+		// room for the offset, which is never 0 since there's always at least this much
+		alignment = std::max(alignment, sizeof(size_t));
+		std::byte* const raw = Malloc<std::byte>(count + alignment);
+		std::byte* const ret = raw + alignment - size_t(raw) % alignment;
+		reinterpret_cast<size_t*>(ret)[-1] = ret - raw;
+		return ret;
+	}
+
+	inline void AlignedFree(void* p) noexcept
+	{
+		if (p)
+		{
+			std::byte* raw = reinterpret_cast<std::byte*>(p) - reinterpret_cast<size_t*>(p)[-1];
+			Free(raw);
+		}
+	}
+
 	template<typename T>
 	void Realloc(T*& array, const size_t count) noexcept
 	{
@@ -50,8 +73,10 @@ namespace Library::Memory
 		}
 		else
 		{
+			Profiler::OnFree(Profiler::Source::Malloc, reinterpret_cast<std::uintptr_t>(array));
 			array = std::realloc(reinterpret_cast<void*>(array), byteCount);
 			assertm(array, "std::realloc returned nullptr");
+			Profiler::OnAlloc(Profiler::Source::Malloc, reinterpret_cast<std::uintptr_t>(array), byteCount);
 		}
 	}
 
@@ -89,21 +114,14 @@ namespace Library::Memory
 		Memset<void>(reinterpret_cast<void*>(dest), byte, count * sizeof(T));
 	}
 
-	template<typename T>
-	inline void Memset(T* dest, const uint16_t word, const size_t count) noexcept
-	{
-		Memset<void>(reinterpret_cast<void*>(dest), word, count * sizeof(T));
-	}
-	
 	template<>
 	inline void Memset(void* dest, const uint8_t byte, const size_t byteCount) noexcept
 	{
 		std::memset(dest, byte, byteCount);
 	}
-	
-	template<>
-	inline void Memset(void* dest, const uint16_t word, const size_t wordCount) noexcept
+
+	inline void Fill(void* dest, const uint16_t pattern, const size_t byteCount) noexcept
 	{
-		std::wmemset(reinterpret_cast<wchar_t*>(dest), word, wordCount);
+		SimdFill(dest, pattern, byteCount);
 	}
 }
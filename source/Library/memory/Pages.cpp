@@ -0,0 +1,86 @@
+#include "pch.h"
+#include "Pages.h"
+
+#include "Memory.h"
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace Library::Memory
+{
+	size_t PageSize() noexcept
+	{
+#ifdef __linux__
+		static const size_t pageSize = size_t(sysconf(_SC_PAGESIZE));
+		return pageSize;
+#else
+		return 4096;
+#endif
+	}
+
+	std::byte* MapPages(const size_t numBytes) noexcept
+	{
+#ifdef __linux__
+		if (numBytes < hugePageSize)
+		{
+			void* ret = mmap(nullptr, numBytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+			assertm(ret != MAP_FAILED, "mmap failed");
+			return reinterpret_cast<std::byte*>(ret);
+		}
+
+		// Over-reserve so that the mapping can start on a huge page boundary, then give back the excess on either side.
+		// Address space is cheap, and with MAP_NORESERVE none of it is committed anyway.
+		const size_t reserved = numBytes + hugePageSize;
+		void* raw = mmap(nullptr, reserved, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+		assertm(raw != MAP_FAILED, "mmap failed");
+
+		std::byte* const first = reinterpret_cast<std::byte*>(raw);
+		std::byte* const ret = first + (hugePageSize - size_t(first) % hugePageSize) % hugePageSize;
+		std::byte* const last = first + reserved;
+		if (ret != first)
+		{
+			munmap(first, ret - first);
+		}
+		if (ret + numBytes != last)
+		{
+			munmap(ret + numBytes, last - (ret + numBytes));
+		}
+
+#ifdef MADV_HUGEPAGE
+		// only advice, if transparent huge pages are disabled this does nothing
+		madvise(ret, numBytes, MADV_HUGEPAGE);
+#endif
+		return ret;
+#else
+		return Malloc<std::byte>(numBytes);
+#endif
+	}
+
+	void UnmapPages(std::byte*& pages, [[maybe_unused]] const size_t numBytes) noexcept
+	{
+#ifdef __linux__
+		if (pages)
+		{
+			munmap(pages, numBytes);
+		}
+		pages = nullptr;
+#else
+		Free(pages);
+#endif
+	}
+
+	void DecommitPages([[maybe_unused]] std::byte* from, [[maybe_unused]] std::byte* to) noexcept
+	{
+#ifdef __linux__
+		const size_t pageSize = PageSize();
+		from += (pageSize - size_t(from) % pageSize) % pageSize;
+		to -= size_t(to) % pageSize;
+		if (from < to)
+		{
+			madvise(from, to - from, MADV_DONTNEED);
+		}
+#endif
+	}
+}
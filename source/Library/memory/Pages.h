@@ -0,0 +1,53 @@
+// MIT License Copyright (c) 2020 Jarrett Wendt
+
+#pragma once
+#include <cstddef>
+
+namespace Library::Memory
+{
+	/**
+	 * Whether MapPages gets memory straight from the OS.
+	 * Otherwise it falls back on Malloc and DecommitPages does nothing.
+	 */
+#ifdef __linux__
+	constexpr bool canMapPages = true;
+#else
+	constexpr bool canMapPages = false;
+#endif
+
+	/**
+	 * Mappings at least this big are aligned to it and asked to be backed by transparent huge pages.
+	 */
+	constexpr size_t hugePageSize = size_t(2) << 20;
+
+	/**
+	 * @returns		the size of a regular page of virtual memory
+	 */
+	size_t PageSize() noexcept;
+
+	/**
+	 * Reserves address space from the OS without committing physical memory to it up front.
+	 * Pages only become resident once they are touched.
+	 *
+	 * @param numBytes	how many bytes to map
+	 * @returns			page-aligned memory which must be freed with UnmapPages
+	 *
+	 * @asserts			that the mapping succeeds
+	 */
+	std::byte* MapPages(size_t numBytes) noexcept;
+
+	/**
+	 * @param pages		memory returned by MapPages, set to nullptr
+	 * @param numBytes	the same number of bytes that was given to MapPages
+	 */
+	void UnmapPages(std::byte*& pages, size_t numBytes) noexcept;
+
+	/**
+	 * Gives every whole page between from and to back to the OS while keeping the address space.
+	 * Their contents are lost, they read as zero the next time they are touched.
+	 *
+	 * @param from		start of the range, rounded up to a page boundary
+	 * @param to		end of the range, rounded down to a page boundary
+	 */
+	void DecommitPages(std::byte* from, std::byte* to) noexcept;
+}
@@ -0,0 +1,60 @@
+#pragma once
+#include "SharedPtr.h"
+
+namespace Library
+{
+	/**
+	 * SharedPtr to an object which Memory::Manager never moves, made with SharedPtr::MakePinned.
+	 * Since the object stays put it keeps the raw pointer alongside the Handle,
+	 * so dereferencing is one load rather than going through the Handle first.
+	 *
+	 * Converts to a plain SharedPtr or WeakPtr, which dereference through the Handle as usual.
+	 *
+	 * @param <T>			type this pointer references
+	 * @param <RefCount>	how the reference counts are updated, use Memory::AtomicRefCount to share between threads
+	 */
+	template<typename T, Concept::RefCount RefCount = Memory::NonAtomicRefCount>
+	class PinnedPtr : public SharedPtr<T, RefCount>
+	{
+		template<typename U, Concept::RefCount>
+		friend class SharedPtr;
+
+		using Base = SharedPtr<T, RefCount>;
+
+		T* ptr{ nullptr };
+
+		explicit PinnedPtr(typename SmartPtr<T>::Handle& handle) noexcept;
+
+	public:
+		PinnedPtr(nullptr_t) noexcept;
+
+		PinnedPtr() noexcept = default;
+		PinnedPtr(const PinnedPtr& other) noexcept = default;
+		PinnedPtr(PinnedPtr&& other) noexcept;
+		PinnedPtr& operator=(const PinnedPtr& other) noexcept = default;
+		PinnedPtr& operator=(PinnedPtr&& other) noexcept;
+		~PinnedPtr() = default;
+
+		T& operator*();
+		const T& operator*() const;
+
+		T* operator->();
+		const T* operator->() const;
+
+		explicit operator bool() const noexcept;
+
+		/**
+		 * Unlike SharedPtr::Raw, stays valid for as long as the object is alive.
+		 */
+		T* Raw() noexcept;
+		const T* Raw() const noexcept;
+	};
+
+	/**
+	 * PinnedPtr which may be copied and destroyed from any thread.
+	 */
+	template<typename T>
+	using AtomicPinnedPtr = PinnedPtr<T, Memory::AtomicRefCount>;
+}
+
+#include "PinnedPtr.inl"
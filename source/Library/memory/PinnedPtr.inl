@@ -0,0 +1,82 @@
+#pragma once
+#include "PinnedPtr.h"
+
+namespace Library
+{
+#pragma region special members
+	template<typename T, Concept::RefCount RefCount>
+	PinnedPtr<T, RefCount>::PinnedPtr(typename SmartPtr<T>::Handle& handle) noexcept :
+		Base(handle),
+		ptr(handle.ptr) {}
+
+	template<typename T, Concept::RefCount RefCount>
+	PinnedPtr<T, RefCount>::PinnedPtr(nullptr_t) noexcept :
+		Base(nullptr) {}
+
+	template<typename T, Concept::RefCount RefCount>
+	PinnedPtr<T, RefCount>::PinnedPtr(PinnedPtr&& other) noexcept :
+		Base(std::move(other)),
+		ptr(other.ptr)
+	{
+		other.ptr = nullptr;
+	}
+
+	template<typename T, Concept::RefCount RefCount>
+	PinnedPtr<T, RefCount>& PinnedPtr<T, RefCount>::operator=(PinnedPtr&& other) noexcept
+	{
+		if (this != &other)
+		{
+			Base::operator=(std::move(other));
+			ptr = other.ptr;
+			other.ptr = nullptr;
+		}
+		return *this;
+	}
+#pragma endregion
+
+	template<typename T, Concept::RefCount RefCount>
+	T& PinnedPtr<T, RefCount>::operator*()
+	{
+		if (ptr)
+		{
+			return *ptr;
+		}
+		throw NullReferenceException();
+	}
+
+	template<typename T, Concept::RefCount RefCount>
+	const T& PinnedPtr<T, RefCount>::operator*() const
+	{
+		return const_cast<PinnedPtr*>(this)->operator*();
+	}
+
+	template<typename T, Concept::RefCount RefCount>
+	T* PinnedPtr<T, RefCount>::operator->()
+	{
+		return &operator*();
+	}
+
+	template<typename T, Concept::RefCount RefCount>
+	const T* PinnedPtr<T, RefCount>::operator->() const
+	{
+		return const_cast<PinnedPtr*>(this)->operator->();
+	}
+
+	template<typename T, Concept::RefCount RefCount>
+	PinnedPtr<T, RefCount>::operator bool() const noexcept
+	{
+		return ptr;
+	}
+
+	template<typename T, Concept::RefCount RefCount>
+	T* PinnedPtr<T, RefCount>::Raw() noexcept
+	{
+		return ptr;
+	}
+
+	template<typename T, Concept::RefCount RefCount>
+	const T* PinnedPtr<T, RefCount>::Raw() const noexcept
+	{
+		return ptr;
+	}
+}
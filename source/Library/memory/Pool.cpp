@@ -0,0 +1,119 @@
+#include "pch.h"
+#include "Pool.h"
+
+#include "Memory.h"
+
+namespace Library::Memory
+{
+	thread_local Pool::ThreadCache Pool::cache{};
+	thread_local bool Pool::cacheTornDown{ false };
+	std::array<Pool::FreeList, Pool::numClasses> Pool::depot{};
+	std::mutex Pool::depotMutex{};
+
+#pragma region FreeList
+	void Pool::FreeList::Push(FreeBlock* block) noexcept
+	{
+		block->next = head;
+		head = block;
+		size++;
+	}
+
+	Pool::FreeBlock* Pool::FreeList::Pop() noexcept
+	{
+		FreeBlock* ret = head;
+		head = ret->next;
+		size--;
+		return ret;
+	}
+
+	void Pool::FreeList::MoveTo(FreeList& other, size_t count) noexcept
+	{
+		while (head && count--)
+		{
+			other.Push(Pop());
+		}
+	}
+#pragma endregion
+
+	Pool::ThreadCache::~ThreadCache() noexcept
+	{
+		std::scoped_lock lock(depotMutex);
+		for (size_t i = 0; i < numClasses; ++i)
+		{
+			lists[i].MoveTo(depot[i], lists[i].size);
+		}
+		cacheTornDown = true;
+	}
+
+	void* Pool::Alloc(const size_t numBytes) noexcept
+	{
+		assertm(numBytes <= maxBlockSize, "too big to pool");
+		const size_t sizeClass = SizeClass(numBytes);
+		if (cacheTornDown) [[unlikely]]
+		{
+			FreeList one{};
+			Refill(one, sizeClass, 1);
+			return one.Pop();
+		}
+
+		FreeList& list = cache.lists[sizeClass];
+		if (!list.head) [[unlikely]]
+		{
+			Refill(list, sizeClass, batchSize);
+		}
+		return list.Pop();
+	}
+
+	void Pool::Free(void* block, const size_t numBytes) noexcept
+	{
+		if (!block)
+		{
+			return;
+		}
+
+		const size_t sizeClass = SizeClass(numBytes);
+		if (cacheTornDown) [[unlikely]]
+		{
+			std::scoped_lock lock(depotMutex);
+			depot[sizeClass].Push(reinterpret_cast<FreeBlock*>(block));
+			return;
+		}
+		FreeList& list = cache.lists[sizeClass];
+
+		// Share a batch once this thread has two on hand.
+		// Otherwise a thread which only ever frees what another allocates would hoard it all.
+		if (list.size >= 2 * batchSize) [[unlikely]]
+		{
+			std::scoped_lock lock(depotMutex);
+			list.MoveTo(depot[sizeClass], batchSize);
+		}
+		list.Push(reinterpret_cast<FreeBlock*>(block));
+	}
+
+	void Pool::Refill(FreeList& list, const size_t sizeClass, const size_t count) noexcept
+	{
+		{
+			std::scoped_lock lock(depotMutex);
+			depot[sizeClass].MoveTo(list, count);
+		}
+		if (list.head)
+		{
+			return;
+		}
+
+		// Nobody has any to spare, carve up a new slab.
+		// The list gets its count and the rest goes to the depot.
+		const size_t blockSize = (sizeClass + 1) * granularity;
+		std::byte* slab = Malloc<std::byte>(slabSize);
+		FreeList carved{};
+		for (std::byte* block = slab + slabSize - slabSize % blockSize; block != slab;)
+		{
+			block -= blockSize;
+			carved.Push(reinterpret_cast<FreeBlock*>(block));
+		}
+		carved.MoveTo(list, count);
+
+		std::scoped_lock lock(depotMutex);
+		carved.MoveTo(depot[sizeClass], carved.size);
+	}
+}
@@ -0,0 +1,111 @@
+// MIT License Copyright (c) 2020 Jarrett Wendt
+
+#pragma once
+#include <array>
+#include <cstddef>
+#include <mutex>
+
+#include "Macros.h"
+
+namespace Library::Memory
+{
+	/**
+	 * Allocator for small fixed-size blocks, such as container nodes.
+	 *
+	 * Blocks are grouped into size classes, each a multiple of granularity.
+	 * Every thread keeps its own free list per size class, so Alloc and Free never synchronize in the common case.
+	 * Threads only touch the shared depot to trade batches of blocks, when their list runs dry or grows too long.
+	 * Blocks are carved out of big slabs which are kept for the life of the process.
+	 */
+	class Pool final
+	{
+	public:
+		// Every block size is a multiple of this, which is also the alignment of every block.
+		constexpr static size_t granularity = alignof(std::max_align_t);
+		// Anything bigger than this should come from somewhere else.
+		constexpr static size_t maxBlockSize = 256;
+
+	private:
+		constexpr static size_t numClasses = maxBlockSize / granularity;
+		constexpr static size_t slabSize = 64 << 10;
+		// How many blocks move between a thread and the depot at once.
+		constexpr static size_t batchSize = 64;
+
+		struct FreeBlock final
+		{
+			FreeBlock* next;
+		};
+
+		struct FreeList final
+		{
+			FreeBlock* head{ nullptr };
+			size_t size{ 0 };
+
+			void Push(FreeBlock* block) noexcept;
+			FreeBlock* Pop() noexcept;
+
+			/**
+			 * O(count)
+			 *
+			 * Moves up to count blocks from this list to other.
+			 */
+			void MoveTo(FreeList& other, size_t count) noexcept;
+		};
+
+		/**
+		 * The calling thread's free lists.
+		 * Whatever's left in them when the thread exits goes to the depot, as does anything freed by thread_locals and statics destroyed after it.
+		 */
+		struct ThreadCache final
+		{
+			std::array<FreeList, numClasses> lists{};
+
+			ThreadCache() noexcept = default;
+			MOVE_COPY(ThreadCache, delete)
+			~ThreadCache() noexcept;
+		};
+
+		static thread_local ThreadCache cache;
+		// Set once cache has been destroyed. Trivially destructible, so it can still be read until the thread's storage is released.
+		static thread_local bool cacheTornDown;
+
+		static std::array<FreeList, numClasses> depot;
+		static std::mutex depotMutex;
+
+	public:
+		STATIC_CLASS(Pool)
+
+		/**
+		 * @returns		whether a block of this size and alignment can come from the Pool
+		 */
+		static constexpr bool CanPool(size_t numBytes, size_t alignment) noexcept;
+
+		/**
+		 * Amortized O(1)
+		 *
+		 * @param numBytes	size of the block, must satisfy CanPool
+		 * @returns			a block of at least numBytes aligned to granularity
+		 */
+		[[nodiscard]] static void* Alloc(size_t numBytes) noexcept;
+
+		/**
+		 * Amortized O(1)
+		 *
+		 * Gives a block back to the calling thread's free lists, no matter which thread allocated it.
+		 *
+		 * @param block		a block returned by Alloc
+		 * @param numBytes	the same number of bytes that was passed to Alloc
+		 */
+		static void Free(void* block, size_t numBytes) noexcept;
+
+	private:
+		static constexpr size_t SizeClass(size_t numBytes) noexcept;
+
+		/**
+		 * Fills an empty free list with up to count blocks from the depot, or from a new slab if the depot has nothing.
+		 */
+		static void Refill(FreeList& list, size_t sizeClass, size_t count) noexcept;
+	};
+}
+
+#include "Pool.inl"
@@ -0,0 +1,15 @@
+#pragma once
+#include "Pool.h"
+
+namespace Library::Memory
+{
+	constexpr bool Pool::CanPool(const size_t numBytes, const size_t alignment) noexcept
+	{
+		return numBytes <= maxBlockSize && alignment <= granularity;
+	}
+
+	constexpr size_t Pool::SizeClass(const size_t numBytes) noexcept
+	{
+		return numBytes ? (numBytes - 1) / granularity : 0;
+	}
+}
@@ -0,0 +1,233 @@
+#include "pch.h"
+#include "Profiler.h"
+
+#include <array>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+
+#ifdef _WIN32
+#include <Windows.h>
+#include <DbgHelp.h>
+#pragma comment(lib, "Dbghelp.lib")
+#else
+#include <cxxabi.h>
+#include <dlfcn.h>
+#include <execinfo.h>
+#endif
+
+namespace Library::Memory
+{
+	struct Sample final
+	{
+		std::array<void*, Profiler::maxDepth> stack{};
+		size_t depth{ 0 };
+		size_t numBytes{ 0 };
+		/** the sample interval when this was recorded, so it can be scaled up even after Stop */
+		size_t interval{ 0 };
+	};
+
+	struct Profiler::State final
+	{
+		std::mutex mutex{};
+		std::array<std::unordered_map<std::uintptr_t, Sample>, 3> samples{};
+
+		State() noexcept = default;
+		MOVE_COPY(State, delete)
+
+		// anything freed during static destruction must not come looking for the samples
+		~State() noexcept
+		{
+			sampleInterval.store(0, std::memory_order_relaxed);
+			numLive.store(0, std::memory_order_relaxed);
+		}
+	};
+
+	/**
+	 * Marks the calling thread busy for as long as it lives.
+	 * The Profiler must not record its own allocations, and must not reenter while holding its mutex.
+	 */
+	struct BusyScope final
+	{
+		bool& busy;
+		const bool wasBusy;
+
+		explicit BusyScope(bool& busy) noexcept : busy(busy), wasBusy(busy)
+		{
+			busy = true;
+		}
+
+		MOVE_COPY(BusyScope, delete)
+
+		~BusyScope() noexcept
+		{
+			busy = wasBusy;
+		}
+	};
+
+	void Profiler::Start(const size_t interval) noexcept
+	{
+		assertm(interval != 0, "a sample interval of 0 would never sample");
+		{
+			BusyScope scope(busy);
+			GetState();
+		}
+		sampleInterval.store(interval, std::memory_order_relaxed);
+	}
+
+	void Profiler::Stop() noexcept
+	{
+		sampleInterval.store(0, std::memory_order_relaxed);
+	}
+
+	void Profiler::Clear() noexcept
+	{
+		BusyScope scope(busy);
+		State& state = GetState();
+		std::scoped_lock lock(state.mutex);
+		for (auto& samples : state.samples)
+		{
+			samples.clear();
+		}
+		numLive.store(0, std::memory_order_relaxed);
+	}
+
+	std::vector<Profiler::Site> Profiler::LiveSites()
+	{
+		BusyScope scope(busy);
+		State& state = GetState();
+
+		std::map<std::vector<void*>, Site> sites{};
+		{
+			std::scoped_lock lock(state.mutex);
+			for (const auto& samples : state.samples)
+			{
+				for (const auto& [address, sample] : samples)
+				{
+					std::vector<void*> stack(sample.stack.begin(), sample.stack.begin() + sample.depth);
+					Site& site = sites[stack];
+					site.numSamples++;
+					site.numBytes += sample.numBytes;
+					site.estimatedBytes += sample.numBytes * sample.interval;
+				}
+			}
+		}
+
+		std::vector<Site> ret{};
+		ret.reserve(sites.size());
+		for (auto& [stack, site] : sites)
+		{
+			site.stack = stack;
+			ret.push_back(std::move(site));
+		}
+		std::sort(ret.begin(), ret.end(), [](const Site& a, const Site& b) { return a.numBytes > b.numBytes; });
+		return ret;
+	}
+
+	void Profiler::WriteFolded(std::ostream& stream)
+	{
+		const std::vector<Site> sites = LiveSites();
+
+		BusyScope scope(busy);
+		for (const Site& site : sites)
+		{
+			for (auto it = site.stack.rbegin(); it != site.stack.rend(); ++it)
+			{
+				std::string frame = Symbolize(*it);
+				// the format uses ; between frames
+				std::replace(frame.begin(), frame.end(), ';', ':');
+				stream << frame << (it + 1 == site.stack.rend() ? ' ' : ';');
+			}
+			stream << site.estimatedBytes << '\n';
+		}
+	}
+
+	std::string Profiler::Symbolize(void* address)
+	{
+		BusyScope scope(busy);
+		std::stringstream ret{};
+#ifdef _WIN32
+		static const bool initialized = SymInitialize(GetCurrentProcess(), nullptr, TRUE);
+		std::array<std::byte, sizeof(SYMBOL_INFO) + MAX_SYM_NAME> buffer{};
+		auto* symbol = reinterpret_cast<SYMBOL_INFO*>(buffer.data());
+		symbol->SizeOfStruct = sizeof(SYMBOL_INFO);
+		symbol->MaxNameLen = MAX_SYM_NAME;
+		if (initialized && SymFromAddr(GetCurrentProcess(), DWORD64(address), nullptr, symbol))
+		{
+			ret << symbol->Name;
+		}
+		else
+		{
+			ret << address;
+		}
+#else
+		Dl_info info{};
+		if (!dladdr(address, &info))
+		{
+			ret << address;
+		}
+		else if (info.dli_sname)
+		{
+			int status = 0;
+			char* demangled = abi::__cxa_demangle(info.dli_sname, nullptr, nullptr, &status);
+			ret << (status == 0 ? demangled : info.dli_sname);
+			std::free(demangled);
+		}
+		else
+		{
+			const std::string module = info.dli_fname ? info.dli_fname : "?";
+			ret << module.substr(module.find_last_of('/') + 1) << "+0x" << std::hex << size_t(address) - size_t(info.dli_fbase);
+		}
+#endif
+		return ret.str();
+	}
+
+	Profiler::State& Profiler::GetState() noexcept
+	{
+		static State state{};
+		return state;
+	}
+
+	void Profiler::Record(const Source source, const std::uintptr_t address, const size_t numBytes) noexcept
+	{
+		BusyScope scope(busy);
+		Sample sample{};
+		sample.depth = CaptureStack(sample.stack.data(), maxDepth);
+		sample.numBytes = numBytes;
+		sample.interval = sampleInterval.load(std::memory_order_relaxed);
+
+		State& state = GetState();
+		std::scoped_lock lock(state.mutex);
+		if (state.samples[size_t(source)].insert_or_assign(address, sample).second)
+		{
+			numLive.fetch_add(1, std::memory_order_relaxed);
+		}
+	}
+
+	void Profiler::Forget(const Source source, const std::uintptr_t address) noexcept
+	{
+		BusyScope scope(busy);
+		State& state = GetState();
+		std::scoped_lock lock(state.mutex);
+		if (state.samples[size_t(source)].erase(address))
+		{
+			numLive.fetch_sub(1, std::memory_order_relaxed);
+		}
+	}
+
+	size_t Profiler::CaptureStack(void** stack, const size_t depth) noexcept
+	{
+		// CaptureStack and Record aren't interesting
+		constexpr size_t skip = 2;
+#ifdef _WIN32
+		return CaptureStackBackTrace(DWORD(skip), DWORD(depth), stack, nullptr);
+#else
+		std::array<void*, maxDepth + skip> frames{};
+		const size_t numFrames = size_t(backtrace(frames.data(), int(std::min(depth + skip, frames.size()))));
+		const size_t ret = numFrames > skip ? numFrames - skip : 0;
+		std::copy_n(frames.begin() + skip, ret, stack);
+		return ret;
+#endif
+	}
+}
@@ -0,0 +1,165 @@
+// MIT License Copyright (c) 2020 Jarrett Wendt
+
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "Macros.h"
+
+namespace Library::Memory
+{
+	/**
+	 * Sampling allocation profiler, usable in release builds.
+	 *
+	 * While running, every Nth allocation made through Malloc, Manager::Alloc or an Allocator has its call stack recorded.
+	 * Samples are forgotten once their memory is freed, so whatever's left are the live allocations, grouped by call stack.
+	 * When stopped, the hooks cost a relaxed atomic load per allocation, and another per free while any samples are still live.
+	 */
+	class Profiler final
+	{
+	public:
+		/**
+		 * Which hook an allocation came through.
+		 * Each is tracked separately since, for example, a Pool block can start at the same address as the Malloc'd slab it was carved from.
+		 */
+		enum class Source : uint8_t
+		{
+			Malloc,
+			Manager,
+			Allocator
+		};
+
+		/**
+		 * Every live sampled allocation made from the same call stack.
+		 */
+		struct Site final
+		{
+			/** return addresses, innermost first */
+			std::vector<void*> stack{};
+			/** how many sampled allocations are still live */
+			size_t numSamples{ 0 };
+			/** how many bytes the sampled allocations hold */
+			size_t numBytes{ 0 };
+			/** numBytes scaled up by the sample interval, an estimate of how much this site really holds */
+			size_t estimatedBytes{ 0 };
+		};
+
+		constexpr static size_t maxDepth = 32;
+
+	private:
+		struct State;
+
+		/** 0 while stopped */
+		static inline std::atomic<size_t> sampleInterval{ 0 };
+		static inline std::atomic<size_t> numLive{ 0 };
+
+		/** allocations made by this thread since its last sample */
+		static inline thread_local size_t counter{ 0 };
+		/** set while the Profiler itself is running, so its own allocations aren't recorded */
+		static inline thread_local bool busy{ false };
+
+	public:
+		STATIC_CLASS(Profiler)
+
+		/**
+		 * Starts sampling every interval'th allocation on each thread.
+		 * Samples from a previous run are kept.
+		 * O(1)
+		 *
+		 * @param interval	1 records every allocation
+		 */
+		static void Start(size_t interval) noexcept;
+
+		/**
+		 * Stops taking new samples.
+		 * The live ones are still forgotten as they're freed, so reports stay accurate.
+		 * O(1)
+		 */
+		static void Stop() noexcept;
+
+		/**
+		 * Forgets every sample.
+		 * O(n) where n is the number of live samples
+		 */
+		static void Clear() noexcept;
+
+		/**
+		 * O(1)
+		 *
+		 * @returns		whether allocations are being sampled
+		 */
+		static bool IsRunning() noexcept;
+
+		/**
+		 * O(1)
+		 *
+		 * @returns		how many sampled allocations are still live
+		 */
+		static size_t NumLive() noexcept;
+
+		/**
+		 * O(n) where n is the number of live samples
+		 *
+		 * @returns		live samples grouped by call stack, the most bytes first
+		 */
+		static std::vector<Site> LiveSites();
+
+		/**
+		 * Writes the live sites in folded stack format, one per line: outermost;...;innermost estimatedBytes
+		 * Feed it to flamegraph.pl or speedscope for a flame graph of where memory is held.
+		 * O(n) where n is the number of live samples
+		 *
+		 * @param stream	where to write
+		 */
+		static void WriteFolded(std::ostream& stream);
+
+		/**
+		 * Frames without a symbol, such as static functions in an executable which doesn't export them, come out as module+0xoffset.
+		 * Those can be resolved afterwards with addr2line or llvm-symbolizer.
+		 *
+		 * @param address	a return address from a Site's stack
+		 * @returns			a human readable name for address
+		 */
+		static std::string Symbolize(void* address);
+
+		/**
+		 * Called on every allocation.
+		 * O(1) unless this is a sampled allocation, then O(d) where d is the depth of the stack
+		 *
+		 * @param source	which hook the allocation came through
+		 * @param address	the allocation, only ever used as a key
+		 * @param numBytes	its size
+		 */
+		static void OnAlloc(Source source, std::uintptr_t address, size_t numBytes) noexcept;
+
+		/**
+		 * Called on every free.
+		 * O(1)
+		 *
+		 * @param source	which hook the allocation came through
+		 * @param address	the allocation, the same address OnAlloc was given
+		 */
+		static void OnFree(Source source, std::uintptr_t address) noexcept;
+
+	private:
+		/**
+		 * Constructed the first time it's needed, which is after Start.
+		 */
+		static State& GetState() noexcept;
+
+		static void Record(Source source, std::uintptr_t address, size_t numBytes) noexcept;
+		static void Forget(Source source, std::uintptr_t address) noexcept;
+
+		/**
+		 * @param stack		filled with return addresses, innermost first
+		 * @returns			how many were written
+		 */
+		static size_t CaptureStack(void** stack, size_t depth) noexcept;
+	};
+}
+
+#include "Profiler.inl"
@@ -0,0 +1,35 @@
+#pragma once
+#include "Profiler.h"
+
+namespace Library::Memory
+{
+	inline bool Profiler::IsRunning() noexcept
+	{
+		return sampleInterval.load(std::memory_order_relaxed) != 0;
+	}
+
+	inline size_t Profiler::NumLive() noexcept
+	{
+		return numLive.load(std::memory_order_relaxed);
+	}
+
+	inline void Profiler::OnAlloc(const Source source, const std::uintptr_t address, const size_t numBytes) noexcept
+	{
+		if (const size_t interval = sampleInterval.load(std::memory_order_relaxed); interval != 0 && address) [[unlikely]]
+		{
+			if (!busy && ++counter >= interval)
+			{
+				counter = 0;
+				Record(source, address, numBytes);
+			}
+		}
+	}
+
+	inline void Profiler::OnFree(const Source source, const std::uintptr_t address) noexcept
+	{
+		if (numLive.load(std::memory_order_relaxed) != 0 && address && !busy) [[unlikely]]
+		{
+			Forget(source, address);
+		}
+	}
+}
@@ -0,0 +1,83 @@
+#pragma once
+#include <atomic>
+#include <concepts>
+
+#include "Macros.h"
+
+namespace Library::Concept
+{
+	/**
+	 * How SharedPtr and WeakPtr update the counts in their Handle.
+	 */
+	template<typename T>
+	concept RefCount = requires(uint32_t& count, uint32_t step)
+	{
+		T::Increment(count, step);
+		{ T::Decrement(count, step) }->std::convertible_to<uint32_t>;
+		{ T::Load(count) }->std::convertible_to<uint32_t>;
+		{ T::IncrementIfNonZero(count) }->std::convertible_to<bool>;
+		{ T::Release(count) }->std::convertible_to<bool>;
+	};
+}
+
+namespace Library::Memory
+{
+	/**
+	 * What a shared count holds while the last SharedPtr is destroying its object.
+	 * Still reads as used to Memory::Manager, so the bytes stay put until the destructor returns, but can't be incremented.
+	 * The SharedPtr Decrements it by this much once the object is gone.
+	 */
+	inline constexpr uint32_t destroyingCount = uint32_t(1) << 31;
+
+	/**
+	 * Plain arithmetic, for SmartPtrs which never leave the thread that made them.
+	 * This is the default since it's the fastest.
+	 */
+	struct NonAtomicRefCount final
+	{
+		STATIC_CLASS(NonAtomicRefCount)
+		
+		static void Increment(uint32_t& count, uint32_t step = 1) noexcept;
+
+		/**
+		 * @returns		the count after decrementing
+		 */
+		static uint32_t Decrement(uint32_t& count, uint32_t step = 1) noexcept;
+
+		static uint32_t Load(uint32_t& count) noexcept;
+
+		/**
+		 * Increments by 1 unless count is 0 or destroyingCount.
+		 *
+		 * @returns		whether count was incremented
+		 */
+		static bool IncrementIfNonZero(uint32_t& count) noexcept;
+
+		/**
+		 * Decrements a shared count by 1, unless that would take it to 0, in which case it becomes destroyingCount.
+		 *
+		 * @returns		whether that was the last reference
+		 */
+		static bool Release(uint32_t& count) noexcept;
+	};
+
+	/**
+	 * Atomic arithmetic, for SmartPtrs which are shared between threads.
+	 * The Handle is laid out the same either way, the counts are accessed through std::atomic_ref.
+	 * Incrementing is relaxed since the caller must already hold a reference to copy it.
+	 * Decrementing is acquire-release so whoever destroys the object sees every other thread's writes to it,
+	 * and Load is acquire so Memory::Manager sees everything the destructor wrote before reusing its bytes.
+	 */
+	struct AtomicRefCount final
+	{
+		STATIC_CLASS(AtomicRefCount)
+		
+		static void Increment(uint32_t& count, uint32_t step = 1) noexcept;
+		static uint32_t Decrement(uint32_t& count, uint32_t step = 1) noexcept;
+		static uint32_t Load(uint32_t& count) noexcept;
+		static bool IncrementIfNonZero(uint32_t& count) noexcept;
+		static bool Release(uint32_t& count) noexcept;
+	};
+}
+
+#include "RefCount.inl"
@@ -0,0 +1,83 @@
+#pragma once
+#include "RefCount.h"
+
+namespace Library::Memory
+{
+#pragma region NonAtomicRefCount
+	inline void NonAtomicRefCount::Increment(uint32_t& count, const uint32_t step) noexcept
+	{
+		count += step;
+	}
+
+	inline uint32_t NonAtomicRefCount::Decrement(uint32_t& count, const uint32_t step) noexcept
+	{
+		return count -= step;
+	}
+
+	inline uint32_t NonAtomicRefCount::Load(uint32_t& count) noexcept
+	{
+		return count;
+	}
+
+	inline bool NonAtomicRefCount::IncrementIfNonZero(uint32_t& count) noexcept
+	{
+		if (!count || count & destroyingCount)
+		{
+			return false;
+		}
+		++count;
+		return true;
+	}
+
+	inline bool NonAtomicRefCount::Release(uint32_t& count) noexcept
+	{
+		if (count == 1)
+		{
+			count = destroyingCount;
+			return true;
+		}
+		--count;
+		return false;
+	}
+#pragma endregion
+
+#pragma region AtomicRefCount
+	inline void AtomicRefCount::Increment(uint32_t& count, const uint32_t step) noexcept
+	{
+		std::atomic_ref(count).fetch_add(step, std::memory_order_relaxed);
+	}
+
+	inline uint32_t AtomicRefCount::Decrement(uint32_t& count, const uint32_t step) noexcept
+	{
+		return std::atomic_ref(count).fetch_sub(step, std::memory_order_acq_rel) - step;
+	}
+
+	inline uint32_t AtomicRefCount::Load(uint32_t& count) noexcept
+	{
+		return std::atomic_ref(count).load(std::memory_order_acquire);
+	}
+
+	inline bool AtomicRefCount::IncrementIfNonZero(uint32_t& count) noexcept
+	{
+		std::atomic_ref ref(count);
+		uint32_t expected = ref.load(std::memory_order_relaxed);
+		do
+		{
+			if (!expected || expected & destroyingCount)
+			{
+				return false;
+			}
+		} while (!ref.compare_exchange_weak(expected, expected + 1, std::memory_order_relaxed));
+		return true;
+	}
+
+	inline bool AtomicRefCount::Release(uint32_t& count) noexcept
+	{
+		std::atomic_ref ref(count);
+		uint32_t expected = ref.load(std::memory_order_relaxed);
+		// A WeakPtr on another thread may take it from 1 back up to 2 in the meantime, hence compare-exchange rather than fetch_sub.
+		while (!ref.compare_exchange_weak(expected, expected == 1 ? destroyingCount : expected - 1, std::memory_order_acq_rel, std::memory_order_relaxed)) {}
+		return expected == 1;
+	}
+#pragma endregion
+}
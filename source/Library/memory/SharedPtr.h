@@ -1,33 +1,49 @@
 #pragma once
+#include <memory>
+#include <span>
+
 #include "Concept.h"
 #include "Manager.h"
+#include "RefCount.h"
 #include "SmartPtr.h"
+#include "Util.h"
 
 namespace Library
 {
+	template<typename Derived, Concept::RefCount RefCount>
+	class EnableSharedFromThis;
+
+	template<typename T, Concept::RefCount RefCount>
+	class PinnedPtr;
+	
 	/**
 	 * Reference counted SmartPtr.
 	 * RAII on destruction.
+	 *
+	 * @param <T>			type this pointer references
+	 * @param <RefCount>	how the reference counts are updated, use Memory::AtomicRefCount to share between threads
 	 */
-	template<typename T>
+	template<typename T, Concept::RefCount RefCount = Memory::NonAtomicRefCount>
 	class SharedPtr : public SmartPtr<T>
 	{
 		using Base = SmartPtr<T>;
 
+		friend PinnedPtr<T, RefCount>;
+
 		explicit SharedPtr(typename Base::Handle& handle) noexcept;
 		
 	public:
 		SharedPtr(nullptr_t) noexcept;
 
 		template<Concept::Related<T> U>
-		SharedPtr(const SharedPtr<U>& other) noexcept;
+		SharedPtr(const SharedPtr<U, RefCount>& other) noexcept;
 		template<Concept::Related<T> U>
-		SharedPtr(SharedPtr<U>&& other) noexcept;
+		SharedPtr(SharedPtr<U, RefCount>&& other) noexcept;
 		
 		template<Concept::Related<T> U>
-		SharedPtr& operator=(const SharedPtr<U>& other) noexcept;
+		SharedPtr& operator=(const SharedPtr<U, RefCount>& other) noexcept;
 		template<Concept::Related<T> U>
-		SharedPtr& operator=(SharedPtr<U>&& other) noexcept;
+		SharedPtr& operator=(SharedPtr<U, RefCount>&& other) noexcept;
 		
 		SharedPtr() noexcept = default;
 		SharedPtr(const SharedPtr& other) noexcept;
@@ -51,7 +67,117 @@ namespace Library
 		{
 			return SharedPtr(Memory::Manager::Emplace<T>(std::forward<Args>(args)...));
 		}
+
+		/**
+		 * Shorthand for SharedPtr<T[]>::Make.
+		 */
+		template<typename... Args>
+		static SharedPtr<T[], RefCount> MakeArray(size_t count, const Args&... args);
+
+		/**
+		 * Like Make, but the object is never moved by Memory::Manager.
+		 * Costs a Malloc rather than a bump of the Heap, so it's meant for long-lived objects which are dereferenced often.
+		 *
+		 * @param <Args>	types for arguments to T's ctor
+		 * @param args		value for arguments to T's ctor
+		 * @returns			newly constructed PinnedPtr (not null)
+		 */
+		template<typename... Args>
+		static PinnedPtr<T, RefCount> MakePinned(Args... args);
+	};
+
+	/**
+	 * SharedPtr to a contiguous run of objects behind a single Handle.
+	 * The whole run is allocated, moved by Memory::Manager, and destroyed as one unit,
+	 * so n objects cost one Handle rather than n.
+	 *
+	 * Knows how many objects it points to, so unlike SharedPtr<T> it can't be converted to or from other types.
+	 * operator* and operator-> refer to the first object.
+	 *
+	 * @param <T>			type of each object
+	 * @param <RefCount>	how the reference counts are updated, use Memory::AtomicRefCount to share between threads
+	 */
+	template<typename T, Concept::RefCount RefCount>
+	class SharedPtr<T[], RefCount> : public SmartPtr<T>
+	{
+		using Base = SmartPtr<T>;
+
+		size_t count{ 0 };
+
+		explicit SharedPtr(typename Base::Handle& handle, size_t count) noexcept;
+
+	public:
+		using value_type = T;
+		using iterator = T*;
+		using const_iterator = const T*;
+
+		SharedPtr(nullptr_t) noexcept;
+
+		SharedPtr() noexcept = default;
+		SharedPtr(const SharedPtr& other) noexcept;
+		SharedPtr(SharedPtr&& other) noexcept;
+		SharedPtr& operator=(const SharedPtr& other) noexcept;
+		SharedPtr& operator=(SharedPtr&& other) noexcept;
+		~SharedPtr();
+
+#pragma region properties
+		/**
+		 * @returns		how many objects this points to, 0 if null
+		 */
+		[[nodiscard]] size_t Size() const noexcept;
+
+		[[nodiscard]] bool IsEmpty() const noexcept;
+#pragma endregion
+
+#pragma region element access
+		/**
+		 * @param index		position of the object to return
+		 * @returns			reference to the requested object
+		 *
+		 * @throws std::out_of_range	if index >= Size()
+		 */
+		[[nodiscard]] T& operator[](size_t index);
+		[[nodiscard]] const T& operator[](size_t index) const;
+
+		/**
+		 * Only valid until the next Defrag or Graduate of the Heap these objects live in, same as Raw.
+		 *
+		 * @returns		view of every object
+		 */
+		[[nodiscard]] std::span<T> Span() noexcept;
+		[[nodiscard]] std::span<const T> Span() const noexcept;
+#pragma endregion
+
+#pragma region iterators
+		[[nodiscard]] iterator begin() noexcept;
+		[[nodiscard]] const_iterator begin() const noexcept;
+		[[nodiscard]] iterator end() noexcept;
+		[[nodiscard]] const_iterator end() const noexcept;
+#pragma endregion
+
+		/**
+		 * O(count)
+		 *
+		 * Factory for instantiating count objects in a single allocation.
+		 * If any constructor throws the objects already constructed are destroyed.
+		 *
+		 * @param count		how many objects to construct
+		 * @param args		arguments given to every object's ctor, each object is value-initialized if there are none
+		 * @returns			newly constructed SharedPtr (not null, even if count is 0)
+		 */
+		template<typename... Args>
+		static SharedPtr Make(size_t count, const Args&... args);
 	};
+
+	/**
+	 * SharedPtr which may be copied and destroyed from any thread.
+	 */
+	template<typename T>
+	using AtomicSharedPtr = SharedPtr<T, Memory::AtomicRefCount>;
+
+	template<typename T, Concept::RefCount RefCount>
+	struct Util::IsTriviallyRelocatable<SharedPtr<T, RefCount>> : std::true_type {};
 }
 
 #include "SharedPtr.inl"
+#include "PinnedPtr.h"
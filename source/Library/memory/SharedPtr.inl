@@ -4,54 +4,54 @@
 namespace Library
 {
 #pragma region special members
-	template <typename T>
-	SharedPtr<T>::SharedPtr(typename Base::Handle& handle) noexcept :
+	template<typename T, Concept::RefCount RefCount>
+	SharedPtr<T, RefCount>::SharedPtr(typename Base::Handle& handle) noexcept :
 		Base(handle)
 	{
-		if constexpr (std::derived_from<T, EnableSharedFromThis<T>>)
+		if constexpr (std::derived_from<T, EnableSharedFromThis<T, RefCount>>)
 		{
 			reinterpret_cast<SharedPtr&>(handle.ptr->weakThis).handle = &handle;
-			++handle.weakCount;
+			RefCount::Increment(handle.weakCountAndAlignment, Base::Handle::weakOne);
 		}
-		++handle.sharedCount;
+		RefCount::Increment(handle.sharedCount);
 	}
 
-	template<typename T>
-	SharedPtr<T>::SharedPtr(nullptr_t) noexcept :
+	template<typename T, Concept::RefCount RefCount>
+	SharedPtr<T, RefCount>::SharedPtr(nullptr_t) noexcept :
 		Base() {}
 
-	template<typename T>
+	template<typename T, Concept::RefCount RefCount>
 	template<Concept::Related<T> U>
-	SharedPtr<T>::SharedPtr(const SharedPtr<U>& other) noexcept :
+	SharedPtr<T, RefCount>::SharedPtr(const SharedPtr<U, RefCount>& other) noexcept :
 		Base(reinterpret_cast<const SharedPtr&>(other))
 	{
 		if (this->handle)
 		{
-			++this->handle->sharedCount;
+			RefCount::Increment(this->handle->sharedCount);
 		}
 	}
 
-	template<typename T>
+	template<typename T, Concept::RefCount RefCount>
 	template<Concept::Related<T> U>
-	SharedPtr<T>::SharedPtr(SharedPtr<U>&& other) noexcept :
+	SharedPtr<T, RefCount>::SharedPtr(SharedPtr<U, RefCount>&& other) noexcept :
 		Base(std::move(reinterpret_cast<SharedPtr&&>(other))) {}
 	
-	template<typename T>
+	template<typename T, Concept::RefCount RefCount>
 	template<Concept::Related<T> U>
-	SharedPtr<T>& SharedPtr<T>::operator=(const SharedPtr<U>& other) noexcept
+	SharedPtr<T, RefCount>& SharedPtr<T, RefCount>::operator=(const SharedPtr<U, RefCount>& other) noexcept
 	{
 		this->~SharedPtr();
 		this->handle = reinterpret_cast<const SharedPtr&>(other).handle;
 		if (this->handle)
 		{
-			++this->handle->sharedCount;
+			RefCount::Increment(this->handle->sharedCount);
 		}
 		return *this;
 	}
 
-	template<typename T>
+	template<typename T, Concept::RefCount RefCount>
 	template<Concept::Related<T> U>
-	SharedPtr<T>& SharedPtr<T>::operator=(SharedPtr<U>&& other) noexcept
+	SharedPtr<T, RefCount>& SharedPtr<T, RefCount>::operator=(SharedPtr<U, RefCount>&& other) noexcept
 	{
 		this->~SharedPtr();
 		auto& handle = reinterpret_cast<SharedPtr&>(other).handle;		
@@ -60,22 +60,22 @@ namespace Library
 		return *this;
 	}
 	
-	template<typename T>
-	SharedPtr<T>::SharedPtr(const SharedPtr& other) noexcept :
+	template<typename T, Concept::RefCount RefCount>
+	SharedPtr<T, RefCount>::SharedPtr(const SharedPtr& other) noexcept :
 		Base(other)
 	{
 		if (this->handle)
 		{
-			++this->handle->sharedCount;
+			RefCount::Increment(this->handle->sharedCount);
 		}
 	}
 
-	template<typename T>
-	SharedPtr<T>::SharedPtr(SharedPtr&& other) noexcept :
+	template<typename T, Concept::RefCount RefCount>
+	SharedPtr<T, RefCount>::SharedPtr(SharedPtr&& other) noexcept :
 		Base(std::move(other)) {}
 
-	template<typename T>
-	SharedPtr<T>& SharedPtr<T>::operator=(const SharedPtr& other) noexcept
+	template<typename T, Concept::RefCount RefCount>
+	SharedPtr<T, RefCount>& SharedPtr<T, RefCount>::operator=(const SharedPtr& other) noexcept
 	{
 		if (this != &other)
 		{
@@ -83,14 +83,14 @@ namespace Library
 			this->handle = other.handle;
 			if (this->handle)
 			{
-				++this->handle->sharedCount;
+				RefCount::Increment(this->handle->sharedCount);
 			}
 		}
 		return *this;
 	}
 
-	template<typename T>
-	SharedPtr<T>& SharedPtr<T>::operator=(SharedPtr&& other) noexcept
+	template<typename T, Concept::RefCount RefCount>
+	SharedPtr<T, RefCount>& SharedPtr<T, RefCount>::operator=(SharedPtr&& other) noexcept
 	{
 		if (this != &other)
 		{
@@ -101,16 +101,18 @@ namespace Library
 		return *this;
 	}
 
-	template<typename T>
-	SharedPtr<T>::~SharedPtr()
+	template<typename T, Concept::RefCount RefCount>
+	SharedPtr<T, RefCount>::~SharedPtr()
 	{
 		if (this->handle)
 		{
-			--this->handle->sharedCount;
-			if (this->handle->sharedCount == 0)
+			if (RefCount::Release(this->handle->sharedCount))
 			{
-				// No need to free the handle's memory, that will be done in Memory::Manager
+				// No need to free the handle's memory, that will be done in Memory::Manager.
+				// It can't do so until the count goes from destroyingCount to 0, which may be on another thread.
 				this->handle->ptr->~T();
+				Memory::Manager::NotifyFreed(this->handle);
+				RefCount::Decrement(this->handle->sharedCount, Memory::destroyingCount);
 #ifdef _DEBUG
 				this->handle = nullptr;
 #endif
@@ -118,4 +120,186 @@ namespace Library
 		}		
 	}
 #pragma endregion
+
+	template<typename T, Concept::RefCount RefCount>
+	template<typename... Args>
+	SharedPtr<T[], RefCount> SharedPtr<T, RefCount>::MakeArray(const size_t count, const Args&... args)
+	{
+		return SharedPtr<T[], RefCount>::Make(count, args...);
+	}
+
+	template<typename T, Concept::RefCount RefCount>
+	template<typename... Args>
+	PinnedPtr<T, RefCount> SharedPtr<T, RefCount>::MakePinned(Args... args)
+	{
+		return PinnedPtr<T, RefCount>(Memory::Manager::EmplacePinned<T>(std::forward<Args>(args)...));
+	}
+
+#pragma region array special members
+	template<typename T, Concept::RefCount RefCount>
+	SharedPtr<T[], RefCount>::SharedPtr(typename Base::Handle& handle, const size_t count) noexcept :
+		Base(handle),
+		count(count)
+	{
+		RefCount::Increment(handle.sharedCount);
+	}
+
+	template<typename T, Concept::RefCount RefCount>
+	SharedPtr<T[], RefCount>::SharedPtr(nullptr_t) noexcept :
+		Base() {}
+
+	template<typename T, Concept::RefCount RefCount>
+	SharedPtr<T[], RefCount>::SharedPtr(const SharedPtr& other) noexcept :
+		Base(other),
+		count(other.count)
+	{
+		if (this->handle)
+		{
+			RefCount::Increment(this->handle->sharedCount);
+		}
+	}
+
+	template<typename T, Concept::RefCount RefCount>
+	SharedPtr<T[], RefCount>::SharedPtr(SharedPtr&& other) noexcept :
+		Base(std::move(other)),
+		count(other.count)
+	{
+		other.count = 0;
+	}
+
+	template<typename T, Concept::RefCount RefCount>
+	SharedPtr<T[], RefCount>& SharedPtr<T[], RefCount>::operator=(const SharedPtr& other) noexcept
+	{
+		if (this != &other)
+		{
+			this->~SharedPtr();
+			this->handle = other.handle;
+			count = other.count;
+			if (this->handle)
+			{
+				RefCount::Increment(this->handle->sharedCount);
+			}
+		}
+		return *this;
+	}
+
+	template<typename T, Concept::RefCount RefCount>
+	SharedPtr<T[], RefCount>& SharedPtr<T[], RefCount>::operator=(SharedPtr&& other) noexcept
+	{
+		if (this != &other)
+		{
+			this->~SharedPtr();
+			this->handle = other.handle;
+			count = other.count;
+			other.handle = nullptr;
+			other.count = 0;
+		}
+		return *this;
+	}
+
+	template<typename T, Concept::RefCount RefCount>
+	SharedPtr<T[], RefCount>::~SharedPtr()
+	{
+		if (this->handle)
+		{
+			if (RefCount::Release(this->handle->sharedCount))
+			{
+				// No need to free the handle's memory, that will be done in Memory::Manager.
+				// It can't do so until the count goes from destroyingCount to 0, which may be on another thread.
+				std::destroy_n(this->handle->ptr, count);
+				Memory::Manager::NotifyFreed(this->handle);
+				RefCount::Decrement(this->handle->sharedCount, Memory::destroyingCount);
+#ifdef _DEBUG
+				this->handle = nullptr;
+#endif
+			}
+		}
+	}
+#pragma endregion
+
+#pragma region array properties
+	template<typename T, Concept::RefCount RefCount>
+	size_t SharedPtr<T[], RefCount>::Size() const noexcept
+	{
+		return this->handle ? count : 0;
+	}
+
+	template<typename T, Concept::RefCount RefCount>
+	bool SharedPtr<T[], RefCount>::IsEmpty() const noexcept
+	{
+		return Size() == 0;
+	}
+#pragma endregion
+
+#pragma region array element access
+	template<typename T, Concept::RefCount RefCount>
+	T& SharedPtr<T[], RefCount>::operator[](const size_t index)
+	{
+		if (index >= Size())
+		{
+			throw std::out_of_range(std::to_string(index) + " is beyond SharedPtr Size() of " + std::to_string(Size()));
+		}
+		return this->Raw()[index];
+	}
+
+	template<typename T, Concept::RefCount RefCount>
+	const T& SharedPtr<T[], RefCount>::operator[](const size_t index) const
+	{
+		return const_cast<SharedPtr*>(this)->operator[](index);
+	}
+
+	template<typename T, Concept::RefCount RefCount>
+	std::span<T> SharedPtr<T[], RefCount>::Span() noexcept
+	{
+		return { begin(), Size() };
+	}
+
+	template<typename T, Concept::RefCount RefCount>
+	std::span<const T> SharedPtr<T[], RefCount>::Span() const noexcept
+	{
+		return { begin(), Size() };
+	}
+#pragma endregion
+
+#pragma region array iterators
+	template<typename T, Concept::RefCount RefCount>
+	typename SharedPtr<T[], RefCount>::iterator SharedPtr<T[], RefCount>::begin() noexcept
+	{
+		return this->Raw();
+	}
+
+	template<typename T, Concept::RefCount RefCount>
+	typename SharedPtr<T[], RefCount>::const_iterator SharedPtr<T[], RefCount>::begin() const noexcept
+	{
+		return this->Raw();
+	}
+
+	template<typename T, Concept::RefCount RefCount>
+	typename SharedPtr<T[], RefCount>::iterator SharedPtr<T[], RefCount>::end() noexcept
+	{
+		return begin() + Size();
+	}
+
+	template<typename T, Concept::RefCount RefCount>
+	typename SharedPtr<T[], RefCount>::const_iterator SharedPtr<T[], RefCount>::end() const noexcept
+	{
+		return begin() + Size();
+	}
+#pragma endregion
+
+	template<typename T, Concept::RefCount RefCount>
+	template<typename... Args>
+	SharedPtr<T[], RefCount> SharedPtr<T[], RefCount>::Make(const size_t count, const Args&... args)
+	{
+		static_assert(!std::derived_from<T, EnableSharedFromThis<T, RefCount>>, "EnableSharedFromThis only works with SharedPtr<T>");
+
+		// Holding a reference while constructing keeps the Manager from reusing these bytes if a ctor allocates.
+		// If a ctor throws, ret's dtor destroys everything constructed so far.
+		SharedPtr ret(Memory::Manager::Alloc<T>(count), 0);
+		for (; ret.count < count; ++ret.count)
+		{
+			new (ret.handle->ptr + ret.count) T(args...);
+		}
+		return ret;
+	}
 }
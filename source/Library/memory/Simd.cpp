@@ -0,0 +1,597 @@
+#include "pch.h"
+#include "Simd.h"
+
+#include <bit>
+#include <cstring>
+
+#include "Macros.h"
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define LIBRARY_X64
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+// lets GCC and Clang emit AVX2 in these functions alone, MSVC doesn't need to be told
+#if defined(__GNUC__) || defined(__clang__)
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define TARGET_AVX2
+#endif
+
+namespace Library::Memory
+{
+#pragma region Detection
+#ifdef LIBRARY_X64
+	/**
+	 * @returns		eax, ebx, ecx, edx
+	 */
+	static std::array<uint32_t, 4> Cpuid(const uint32_t leaf, const uint32_t subleaf = 0) noexcept
+	{
+		std::array<uint32_t, 4> ret{};
+#ifdef _MSC_VER
+		__cpuidex(reinterpret_cast<int*>(ret.data()), int(leaf), int(subleaf));
+#else
+		__cpuid_count(leaf, subleaf, ret[0], ret[1], ret[2], ret[3]);
+#endif
+		return ret;
+	}
+
+	/**
+	 * Walks the deterministic cache parameters, which Intel puts in leaf 4 and AMD in leaf 0x8000001D.
+	 *
+	 * @returns		the size of the highest level cache it finds, or 0 if the leaf isn't supported
+	 */
+	static size_t CacheSize(const uint32_t leaf) noexcept
+	{
+		const uint32_t maxLeaf = Cpuid(leaf & 0x80000000)[0];
+		if (maxLeaf < leaf)
+		{
+			return 0;
+		}
+
+		size_t ret = 0;
+		uint32_t maxLevel = 0;
+		for (uint32_t subleaf = 0; subleaf < 16; ++subleaf)
+		{
+			const auto [eax, ebx, ecx, edx] = Cpuid(leaf, subleaf);
+			const uint32_t type = eax & 0x1F;
+			if (type == 0)
+			{
+				break;
+			}
+			// data and unified caches, instruction caches don't matter here
+			const uint32_t level = (eax >> 5) & 0x7;
+			if (type == 2 || level < maxLevel)
+			{
+				continue;
+			}
+			const size_t ways = ((ebx >> 22) & 0x3FF) + 1;
+			const size_t partitions = ((ebx >> 12) & 0x3FF) + 1;
+			const size_t lineSize = (ebx & 0xFFF) + 1;
+			const size_t sets = size_t(ecx) + 1;
+			maxLevel = level;
+			ret = ways * partitions * lineSize * sets;
+		}
+		return ret;
+	}
+#endif
+
+	Isa DetectIsa() noexcept
+	{
+		static const Isa isa = []
+		{
+#ifdef LIBRARY_X64
+			// the OS has to save the upper halves of the ymm registers on a context switch, otherwise AVX can't be used
+			const bool osxsave = Cpuid(1)[2] & (1 << 27);
+#ifdef _MSC_VER
+			const bool ymmSaved = osxsave && (_xgetbv(0) & 0x6) == 0x6;
+#else
+			uint32_t xcr0 = 0;
+			if (osxsave)
+			{
+				__asm__("xgetbv" : "=a"(xcr0) : "c"(0) : "edx");
+			}
+			const bool ymmSaved = (xcr0 & 0x6) == 0x6;
+#endif
+			const bool avx2 = Cpuid(0)[0] >= 7 && Cpuid(7)[1] & (1 << 5);
+			// SSE2 is part of x86-64
+			return ymmSaved && avx2 ? Isa::AVX2 : Isa::SSE2;
+#else
+			return Isa::Scalar;
+#endif
+		}();
+		return isa;
+	}
+
+	size_t CacheSize() noexcept
+	{
+		static const size_t cacheSize = []
+		{
+			size_t ret = 0;
+#ifdef LIBRARY_X64
+			ret = CacheSize(4);
+			if (ret == 0)
+			{
+				ret = CacheSize(0x8000001D);
+			}
+#endif
+			return ret ? ret : size_t(8) << 20;
+		}();
+		return cacheSize;
+	}
+
+	size_t NonTemporalThreshold() noexcept
+	{
+		return CacheSize();
+	}
+#pragma endregion
+
+#pragma region Kernels
+	/**
+	 * @param phase		which byte of pattern dest starts on
+	 */
+	static void FillScalar(std::byte* dest, const uint16_t pattern, const size_t byteCount, const size_t phase) noexcept
+	{
+		std::array<std::byte, 2> bytes{};
+		std::memcpy(bytes.data(), &pattern, sizeof(pattern));
+		for (size_t i = 0; i < byteCount; ++i)
+		{
+			dest[i] = bytes[(phase + i) % 2];
+		}
+	}
+
+	/**
+	 * @returns		how many bytes until ptr is aligned to alignment, if there are that many
+	 */
+	static size_t HeadBytes(const std::byte* ptr, const size_t alignment, const size_t byteCount) noexcept
+	{
+		return std::min((alignment - size_t(ptr) % alignment) % alignment, byteCount);
+	}
+
+#ifdef LIBRARY_X64
+	/**
+	 * Unaligned loads, stores aligned to a whole vector, 4 vectors per iteration.
+	 * The caller copies whatever's left over.
+	 *
+	 * @returns		how many bytes were copied
+	 */
+	template<bool Stream>
+	static size_t CopySSE2(std::byte* dest, const std::byte* source, const size_t byteCount) noexcept
+	{
+		constexpr size_t step = 4 * sizeof(__m128i);
+		size_t i = 0;
+		for (; i + step <= byteCount; i += step)
+		{
+			const auto* s = reinterpret_cast<const __m128i*>(source + i);
+			auto* d = reinterpret_cast<__m128i*>(dest + i);
+			const __m128i a = _mm_loadu_si128(s);
+			const __m128i b = _mm_loadu_si128(s + 1);
+			const __m128i c = _mm_loadu_si128(s + 2);
+			const __m128i e = _mm_loadu_si128(s + 3);
+			if constexpr (Stream)
+			{
+				_mm_stream_si128(d, a);
+				_mm_stream_si128(d + 1, b);
+				_mm_stream_si128(d + 2, c);
+				_mm_stream_si128(d + 3, e);
+			}
+			else
+			{
+				_mm_store_si128(d, a);
+				_mm_store_si128(d + 1, b);
+				_mm_store_si128(d + 2, c);
+				_mm_store_si128(d + 3, e);
+			}
+		}
+		return i;
+	}
+
+	template<bool Stream>
+	TARGET_AVX2 static size_t CopyAVX2(std::byte* dest, const std::byte* source, const size_t byteCount) noexcept
+	{
+		constexpr size_t step = 4 * sizeof(__m256i);
+		size_t i = 0;
+		for (; i + step <= byteCount; i += step)
+		{
+			const auto* s = reinterpret_cast<const __m256i*>(source + i);
+			auto* d = reinterpret_cast<__m256i*>(dest + i);
+			const __m256i a = _mm256_loadu_si256(s);
+			const __m256i b = _mm256_loadu_si256(s + 1);
+			const __m256i c = _mm256_loadu_si256(s + 2);
+			const __m256i e = _mm256_loadu_si256(s + 3);
+			if constexpr (Stream)
+			{
+				_mm256_stream_si256(d, a);
+				_mm256_stream_si256(d + 1, b);
+				_mm256_stream_si256(d + 2, c);
+				_mm256_stream_si256(d + 3, e);
+			}
+			else
+			{
+				_mm256_store_si256(d, a);
+				_mm256_store_si256(d + 1, b);
+				_mm256_store_si256(d + 2, c);
+				_mm256_store_si256(d + 3, e);
+			}
+		}
+		return i;
+	}
+
+	/**
+	 * dest must be aligned to a whole vector.
+	 * The caller fills whatever's left over.
+	 *
+	 * @returns		how many bytes were filled
+	 */
+	template<bool Stream>
+	static size_t FillSSE2(std::byte* dest, const uint16_t pattern, const size_t byteCount) noexcept
+	{
+		constexpr size_t step = 4 * sizeof(__m128i);
+		const __m128i v = _mm_set1_epi16(short(pattern));
+		size_t i = 0;
+		for (; i + step <= byteCount; i += step)
+		{
+			auto* d = reinterpret_cast<__m128i*>(dest + i);
+			if constexpr (Stream)
+			{
+				_mm_stream_si128(d, v);
+				_mm_stream_si128(d + 1, v);
+				_mm_stream_si128(d + 2, v);
+				_mm_stream_si128(d + 3, v);
+			}
+			else
+			{
+				_mm_store_si128(d, v);
+				_mm_store_si128(d + 1, v);
+				_mm_store_si128(d + 2, v);
+				_mm_store_si128(d + 3, v);
+			}
+		}
+		return i;
+	}
+
+	template<bool Stream>
+	TARGET_AVX2 static size_t FillAVX2(std::byte* dest, const uint16_t pattern, const size_t byteCount) noexcept
+	{
+		constexpr size_t step = 4 * sizeof(__m256i);
+		const __m256i v = _mm256_set1_epi16(short(pattern));
+		size_t i = 0;
+		for (; i + step <= byteCount; i += step)
+		{
+			auto* d = reinterpret_cast<__m256i*>(dest + i);
+			if constexpr (Stream)
+			{
+				_mm256_stream_si256(d, v);
+				_mm256_stream_si256(d + 1, v);
+				_mm256_stream_si256(d + 2, v);
+				_mm256_stream_si256(d + 3, v);
+			}
+			else
+			{
+				_mm256_store_si256(d, v);
+				_mm256_store_si256(d + 1, v);
+				_mm256_store_si256(d + 2, v);
+				_mm256_store_si256(d + 3, v);
+			}
+		}
+		return i;
+	}
+
+	/**
+	 * Each block holds a whole number of elements and has a byte mask that fits in a uint64_t.
+	 *
+	 * @returns		how many bytes are compared at once
+	 */
+	static constexpr size_t BlockSize(const size_t elementSize) noexcept
+	{
+		return elementSize == 12 ? 48 : 64;
+	}
+
+	/**
+	 * @param byteMask		a bit for each equal byte of a block
+	 * @returns				a bit at the first byte of each element of the block whose bytes are all equal
+	 */
+	template<size_t ElementSize>
+	static constexpr uint64_t ElementMask(uint64_t byteMask) noexcept
+	{
+		// afterwards bit i is set only if bytes [i, i + ElementSize) all are
+		if constexpr (ElementSize >= 2)
+		{
+			byteMask &= byteMask >> 1;
+		}
+		if constexpr (ElementSize >= 4)
+		{
+			byteMask &= byteMask >> 2;
+		}
+		if constexpr (ElementSize >= 8)
+		{
+			byteMask &= byteMask >> 4;
+		}
+		if constexpr (ElementSize == 12)
+		{
+			byteMask &= byteMask >> 4;
+		}
+		if constexpr (ElementSize == 16)
+		{
+			byteMask &= byteMask >> 8;
+		}
+
+		constexpr uint64_t starts = []
+		{
+			uint64_t ret = 0;
+			for (size_t i = 0; i < BlockSize(ElementSize); i += ElementSize)
+			{
+				ret |= uint64_t(1) << i;
+			}
+			return ret;
+		}();
+		return byteMask & starts;
+	}
+
+	/**
+	 * @returns		value repeated across a block
+	 */
+	template<size_t ElementSize>
+	static std::array<std::byte, BlockSize(ElementSize)> Pattern(const std::byte* value) noexcept
+	{
+		std::array<std::byte, BlockSize(ElementSize)> ret{};
+		for (size_t i = 0; i < ret.size(); i += ElementSize)
+		{
+			std::memcpy(ret.data() + i, value, ElementSize);
+		}
+		return ret;
+	}
+
+	/**
+	 * Compares whole blocks of elements with value, the caller compares whatever's left over.
+	 *
+	 * @param i		the first element to compare, left after the last one compared or at the first match
+	 * @returns		how many matched if CountAll, otherwise whether one did
+	 */
+	template<bool CountAll, size_t ElementSize>
+	static size_t SearchSSE2(const std::byte* data, const size_t count, const std::byte* value, size_t& i) noexcept
+	{
+		constexpr size_t blockSize = BlockSize(ElementSize);
+		constexpr size_t perBlock = blockSize / ElementSize;
+		constexpr size_t numVectors = blockSize / sizeof(__m128i);
+
+		const auto bytes = Pattern<ElementSize>(value);
+		__m128i pattern[numVectors];
+		for (size_t v = 0; v < numVectors; ++v)
+		{
+			pattern[v] = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes.data()) + v);
+		}
+
+		size_t found = 0;
+		for (; i + perBlock <= count; i += perBlock)
+		{
+			const auto* block = reinterpret_cast<const __m128i*>(data + i * ElementSize);
+			uint64_t mask = 0;
+			for (size_t v = 0; v < numVectors; ++v)
+			{
+				const __m128i equal = _mm_cmpeq_epi8(_mm_loadu_si128(block + v), pattern[v]);
+				mask |= uint64_t(uint16_t(_mm_movemask_epi8(equal))) << (v * sizeof(__m128i));
+			}
+			mask = ElementMask<ElementSize>(mask);
+			if constexpr (CountAll)
+			{
+				found += std::popcount(mask);
+			}
+			else if (mask)
+			{
+				i += std::countr_zero(mask) / ElementSize;
+				return 1;
+			}
+		}
+		return found;
+	}
+
+	template<bool CountAll, size_t ElementSize>
+	TARGET_AVX2 static size_t SearchAVX2(const std::byte* data, const size_t count, const std::byte* value, size_t& i) noexcept
+	{
+		constexpr size_t blockSize = BlockSize(ElementSize);
+		constexpr size_t perBlock = blockSize / ElementSize;
+		constexpr size_t numVectors = blockSize / sizeof(__m256i);
+		// 12 byte elements come in blocks of 48, the last 16 of which need a narrower vector
+		constexpr bool half = blockSize % sizeof(__m256i) != 0;
+
+		const auto bytes = Pattern<ElementSize>(value);
+		__m256i pattern[numVectors];
+		for (size_t v = 0; v < numVectors; ++v)
+		{
+			pattern[v] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(bytes.data()) + v);
+		}
+		const __m128i halfPattern = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bytes.data() + numVectors * sizeof(__m256i) * half));
+
+		size_t found = 0;
+		for (; i + perBlock <= count; i += perBlock)
+		{
+			const std::byte* block = data + i * ElementSize;
+			uint64_t mask = 0;
+			for (size_t v = 0; v < numVectors; ++v)
+			{
+				const __m256i equal = _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(block) + v), pattern[v]);
+				mask |= uint64_t(uint32_t(_mm256_movemask_epi8(equal))) << (v * sizeof(__m256i));
+			}
+			if constexpr (half)
+			{
+				const __m128i equal = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(block + numVectors * sizeof(__m256i))), halfPattern);
+				mask |= uint64_t(uint16_t(_mm_movemask_epi8(equal))) << (numVectors * sizeof(__m256i));
+			}
+			mask = ElementMask<ElementSize>(mask);
+			if constexpr (CountAll)
+			{
+				found += std::popcount(mask);
+			}
+			else if (mask)
+			{
+				i += std::countr_zero(mask) / ElementSize;
+				return 1;
+			}
+		}
+		return found;
+	}
+#endif
+
+	/**
+	 * @returns		how many matched if CountAll, otherwise the index of the first match or count
+	 */
+	template<bool CountAll, size_t ElementSize>
+	static size_t Search(const std::byte* data, const size_t count, const std::byte* value, [[maybe_unused]] const Isa isa) noexcept
+	{
+		size_t i = 0;
+		size_t found = 0;
+#ifdef LIBRARY_X64
+		if (isa != Isa::Scalar)
+		{
+			found = isa == Isa::AVX2 ? SearchAVX2<CountAll, ElementSize>(data, count, value, i) : SearchSSE2<CountAll, ElementSize>(data, count, value, i);
+			if (!CountAll && found)
+			{
+				return i;
+			}
+		}
+#endif
+
+		for (; i < count; ++i)
+		{
+			if (!std::memcmp(data + i * ElementSize, value, ElementSize))
+			{
+				if constexpr (CountAll)
+				{
+					++found;
+				}
+				else
+				{
+					return i;
+				}
+			}
+		}
+		return CountAll ? found : count;
+	}
+
+	template<bool CountAll>
+	static size_t Search(const void* data, const size_t count, const void* value, const size_t elementSize, const Isa isa) noexcept
+	{
+		assertm((data && value) || count == 0, "undefined behavior in Memory::SimdFind");
+		assertm(isa <= DetectIsa(), "this CPU doesn't support that instruction set");
+		const auto* d = reinterpret_cast<const std::byte*>(data);
+		const auto* v = reinterpret_cast<const std::byte*>(value);
+
+		switch (elementSize)
+		{
+		case 1: return Search<CountAll, 1>(d, count, v, isa);
+		case 2: return Search<CountAll, 2>(d, count, v, isa);
+		case 4: return Search<CountAll, 4>(d, count, v, isa);
+		case 8: return Search<CountAll, 8>(d, count, v, isa);
+		case 12: return Search<CountAll, 12>(d, count, v, isa);
+		case 16: return Search<CountAll, 16>(d, count, v, isa);
+		default:
+			assertm(false, "unsupported element size");
+			return CountAll ? 0 : count;
+		}
+	}
+
+	/**
+	 * @returns		the width of isa's vectors in bytes
+	 */
+	static constexpr size_t VectorSize(const Isa isa) noexcept
+	{
+		switch (isa)
+		{
+		case Isa::AVX2: return 32;
+		case Isa::SSE2: return 16;
+		default: return 1;
+		}
+	}
+#pragma endregion
+
+	void SimdCopy(void* dest, const void* source, const size_t byteCount, const Isa isa) noexcept
+	{
+		assertm((dest && source) || byteCount == 0, "undefined behavior in Memory::SimdCopy");
+		assertm(isa <= DetectIsa(), "this CPU doesn't support that instruction set");
+		auto* d = reinterpret_cast<std::byte*>(dest);
+		const auto* s = reinterpret_cast<const std::byte*>(source);
+
+		// too small for the loops to ever run
+		if (isa == Isa::Scalar || byteCount < 8 * VectorSize(isa))
+		{
+			std::memcpy(d, s, byteCount);
+			return;
+		}
+
+		const size_t head = HeadBytes(d, VectorSize(isa), byteCount);
+		std::memcpy(d, s, head);
+		size_t i = head;
+
+#ifdef LIBRARY_X64
+		const bool stream = byteCount >= NonTemporalThreshold();
+		if (isa == Isa::AVX2)
+		{
+			i += stream ? CopyAVX2<true>(d + i, s + i, byteCount - i) : CopyAVX2<false>(d + i, s + i, byteCount - i);
+		}
+		else
+		{
+			i += stream ? CopySSE2<true>(d + i, s + i, byteCount - i) : CopySSE2<false>(d + i, s + i, byteCount - i);
+		}
+		if (stream)
+		{
+			// streaming stores are weakly ordered, fence them before anyone else can look
+			_mm_sfence();
+		}
+#endif
+
+		std::memcpy(d + i, s + i, byteCount - i);
+	}
+
+	void SimdFill(void* dest, const uint16_t pattern, const size_t byteCount, const Isa isa) noexcept
+	{
+		assertm(dest || byteCount == 0, "undefined behavior in Memory::SimdFill");
+		assertm(isa <= DetectIsa(), "this CPU doesn't support that instruction set");
+		auto* d = reinterpret_cast<std::byte*>(dest);
+
+		if (isa == Isa::Scalar || byteCount < 8 * VectorSize(isa))
+		{
+			FillScalar(d, pattern, byteCount, 0);
+			return;
+		}
+
+		const size_t head = HeadBytes(d, VectorSize(isa), byteCount);
+		FillScalar(d, pattern, head, 0);
+		size_t i = head;
+
+#ifdef LIBRARY_X64
+		// the vectors start partway through the pattern if the head was odd
+		const uint16_t aligned = head % 2 ? std::rotl(pattern, 8) : pattern;
+		const bool stream = byteCount >= NonTemporalThreshold();
+		if (isa == Isa::AVX2)
+		{
+			i += stream ? FillAVX2<true>(d + i, aligned, byteCount - i) : FillAVX2<false>(d + i, aligned, byteCount - i);
+		}
+		else
+		{
+			i += stream ? FillSSE2<true>(d + i, aligned, byteCount - i) : FillSSE2<false>(d + i, aligned, byteCount - i);
+		}
+		if (stream)
+		{
+			_mm_sfence();
+		}
+#endif
+
+		FillScalar(d + i, pattern, byteCount - i, i);
+	}
+
+	size_t SimdFind(const void* data, const size_t count, const void* value, const size_t elementSize, const Isa isa) noexcept
+	{
+		return Search<false>(data, count, value, elementSize, isa);
+	}
+
+	size_t SimdCount(const void* data, const size_t count, const void* value, const size_t elementSize, const Isa isa) noexcept
+	{
+		return Search<true>(data, count, value, elementSize, isa);
+	}
+}
@@ -0,0 +1,96 @@
+// MIT License Copyright (c) 2020 Jarrett Wendt
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+namespace Library::Memory
+{
+	/**
+	 * Instruction sets the copy, fill and search kernels can be built on, from narrowest to widest.
+	 */
+	enum class Isa : uint8_t
+	{
+		Scalar,
+		SSE2,
+		AVX2
+	};
+
+	/**
+	 * Detected once, the first time it's called.
+	 * O(1)
+	 *
+	 * @returns		the widest instruction set this CPU and OS support
+	 */
+	Isa DetectIsa() noexcept;
+
+	/**
+	 * Detected once, the first time it's called.
+	 * O(1)
+	 *
+	 * @returns		the size of the last level cache in bytes, or a guess if the CPU doesn't say
+	 */
+	size_t CacheSize() noexcept;
+
+	/**
+	 * Copies and fills at least this big use non-temporal stores which skip the cache.
+	 * They wouldn't fit in it anyway, so caching them would only evict everything else.
+	 * O(1)
+	 *
+	 * @returns		the last level cache's size
+	 */
+	size_t NonTemporalThreshold() noexcept;
+
+	/**
+	 * Copies with the widest vectors isa allows and stores aligned to them.
+	 * Memcpy doesn't use this since glibc's memcpy already does the same and measures faster at every size.
+	 * Streams around the cache once byteCount reaches NonTemporalThreshold().
+	 * If the objects overlap, the behavior is undefined.
+	 * O(n)
+	 *
+	 * @param dest			destination memory address
+	 * @param source		source memory address
+	 * @param byteCount		number of bytes to copy
+	 * @param isa			instruction set to use, must be supported by this CPU
+	 */
+	void SimdCopy(void* dest, const void* source, size_t byteCount, Isa isa = DetectIsa()) noexcept;
+
+	/**
+	 * Repeats pattern, as it's laid out in memory, across dest.
+	 * If byteCount is odd the last byte gets the pattern's first byte.
+	 * Streams around the cache once byteCount reaches NonTemporalThreshold().
+	 * O(n)
+	 *
+	 * @param dest			destination memory address
+	 * @param pattern		2 bytes to repeat
+	 * @param byteCount		number of bytes to fill
+	 * @param isa			instruction set to use, must be supported by this CPU
+	 */
+	void SimdFill(void* dest, uint16_t pattern, size_t byteCount, Isa isa = DetectIsa()) noexcept;
+
+	/**
+	 * Compares a block of elements against value at once and picks the first match out of the mask.
+	 * O(n)
+	 *
+	 * @param data			the elements to search
+	 * @param count			how many elements there are
+	 * @param value			elementSize bytes to compare each element with
+	 * @param elementSize	1, 2, 4, 8, 12 or 16
+	 * @param isa			instruction set to use, must be supported by this CPU
+	 * @returns				the index of the first element whose bytes all equal value's, or count if there isn't one
+	 */
+	size_t SimdFind(const void* data, size_t count, const void* value, size_t elementSize, Isa isa = DetectIsa()) noexcept;
+
+	/**
+	 * Compares a block of elements against value at once and popcounts the mask.
+	 * O(n)
+	 *
+	 * @param data			the elements to search
+	 * @param count			how many elements there are
+	 * @param value			elementSize bytes to compare each element with
+	 * @param elementSize	1, 2, 4, 8, 12 or 16
+	 * @param isa			instruction set to use, must be supported by this CPU
+	 * @returns				how many elements' bytes all equal value's
+	 */
+	size_t SimdCount(const void* data, size_t count, const void* value, size_t elementSize, Isa isa = DetectIsa()) noexcept;
+}
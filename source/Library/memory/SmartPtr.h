@@ -1,14 +1,30 @@
 #pragma once
+#include <atomic>
 #include <ostream>
 #include <stdexcept>
 
 #include "Macros.h"
+#include "RefCount.h"
 
 namespace Library
 {
 	namespace Memory
 	{
 		class Manager;
+
+		/**
+		 * How many Heaps are being Defragged in the background, see Manager::Policy::defragInBackground.
+		 * While any are, every dereference marks its Handle as touched.
+		 */
+		inline std::atomic<size_t> numBackgroundDefrags{ 0 };
+
+		/**
+		 * Whether this thread may dereference handle's object, which it can't if another thread's Chain is Defragging in the background.
+		 * Only that Chain's thread is sure to see numBackgroundDefrags go up before copying begins.
+		 *
+		 * @param handle	the Handle of a live object made by Memory::Manager
+		 */
+		bool MayTouch(const void* handle) noexcept;
 	}
 	
 	/**
@@ -36,21 +52,38 @@ namespace Library
 		{			
 			T* ptr;
 			uint32_t sharedCount;
-			struct
-			{
-				// 1 << alignment gives us alignof(T)
-				// needed by Memory::Manager who has no type information
-				uint32_t alignment : 5;
-				uint32_t weakCount : 27;
-			};
+			// The low alignmentBits are log2(alignof(T)), needed by Memory::Manager who has no type information.
+			// The next is touchedBit, which Memory::Manager uses to find objects that changed while being copied.
+			// The rest are the weak count, which goes up by weakOne for each WeakPtr.
+			// These are packed by hand rather than with bit-fields so the weak count can be updated atomically.
+			uint32_t weakCountAndAlignment;
+
+			constexpr static uint32_t alignmentBits = 5;
+			constexpr static uint32_t touchedBit = 1 << alignmentBits;
+			constexpr static uint32_t weakOne = touchedBit << 1;
+			
 			explicit Handle(T* ptr, const uint32_t alignment) noexcept;						
 			
 			Handle() noexcept = default;
 			~Handle() noexcept;
 			MOVE_COPY(Handle, default)
 
-			constexpr bool Used() const noexcept;
+			// The counts are read with acquire loads since the last reference may be dropped by another thread.
+			// An object which is still being destroyed counts as used, see destroyingCount.
+			bool Used() const noexcept;
+			// Whether the object has been destroyed but WeakPtrs still reference this Handle.
+			bool Expired() const noexcept;
 			constexpr size_t Alignment() const noexcept;
+			uint32_t WeakCount() const noexcept;
+
+			/**
+			 * Sets touchedBit if any Heap is being Defragged in the background, otherwise does nothing.
+			 * Called on every dereference, since whoever dereferences may write to the object.
+			 */
+			void Touch() noexcept;
+
+		private:
+			static uint32_t Acquire(const uint32_t& count) noexcept;
 		};
 
 		Handle* handle{};
@@ -7,28 +7,59 @@ namespace Library
 	SmartPtr<T>::Handle::Handle(T* ptr, const uint32_t alignment) noexcept :
 		ptr(ptr),
 		sharedCount(0),
-		alignment(alignment),
-		weakCount(0) {}
+		weakCountAndAlignment(alignment) {}
 
 	template<typename T>
 	SmartPtr<T>::Handle::~Handle() noexcept
 	{
 #ifdef _DEBUG
 		ptr = nullptr;
-		sharedCount = alignment = weakCount = 0;
+		sharedCount = weakCountAndAlignment = 0;
 #endif
 	}
 
 	template<typename T>
-	constexpr bool SmartPtr<T>::Handle::Used() const noexcept
+	bool SmartPtr<T>::Handle::Used() const noexcept
 	{
-		return sharedCount || weakCount;
+		return Acquire(sharedCount) || WeakCount();
+	}
+
+	template<typename T>
+	bool SmartPtr<T>::Handle::Expired() const noexcept
+	{
+		return !Acquire(sharedCount) && WeakCount();
 	}
 
 	template<typename T>
 	constexpr size_t SmartPtr<T>::Handle::Alignment() const noexcept
 	{
-		return 1 << alignment;
+		return size_t(1) << (weakCountAndAlignment & (touchedBit - 1));
+	}
+
+	template<typename T>
+	uint32_t SmartPtr<T>::Handle::WeakCount() const noexcept
+	{
+		return Acquire(weakCountAndAlignment) / weakOne;
+	}
+
+	template<typename T>
+	void SmartPtr<T>::Handle::Touch() noexcept
+	{
+		if (Memory::numBackgroundDefrags.load(std::memory_order_relaxed)) [[unlikely]]
+		{
+			assertm(Memory::MayTouch(this), "objects in a Chain being Defragged in the background may only be dereferenced by its own thread");
+			// atomic since WeakPtrs on other threads may be changing the weak count
+			if (std::atomic_ref ref(weakCountAndAlignment); !(ref.load(std::memory_order_relaxed) & touchedBit))
+			{
+				ref.fetch_or(touchedBit, std::memory_order_relaxed);
+			}
+		}
+	}
+	
+	template<typename T>
+	uint32_t SmartPtr<T>::Handle::Acquire(const uint32_t& count) noexcept
+	{
+		return std::atomic_ref(const_cast<uint32_t&>(count)).load(std::memory_order_acquire);
 	}
 	
 	template<typename T>
@@ -69,6 +100,7 @@ namespace Library
 	{
 		if (handle && handle->ptr)
 		{
+			handle->Touch();
 			return *handle->ptr;
 		}
 		throw NullReferenceException();
@@ -101,13 +133,18 @@ namespace Library
 	template<typename T>
 	size_t SmartPtr<T>::ReferenceCount() noexcept
 	{
-		return handle ? handle->sharedCount : 0;
+		return handle ? handle->sharedCount & ~Memory::destroyingCount : 0;
 	}
 
 	template<typename T>
 	T* SmartPtr<T>::Raw() noexcept
 	{
-		return handle ? handle->ptr : nullptr;
+		if (!handle)
+		{
+			return nullptr;
+		}
+		handle->Touch();
+		return handle->ptr;
 	}
 
 	template <typename T>
@@ -6,14 +6,17 @@ namespace Library
 {
 	/**
 	 * Non-owning reference to an existing SharedPtr. 
+	 *
+	 * @param <T>			type this pointer references
+	 * @param <RefCount>	how the reference counts are updated, must match the SharedPtr's
 	 */
-	template<typename T>
+	template<typename T, Concept::RefCount RefCount = Memory::NonAtomicRefCount>
 	class WeakPtr : public SmartPtr<T>
 	{
 		using Base = SmartPtr<T>;
 
 	public:
-		WeakPtr(const SharedPtr<T>& shared) noexcept;
+		WeakPtr(const SharedPtr<T, RefCount>& shared) noexcept;
 		
 		WeakPtr() noexcept = default;
 		WeakPtr(const WeakPtr& other) noexcept;
@@ -22,10 +25,22 @@ namespace Library
 		WeakPtr& operator=(WeakPtr&& other) noexcept;
 		~WeakPtr() noexcept;
 
-		operator SharedPtr<T>() noexcept;
+		/**
+		 * @returns		a SharedPtr to the object, or nullptr if it has Expired
+		 */
+		operator SharedPtr<T, RefCount>() noexcept;
 
 		bool Expired() const noexcept;
 	};
+
+	/**
+	 * WeakPtr which may be copied and destroyed from any thread.
+	 */
+	template<typename T>
+	using AtomicWeakPtr = WeakPtr<T, Memory::AtomicRefCount>;
+
+	template<typename T, Concept::RefCount RefCount>
+	struct Util::IsTriviallyRelocatable<WeakPtr<T, RefCount>> : std::true_type {};
 }
 
 #include "WeakPtr.inl"
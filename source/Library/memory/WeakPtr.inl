@@ -4,32 +4,32 @@
 namespace Library
 {
 #pragma region special members
-	template<typename T>
-	WeakPtr<T>::WeakPtr(const SharedPtr<T>& shared) noexcept :
+	template<typename T, Concept::RefCount RefCount>
+	WeakPtr<T, RefCount>::WeakPtr(const SharedPtr<T, RefCount>& shared) noexcept :
 		Base(reinterpret_cast<const WeakPtr&>(shared))
 	{
 		if (this->handle)
 		{
-			++this->handle->weakCount;
+			RefCount::Increment(this->handle->weakCountAndAlignment, Base::Handle::weakOne);
 		}
 	}
 
-	template<typename T>
-	WeakPtr<T>::WeakPtr(const WeakPtr& other) noexcept :
+	template<typename T, Concept::RefCount RefCount>
+	WeakPtr<T, RefCount>::WeakPtr(const WeakPtr& other) noexcept :
 		Base(other)
 	{
 		if (this->handle)
 		{
-			++this->handle->weakCount;
+			RefCount::Increment(this->handle->weakCountAndAlignment, Base::Handle::weakOne);
 		}
 	}
 
-	template<typename T>
-	WeakPtr<T>::WeakPtr(WeakPtr&& other) noexcept :
+	template<typename T, Concept::RefCount RefCount>
+	WeakPtr<T, RefCount>::WeakPtr(WeakPtr&& other) noexcept :
 		Base(std::move(other)) {}
 
-	template<typename T>
-	WeakPtr<T>& WeakPtr<T>::operator=(const WeakPtr& other) noexcept
+	template<typename T, Concept::RefCount RefCount>
+	WeakPtr<T, RefCount>& WeakPtr<T, RefCount>::operator=(const WeakPtr& other) noexcept
 	{
 		if (this != &other)
 		{
@@ -37,14 +37,14 @@ namespace Library
 			this->handle = other.handle;
 			if (this->handle)
 			{
-				++this->handle->weakCount;
+				RefCount::Increment(this->handle->weakCountAndAlignment, Base::Handle::weakOne);
 			}
 		}
 		return *this;
 	}
 
-	template<typename T>
-	WeakPtr<T>& WeakPtr<T>::operator=(WeakPtr&& other) noexcept
+	template<typename T, Concept::RefCount RefCount>
+	WeakPtr<T, RefCount>& WeakPtr<T, RefCount>::operator=(WeakPtr&& other) noexcept
 	{
 		if (this != &other)
 		{
@@ -55,12 +55,12 @@ namespace Library
 		return *this;
 	}
 	
-	template<typename T>
-	WeakPtr<T>::~WeakPtr() noexcept
+	template<typename T, Concept::RefCount RefCount>
+	WeakPtr<T, RefCount>::~WeakPtr() noexcept
 	{
 		if (this->handle)
 		{
-			--this->handle->weakCount;
+			RefCount::Decrement(this->handle->weakCountAndAlignment, Base::Handle::weakOne);
 			// No need to free the handle's memory, that will be done in Memory::Manager
 #ifdef _DEBUG
 			this->handle = nullptr;
@@ -69,16 +69,21 @@ namespace Library
 	}
 #pragma endregion
 	
-	template<typename T>
-	WeakPtr<T>::operator SharedPtr<T>() noexcept
+	template<typename T, Concept::RefCount RefCount>
+	WeakPtr<T, RefCount>::operator SharedPtr<T, RefCount>() noexcept
 	{
-		// the copy ctor handles reference counting
-		return *reinterpret_cast<SharedPtr<T>*>(this);
+		SharedPtr<T, RefCount> ret{};
+		// The object may be destroyed by another thread at any moment, so only take a reference if there still is one.
+		if (this->handle && RefCount::IncrementIfNonZero(this->handle->sharedCount))
+		{
+			reinterpret_cast<WeakPtr&>(ret).handle = this->handle;
+		}
+		return ret;
 	}
 
-	template<typename T>
-	bool WeakPtr<T>::Expired() const noexcept
+	template<typename T, Concept::RefCount RefCount>
+	bool WeakPtr<T, RefCount>::Expired() const noexcept
 	{
-		return !this->handle || this->handle->sharedCount == 0; 
+		return !this->handle || (RefCount::Load(this->handle->sharedCount) & ~Memory::destroyingCount) == 0;
 	}
 }
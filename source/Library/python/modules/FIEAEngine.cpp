@@ -5,6 +5,7 @@
 #include "python/modules/Engine.h"
 #include "python/modules/Entity.h"
 #include "python/modules/LibMath_module.h"
+#include "python/modules/Memory.h"
 #include "python/modules/Time.h"
 
 PyObject* PyInit_FIEAEngine() noexcept
@@ -29,6 +30,10 @@ PyObject* PyInit_FIEAEngine() noexcept
 	Py_INCREF(math);
 	PyModule_AddObject(fiea, "Math", math);
 
+	PyObject* memory = Memory::InitModule();
+	Py_INCREF(memory);
+	PyModule_AddObject(fiea, "Memory", memory);
+
 	PyObject* entity = InitEntityModule();
 	Py_INCREF(entity);
 	PyModule_AddObject(fiea, "Entity", entity);
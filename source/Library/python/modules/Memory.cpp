@@ -0,0 +1,103 @@
+#include <pch.h>
+#include "python/pch.h"
+#include "python/modules/Memory.h"
+#include "Manager.h"
+
+namespace Library::py::Memory
+{
+	using Manager = Library::Memory::Manager;
+
+	/**
+	 * Like PyDict_SetItemString, but steals the reference to value.
+	 */
+	static void SetItem(PyObject* dict, const char* key, PyObject* value)
+	{
+		PyDict_SetItemString(dict, key, value);
+		Py_XDECREF(value);
+	}
+
+	template<typename Range>
+	static PyObject* ToPyList(const Range& range)
+	{
+		PyObject* list = PyList_New(0);
+		for (const size_t n : range)
+		{
+			PyObject* item = PyLong_FromSize_t(n);
+			PyList_Append(list, item);
+			Py_XDECREF(item);
+		}
+		return list;
+	}
+	
+	PyObject* TotalBytes()
+	{
+		return PyLong_FromSize_t(Manager::TotalBytes());
+	}
+
+	PyObject* GenerationStats()
+	{
+		const auto stats = Manager::GetGenerationStats();
+		PyObject* list = PyList_New(stats.size());
+		for (size_t i = 0; i < stats.size(); ++i)
+		{
+			const Manager::GenerationStats& s = stats[i];
+			PyObject* dict = PyDict_New();
+			SetItem(dict, "capacity", PyLong_FromSize_t(s.capacity));
+			SetItem(dict, "usedBytes", PyLong_FromSize_t(s.usedBytes));
+			SetItem(dict, "numHandles", PyLong_FromSize_t(s.numHandles));
+			SetItem(dict, "numDeadHandles", PyLong_FromSize_t(s.numDeadHandles));
+			SetItem(dict, "deadBytes", PyLong_FromSize_t(s.deadBytes));
+			SetItem(dict, "fragmentation", PyFloat_FromDouble(s.fragmentation));
+			SetItem(dict, "survivalRate", PyFloat_FromDouble(s.survivalRate));
+			SetItem(dict, "numDefrags", PyLong_FromSize_t(s.numDefrags));
+			SetItem(dict, "numGraduations", PyLong_FromSize_t(s.numGraduations));
+			SetItem(dict, "defragTime", PyFloat_FromDouble(std::chrono::duration<double>(s.defragTime).count()));
+			SetItem(dict, "graduateTime", PyFloat_FromDouble(std::chrono::duration<double>(s.graduateTime).count()));
+			// steals the reference
+			PyList_SET_ITEM(list, i, dict);
+		}
+		return list;
+	}
+
+	PyObject* AllocationStats()
+	{
+		const Manager::AllocationStats& stats = Manager::GetAllocationStats();
+		PyObject* dict = PyDict_New();
+		SetItem(dict, "sizes", ToPyList(stats.sizes));
+		SetItem(dict, "alignments", ToPyList(stats.alignments));
+		SetItem(dict, "numAllocations", PyLong_FromSize_t(stats.numAllocations));
+		SetItem(dict, "numFrees", PyLong_FromSize_t(stats.numFrees));
+		return dict;
+	}
+
+	PyObject* ResetAllocationStats()
+	{
+		Manager::ResetAllocationStats();
+		Py_RETURN_NONE;
+	}
+
+	static PyMethodDef methods[] =
+	{
+		{ "TotalBytes", PyCFunction(TotalBytes), METH_NOARGS, nullptr },
+		{ "GenerationStats", PyCFunction(GenerationStats), METH_NOARGS, nullptr },
+		{ "AllocationStats", PyCFunction(AllocationStats), METH_NOARGS, nullptr },
+		{ "ResetAllocationStats", PyCFunction(ResetAllocationStats), METH_NOARGS, nullptr },
+
+		{ nullptr, nullptr, 0, nullptr }
+	};
+
+	static PyModuleDef module =
+	{
+		PyModuleDef_HEAD_INIT,
+
+		"Memory",
+		"Python port of C++ Library::Memory::Manager's telemetry",
+		0,
+		methods
+	};
+	
+	PyObject* InitModule()
+	{
+		return PyModule_Create(&module);
+	}
+}
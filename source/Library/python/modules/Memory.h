@@ -0,0 +1,9 @@
+// MIT License Copyright (c) 2020 Jarrett Wendt
+
+#pragma once
+#include "python/pch.h"
+
+namespace Library::py::Memory
+{
+	PyObject* InitModule();
+}
@@ -96,7 +96,7 @@ class Attributed:
 			for attribute in self.attributes:
 				ret += '\t\t\t\t\t' + str(attribute) + ',\n'
 		else:
-			ret += '\t\t\t\t\tArray<Attribute>()\n'
+			ret += '\t\t\t\t\tAttributeArray()\n'
 		return ret + '\t\t\t\t}\n\t\t\t}\n\t\t}'
 	
 	def __eq__(self, other):
@@ -27,13 +27,16 @@ namespace Library
 			Datum::Type type{ Datum::Type::None };
 		};
 
+		/** most types only declare a handful of Attributes, so they're kept inline */
+		using AttributeArray = InlineArray<Attribute, 4>;
+
 		struct Attributes final
 		{
 			/** used for recursively getting base Attributes */
 			RTTI::IDType base;
 
 			/** the Attributes for this Attributed */
-			Array<Attribute> attributes;
+			AttributeArray attributes;
 
 			/** how many attributes exist for this derived type in total, including all base types */
 			size_t num{ std::numeric_limits<size_t>::max() };
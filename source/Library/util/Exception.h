@@ -5,7 +5,7 @@
 #include <exception>
 #include <stdexcept>
 
-#include "Array.h"
+#include "InlineArray.h"
 
 namespace Library
 {
@@ -14,6 +14,7 @@ namespace Library
 	class AggregateException : public std::exception
 	{
 	public:
-		Array<std::exception_ptr> exceptions{};
+		/** usually just the one */
+		InlineArray<std::exception_ptr, 1> exceptions{};
 	};
 }
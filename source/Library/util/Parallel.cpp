@@ -0,0 +1,156 @@
+// MIT License Copyright (c) 2020 Jarrett Wendt
+
+#include "pch.h"
+#include "Parallel.h"
+
+namespace Library::Util::Parallel
+{
+#pragma region Workers
+	size_t Workers::Count() noexcept
+	{
+		return pool.started ? pool.threads.size() + 1 : std::max(size_t(1), size_t(std::thread::hardware_concurrency()));
+	}
+
+	void Workers::SetCount(const size_t count)
+	{
+		std::scoped_lock lock(runMutex);
+		pool.Stop();
+		pool.Start(count);
+	}
+
+	void Workers::Run(const size_t numTasks, const std::function<void(size_t)>& task)
+	{
+		std::unique_lock runLock(runMutex, std::defer_lock);
+		if (numTasks <= 1 || busy || !runLock.try_lock())
+		{
+			for (size_t i = 0; i < numTasks; ++i)
+			{
+				task(i);
+			}
+			return;
+		}
+
+		if (!pool.started)
+		{
+			pool.Start(0);
+		}
+
+		Job current{ task, numTasks };
+		{
+			std::scoped_lock lock(mutex);
+			job = &current;
+			++generation;
+		}
+		wake.notify_all();
+
+		busy = true;
+		current.Work();
+		busy = false;
+
+		{
+			// Workers who joined in may still be finishing the last tasks.
+			std::unique_lock lock(mutex);
+			done.wait(lock, [&current] { return current.active == 0; });
+			job = nullptr;
+		}
+
+		if (current.exception)
+		{
+			std::rethrow_exception(current.exception);
+		}
+	}
+
+	void Workers::Job::Work() noexcept
+	{
+		for (size_t i = next++; i < numTasks; i = next++)
+		{
+			try
+			{
+				task(i);
+			}
+			catch (...)
+			{
+				std::scoped_lock lock(exceptionMutex);
+				if (!exception)
+				{
+					exception = std::current_exception();
+				}
+				// skip whatever hasn't started yet
+				next = numTasks;
+			}
+		}
+	}
+
+	void Workers::Loop()
+	{
+		busy = true;
+		size_t seen = 0;
+		while (true)
+		{
+			Job* current;
+			{
+				std::unique_lock lock(mutex);
+				wake.wait(lock, [&seen] { return pool.stop || (job && generation != seen); });
+				if (pool.stop)
+				{
+					return;
+				}
+				seen = generation;
+				current = job;
+				++current->active;
+			}
+
+			current->Work();
+
+			bool last;
+			{
+				std::scoped_lock lock(mutex);
+				last = --current->active == 0;
+			}
+			if (last)
+			{
+				done.notify_all();
+			}
+		}
+	}
+#pragma endregion
+
+#pragma region Pool
+	Workers::Pool::Pool() noexcept {}
+
+	Workers::Pool::~Pool()
+	{
+		Stop();
+	}
+
+	void Workers::Pool::Start(size_t count)
+	{
+		if (count == 0)
+		{
+			count = std::max(size_t(1), size_t(std::thread::hardware_concurrency()));
+		}
+		stop = false;
+		threads.reserve(count - 1);
+		for (size_t i = 1; i < count; ++i)
+		{
+			threads.emplace_back(Loop);
+		}
+		started = true;
+	}
+
+	void Workers::Pool::Stop()
+	{
+		{
+			std::scoped_lock lock(mutex);
+			stop = true;
+		}
+		wake.notify_all();
+		for (std::thread& thread : threads)
+		{
+			thread.join();
+		}
+		threads.clear();
+		started = false;
+	}
+#pragma endregion
+}
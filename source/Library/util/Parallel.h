@@ -0,0 +1,190 @@
+// MIT License Copyright (c) 2020 Jarrett Wendt
+
+#pragma once
+
+#include <atomic>				// std::atomic
+#include <condition_variable>	// std::condition_variable
+#include <exception>			// std::exception_ptr
+#include <functional>			// std::function, std::less
+#include <iterator>				// std::random_access_iterator
+#include <mutex>				// std::mutex
+#include <ranges>				// std::ranges::random_access_range
+#include <thread>				// std::thread
+#include <vector>
+
+#include "Macros.h"
+#include "Memory.h"
+
+namespace Library::Util::Parallel
+{
+	/**
+	 * How many elements each task gets when no grain size is passed.
+	 * Small enough to balance across 32 threads on a 1M element Array, big enough that scheduling is lost in the noise.
+	 */
+	constexpr size_t defaultGrainSize = 1 << 14;
+
+	/**
+	 * The threads shared by every parallel algorithm.
+	 *
+	 * Started on first use with std::thread::hardware_concurrency threads, counting the calling thread who does its share of the work.
+	 * A Run from inside a task, or while another thread is in Run, is done on the calling thread alone rather than waiting.
+	 */
+	class Workers final
+	{
+	public:
+		/**
+		 * @returns		How many threads work on each Run, including the calling thread.
+		 */
+		[[nodiscard]] static size_t Count() noexcept;
+
+		/**
+		 * Stops the current threads and starts count - 1 new ones.
+		 * 1 makes every Run sequential.
+		 *
+		 * @param count		How many threads should work on each Run, including the calling thread. 0 for std::thread::hardware_concurrency.
+		 */
+		static void SetCount(size_t count);
+
+		/**
+		 * Invokes task once for each index in [0, numTasks) spread over all the Workers, returning once they're all done.
+		 * If any task throws the tasks not yet started are skipped and the first exception is rethrown.
+		 *
+		 * @param numTasks	How many times to invoke task.
+		 * @param task		Invoked with the index of each task, possibly from several threads at once.
+		 */
+		static void Run(size_t numTasks, const std::function<void(size_t)>& task);
+
+	private:
+		/**
+		 * One call to Run which Workers may join in on.
+		 */
+		struct Job final
+		{
+			const std::function<void(size_t)>& task;
+			const size_t numTasks;
+			std::atomic<size_t> next{ 0 };
+			// How many Workers are still inside Work, guarded by mutex.
+			size_t active{ 0 };
+			std::exception_ptr exception{};
+			std::mutex exceptionMutex{};
+
+			/**
+			 * Invokes tasks until there are none left to start.
+			 */
+			void Work() noexcept;
+		};
+
+		/**
+		 * Owns the threads so they're joined at exit.
+		 */
+		struct Pool final
+		{
+			std::vector<std::thread> threads{};
+			bool started{ false };
+			bool stop{ false };
+
+			Pool() noexcept;
+			~Pool();
+			MOVE_COPY(Pool, delete)
+
+			void Start(size_t count);
+			void Stop();
+		};
+
+		/**
+		 * The loop each thread in the Pool runs until Stop.
+		 */
+		static void Loop();
+
+		static inline Job* job{ nullptr };
+		// Incremented for every Job so a Worker doesn't join the same one twice.
+		static inline size_t generation{ 0 };
+		static inline std::mutex mutex{};
+		static inline std::condition_variable wake{};
+		static inline std::condition_variable done{};
+		// Held by the thread in Run.
+		static inline std::mutex runMutex{};
+		// Whether this thread is already in Run or is one of the Workers.
+		static inline thread_local bool busy{ false };
+		// Declared last so it's destroyed, and its threads joined, before everything they use.
+		static inline Pool pool{};
+
+		STATIC_CLASS(Workers)
+	};
+
+	/**
+	 * Splits [0, size) into chunks of grainSize and invokes func on each one from the Workers.
+	 *
+	 * @param size			How many elements there are.
+	 * @param func			Invoked with the [begin, end) indices of each chunk.
+	 * @param grainSize		How many elements each chunk has, the last may have fewer.
+	 */
+	template<std::invocable<size_t, size_t> Func>
+	void ForEachChunk(size_t size, Func func, size_t grainSize = defaultGrainSize);
+
+	/**
+	 * Parallel std::for_each.
+	 * O(n / Workers::Count())
+	 *
+	 * @param range			The elements to visit.
+	 * @param func			Invoked with a reference to each element, in no particular order.
+	 * @param grainSize		How many elements each task visits.
+	 */
+	template<std::ranges::random_access_range Range, typename Func>
+	void ForEach(Range& range, Func func, size_t grainSize = defaultGrainSize);
+
+	/**
+	 * Parallel std::transform.
+	 * O(n / Workers::Count())
+	 *
+	 * @param range			The elements to transform.
+	 * @param out			Where to write the transformed elements, must have room for all of them.
+	 * @param op			Invoked with each element of range, in no particular order.
+	 * @param grainSize		How many elements each task transforms.
+	 * @returns				An iterator past the last element written.
+	 */
+	template<std::ranges::random_access_range Range, std::random_access_iterator OutIt, typename UnaryOperation>
+	OutIt Transform(const Range& range, OutIt out, UnaryOperation op, size_t grainSize = defaultGrainSize);
+
+	/**
+	 * Parallel std::reduce.
+	 * Elements are combined in order but grouped arbitrarily, so op must be associative though needn't be commutative.
+	 * O(n / Workers::Count())
+	 *
+	 * @param range			The elements to reduce.
+	 * @param init			The value to start with.
+	 * @param op			Combines two Ts, or a T and an element.
+	 * @param grainSize		How many elements each task reduces.
+	 * @returns				init combined with every element.
+	 */
+	template<std::ranges::random_access_range Range, typename T, typename BinaryOperation>
+	[[nodiscard]] T Reduce(const Range& range, T init, BinaryOperation op, size_t grainSize = defaultGrainSize);
+
+	/**
+	 * Parallel merge sort.
+	 * Each chunk is std::sort'd, then neighbouring chunks are merged in rounds, so it's not stable.
+	 * O(n log n / Workers::Count() + n log(n / grainSize))
+	 *
+	 * @param range			The elements to sort.
+	 * @param compare		Whether the first argument belongs before the second.
+	 * @param grainSize		How many elements each task sorts before merging.
+	 */
+	template<std::ranges::random_access_range Range, typename Compare = std::less<>>
+	void Sort(Range& range, Compare compare = {}, size_t grainSize = defaultGrainSize);
+
+	/**
+	 * Parallel std::partition.
+	 * Each chunk is std::partition'd, then the chunks are gathered through a temporary buffer, so it's not stable.
+	 * predicate is invoked once per element.
+	 * O(n / Workers::Count())
+	 *
+	 * @param range			The elements to partition.
+	 * @param predicate		Whether an element belongs in the first group.
+	 * @param grainSize		How many elements each task partitions.
+	 * @returns				An iterator to the first element of the second group.
+	 */
+	template<std::ranges::random_access_range Range, typename Predicate>
+	std::ranges::iterator_t<Range> Partition(Range& range, Predicate predicate, size_t grainSize = defaultGrainSize);
+}
+
+#include "Parallel.inl"
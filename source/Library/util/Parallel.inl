@@ -0,0 +1,148 @@
+// MIT License Copyright (c) 2020 Jarrett Wendt
+
+#pragma once
+#include "Parallel.h"
+
+#include <algorithm>	// std::for_each, std::transform, std::sort, std::inplace_merge, std::partition
+#include <numeric>		// std::accumulate
+#include <optional>
+
+namespace Library::Util::Parallel
+{
+	template<std::invocable<size_t, size_t> Func>
+	inline void ForEachChunk(const size_t size, Func func, size_t grainSize)
+	{
+		grainSize = std::max(grainSize, size_t(1));
+		const size_t numChunks = (size + grainSize - 1) / grainSize;
+		Workers::Run(numChunks, [&func, size, grainSize](const size_t i)
+		{
+			func(i * grainSize, std::min(size, (i + 1) * grainSize));
+		});
+	}
+
+	template<std::ranges::random_access_range Range, typename Func>
+	inline void ForEach(Range& range, Func func, const size_t grainSize)
+	{
+		const auto first = std::ranges::begin(range);
+		ForEachChunk(std::ranges::size(range), [&func, first](const size_t begin, const size_t end)
+		{
+			std::for_each(first + begin, first + end, func);
+		}, grainSize);
+	}
+
+	template<std::ranges::random_access_range Range, std::random_access_iterator OutIt, typename UnaryOperation>
+	inline OutIt Transform(const Range& range, OutIt out, UnaryOperation op, const size_t grainSize)
+	{
+		const auto first = std::ranges::begin(range);
+		const size_t size = std::ranges::size(range);
+		ForEachChunk(size, [&op, first, out](const size_t begin, const size_t end)
+		{
+			std::transform(first + begin, first + end, out + begin, op);
+		}, grainSize);
+		return out + size;
+	}
+
+	template<std::ranges::random_access_range Range, typename T, typename BinaryOperation>
+	inline T Reduce(const Range& range, T init, BinaryOperation op, size_t grainSize)
+	{
+		grainSize = std::max(grainSize, size_t(1));
+		const auto first = std::ranges::begin(range);
+		const size_t size = std::ranges::size(range);
+
+		// T needn't be default constructible
+		std::vector<std::optional<T>> partials((size + grainSize - 1) / grainSize);
+		ForEachChunk(size, [&op, &partials, first, grainSize](const size_t begin, const size_t end)
+		{
+			partials[begin / grainSize] = std::accumulate(first + begin + 1, first + end, T(first[begin]), op);
+		}, grainSize);
+
+		for (std::optional<T>& partial : partials)
+		{
+			init = op(std::move(init), std::move(*partial));
+		}
+		return init;
+	}
+
+	template<std::ranges::random_access_range Range, typename Compare>
+	inline void Sort(Range& range, Compare compare, size_t grainSize)
+	{
+		grainSize = std::max(grainSize, size_t(1));
+		const auto first = std::ranges::begin(range);
+		const size_t size = std::ranges::size(range);
+
+		ForEachChunk(size, [&compare, first](const size_t begin, const size_t end)
+		{
+			std::sort(first + begin, first + end, compare);
+		}, grainSize);
+
+		// Each round merges pairs of sorted runs into runs twice as long.
+		for (size_t width = grainSize; width < size; width *= 2)
+		{
+			const size_t numMerges = (size + 2 * width - 1) / (2 * width);
+			Workers::Run(numMerges, [&compare, first, size, width](const size_t i)
+			{
+				const size_t begin = i * 2 * width;
+				const size_t middle = std::min(size, begin + width);
+				const size_t end = std::min(size, begin + 2 * width);
+				std::inplace_merge(first + begin, first + middle, first + end, compare);
+			});
+		}
+	}
+
+	template<std::ranges::random_access_range Range, typename Predicate>
+	inline std::ranges::iterator_t<Range> Partition(Range& range, Predicate predicate, size_t grainSize)
+	{
+		using T = std::ranges::range_value_t<Range>;
+
+		grainSize = std::max(grainSize, size_t(1));
+		const auto first = std::ranges::begin(range);
+		const size_t size = std::ranges::size(range);
+		const size_t numChunks = (size + grainSize - 1) / grainSize;
+
+		// Partition each chunk in place, remembering where its second group starts.
+		std::vector<size_t> middles(numChunks);
+		ForEachChunk(size, [&predicate, &middles, first, grainSize](const size_t begin, const size_t end)
+		{
+			middles[begin / grainSize] = std::partition(first + begin, first + end, predicate) - first;
+		}, grainSize);
+
+		// Where each chunk's two groups go once they're gathered.
+		std::vector<size_t> trueDests(numChunks), falseDests(numChunks);
+		size_t numTrue = 0;
+		for (size_t i = 0; i < numChunks; ++i)
+		{
+			trueDests[i] = numTrue;
+			numTrue += middles[i] - i * grainSize;
+		}
+		for (size_t i = 0, numFalse = 0; i < numChunks; ++i)
+		{
+			falseDests[i] = numTrue + numFalse;
+			numFalse += std::min(size, (i + 1) * grainSize) - middles[i];
+		}
+
+		T* buffer = Memory::Malloc<T>(size);
+		ForEachChunk(size, [&middles, &trueDests, &falseDests, buffer, first, grainSize](const size_t begin, const size_t end)
+		{
+			const size_t chunk = begin / grainSize;
+			for (size_t i = begin, dest = trueDests[chunk]; i < middles[chunk]; ++i, ++dest)
+			{
+				new (buffer + dest) T(std::move(first[i]));
+			}
+			for (size_t i = middles[chunk], dest = falseDests[chunk]; i < end; ++i, ++dest)
+			{
+				new (buffer + dest) T(std::move(first[i]));
+			}
+		}, grainSize);
+		ForEachChunk(size, [buffer, first](const size_t begin, const size_t end)
+		{
+			for (size_t i = begin; i < end; ++i)
+			{
+				first[i] = std::move(buffer[i]);
+				buffer[i].~T();
+			}
+		}, grainSize);
+		Memory::Free(buffer);
+
+		return first + numTrue;
+	}
+}
@@ -78,6 +78,23 @@ namespace Library::Util
 	template<typename...>
 	constexpr std::false_type DependentFalse{};
 
+	/**
+	 * Whether a T can be moved to another address with a memcpy, leaving nothing behind to destruct.
+	 * Every trivially copyable type can be.
+	 * Other types opt in with a specialization as long as nothing points into them, which rules out std::string's small buffer for example.
+	 * Containers use this to grow with realloc and shift with memmove rather than moving and destructing each element.
+	 */
+	template<typename T>
+	struct IsTriviallyRelocatable : std::is_trivially_copyable<T> {};
+
+	/**
+	 * Whether a T's operator== gives the same answer as comparing its bytes, so searches can compare many at once with SIMD.
+	 * True for integers, enums and pointers, but not floats since 0.f == -0.f and NaN != NaN.
+	 * Other types opt in with a specialization as long as they have no padding and their operator== is a memcmp.
+	 */
+	template<typename T>
+	struct IsBitwiseComparable : std::bool_constant<std::is_integral_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>> {};
+
 #pragma region Query
 	/**
 	 * performs a linear query over the range using a predicate
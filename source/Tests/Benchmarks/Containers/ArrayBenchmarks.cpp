@@ -0,0 +1,161 @@
+#include "../../pch.h"
+#include "Array.h"
+#include "Datum.h"
+#include "InternedString.h"
+#include "Vector4.h"
+
+using namespace Library;
+
+#define BENCH(name) TEST_CASE("Array::" #name, "[.][benchmark][Array]")
+
+namespace UnitTests
+{
+	/**
+	 * Hides whether T IsTriviallyRelocatable so Array has to move and destruct it one element at a time.
+	 */
+	template<typename T>
+	struct Moved final
+	{
+		T t;
+
+		Moved(const T& t) : t(t) {}
+		Moved(const Moved& other) = default;
+		Moved(Moved&& other) noexcept : t(std::move(other.t)) {}
+		Moved& operator=(const Moved& other) = default;
+		Moved& operator=(Moved&& other) noexcept = default;
+		~Moved() = default;
+	};
+
+	static_assert(!Util::IsTriviallyRelocatable<Moved<String>>::value);
+	static_assert(Util::IsTriviallyRelocatable<String>::value);
+	static_assert(Util::IsTriviallyRelocatable<Datum>::value);
+
+	/**
+	 * Grows an Array one element at a time without reserving, so most of the work is reallocating.
+	 */
+	BENCH(Growth)
+	{
+		constexpr size_t numElements = 1 << 12;
+
+		std::vector<String> strings;
+		std::vector<Datum> datums;
+		for (size_t i = 0; i < numElements; ++i)
+		{
+			strings.emplace_back(std::to_string(i));
+			datums.push_back(Datum{ int(i), int(i + 1), int(i + 2) });
+		}
+
+		const auto run = []<typename Element, typename T>(const std::vector<T>& values)
+		{
+			Array<Element> array;
+			for (const T& t : values)
+			{
+				array.EmplaceBack(t);
+			}
+			return array.Size();
+		};
+
+		BENCHMARK("Array<String> moved")
+		{
+			return run.template operator()<Moved<String>>(strings);
+		};
+
+		BENCHMARK("Array<String> relocated")
+		{
+			return run.template operator()<String>(strings);
+		};
+
+		BENCHMARK("Array<Datum> moved")
+		{
+			return run.template operator()<Moved<Datum>>(datums);
+		};
+
+		BENCHMARK("Array<Datum> relocated")
+		{
+			return run.template operator()<Datum>(datums);
+		};
+	}
+
+	/**
+	 * Inserts at and removes from the front of an Array, so every operation shifts every element.
+	 */
+	BENCH(InsertRemove)
+	{
+		constexpr size_t numElements = 1 << 10;
+		constexpr size_t numOperations = 1 << 8;
+
+		const String string = "relocate";
+		const Datum datum{ 1, 2, 3 };
+
+		const auto run = []<typename Element, typename T>(const T& t)
+		{
+			Array<Element> array(numElements, Element(t));
+			for (size_t i = 0; i < numOperations; ++i)
+			{
+				array.Emplace(0, t);
+				array.RemoveAt(numElements / 2);
+			}
+			return array.Size();
+		};
+
+		BENCHMARK("Array<String> moved")
+		{
+			return run.template operator()<Moved<String>>(string);
+		};
+
+		BENCHMARK("Array<String> relocated")
+		{
+			return run.template operator()<String>(string);
+		};
+
+		BENCHMARK("Array<Datum> moved")
+		{
+			return run.template operator()<Moved<Datum>>(datum);
+		};
+
+		BENCHMARK("Array<Datum> relocated")
+		{
+			return run.template operator()<Datum>(datum);
+		};
+	}
+
+	/**
+	 * Searches for an element that isn't there, so every element gets compared.
+	 */
+	BENCH(Search)
+	{
+		constexpr size_t numElements = 1 << 16;
+
+		const auto run = []<typename T>(const char* name, const T& fill, const T& missing)
+		{
+			const Array<T> array(numElements, fill);
+			const std::string prefix = std::string("Array<") + name + "> ";
+
+			BENCHMARK(prefix + "std::find")
+			{
+				return std::find(array.begin(), array.end(), missing) - array.begin();
+			};
+
+			BENCHMARK(prefix + "IndexOf")
+			{
+				return array.IndexOf(missing);
+			};
+
+			BENCHMARK(prefix + "std::count")
+			{
+				return std::count(array.begin(), array.end(), missing);
+			};
+
+			BENCHMARK(prefix + "Count")
+			{
+				return array.Count(missing);
+			};
+		};
+
+		run("char", 'a', 'b');
+		run("int", 1, 2);
+		run("float", 1.f, 2.f);
+		run("double", 1.0, 2.0);
+		run("Vector4", Vector4::One, Vector4::Zero);
+	}
+}
@@ -0,0 +1,116 @@
+#include "../../pch.h"
+#include "BitArray.h"
+
+using namespace Library;
+
+#define BENCH(name) TEST_CASE("BitArray::" #name, "[.][benchmark][BitArray]")
+
+namespace UnitTests
+{
+	/**
+	 * A big visibility mask where roughly 1 in 100 flags is set, as an Array<bool> and as a BitArray.
+	 */
+	struct Mask final
+	{
+		constexpr static size_t numFlags = 1 << 20;
+
+		Array<bool> bytes{};
+		BitArray<> bits{};
+
+		Mask()
+		{
+			std::mt19937_64 rng{ 1 };
+			std::bernoulli_distribution chance{ 0.01 };
+			bytes.Reserve(numFlags);
+			bits.Reserve(numFlags);
+			for (size_t i = 0; i < numFlags; ++i)
+			{
+				const bool t = chance(rng);
+				bytes.PushBack(t);
+				bits.PushBack(t);
+			}
+		}
+	};
+
+	BENCH(Memory)
+	{
+		const Mask mask{};
+		WARN("Array<bool> holds " << mask.bytes.Capacity() * sizeof(bool) << " bytes, BitArray holds " << mask.bits.Capacity() / 8 << " bytes");
+	}
+
+	BENCH(Count)
+	{
+		const Mask mask{};
+
+		BENCHMARK("Array<bool>")
+		{
+			return std::count(mask.bytes.begin(), mask.bytes.end(), true);
+		};
+
+		BENCHMARK("BitArray")
+		{
+			return mask.bits.Count(true);
+		};
+	}
+
+	BENCH(IndexOf)
+	{
+		// searching a mask where only the last flag is set
+		Array<bool> bytes(Mask::numFlags, false);
+		BitArray<> bits(Mask::numFlags, false);
+		bytes.Back() = true;
+		bits.Back() = true;
+
+		BENCHMARK("Array<bool>")
+		{
+			return std::find(bytes.begin(), bytes.end(), true) - bytes.begin();
+		};
+
+		BENCHMARK("BitArray")
+		{
+			return bits.IndexOf(true);
+		};
+	}
+
+	BENCH(ForEachSet)
+	{
+		const Mask mask{};
+
+		BENCHMARK("Array<bool>")
+		{
+			size_t ret = 0;
+			for (size_t i = 0; i < mask.bytes.Size(); ++i)
+			{
+				if (mask.bytes[i])
+				{
+					ret += i;
+				}
+			}
+			return ret;
+		};
+
+		BENCHMARK("BitArray")
+		{
+			size_t ret = 0;
+			mask.bits.ForEachIndexOf(true, [&ret](const size_t i) { ret += i; });
+			return ret;
+		};
+	}
+
+	BENCH(RemoveAll)
+	{
+		const Mask mask{};
+
+		BENCHMARK_ADVANCED("Array<bool>")(Catch::Benchmark::Chronometer meter)
+		{
+			std::vector<Array<bool>> copies(meter.runs(), mask.bytes);
+			meter.measure([&copies](const int i) { return copies[i].RemoveAll(true); });
+		};
+
+		BENCHMARK_ADVANCED("BitArray")(Catch::Benchmark::Chronometer meter)
+		{
+			std::vector<BitArray<>> copies(meter.runs(), mask.bits);
+			meter.measure([&copies](const int i) { return copies[i].RemoveAll(true); });
+		};
+	}
+}
@@ -0,0 +1,128 @@
+#include "../../pch.h"
+#include "ChunkedList.h"
+
+using namespace Library;
+
+#define BENCH(name) TEST_CASE("ChunkedList::" #name, "[.][benchmark][ChunkedList]")
+
+namespace UnitTests
+{
+	constexpr size_t numElements = 1 << 18;
+
+	/**
+	 * Builds each list a bit at a time, round robin, so their Nodes are scattered across the heap
+	 * the way they are in a long running program rather than laid out back to back.
+	 */
+	template<typename List>
+	static std::vector<List> Interleaved(const size_t numLists)
+	{
+		std::vector<List> ret(numLists);
+		for (size_t i = 0; i < numElements; ++i)
+		{
+			ret[i % numLists].PushBack(i);
+		}
+		return ret;
+	}
+
+	/**
+	 * Walks every element, which is where an SList spends a cache miss per element.
+	 */
+	BENCH(Traverse)
+	{
+		const auto run = []<typename List>(const std::vector<List>& lists)
+		{
+			size_t ret = 0;
+			for (const List& list : lists)
+			{
+				for (const size_t i : list)
+				{
+					ret += i;
+				}
+			}
+			return ret;
+		};
+
+		const auto slists = Interleaved<SList<size_t>>(16);
+		const auto chunkedLists = Interleaved<ChunkedList<size_t>>(16);
+
+		BENCHMARK("SList")
+		{
+			return run(slists);
+		};
+
+		BENCHMARK("ChunkedList")
+		{
+			return run(chunkedLists);
+		};
+	}
+
+	BENCH(PushBack)
+	{
+		const auto run = []<typename List>()
+		{
+			List list;
+			for (size_t i = 0; i < numElements; ++i)
+			{
+				list.PushBack(i);
+			}
+			return list.Size();
+		};
+
+		BENCHMARK("SList")
+		{
+			return run.template operator()<SList<size_t>>();
+		};
+
+		BENCHMARK("ChunkedList")
+		{
+			return run.template operator()<ChunkedList<size_t>>();
+		};
+
+		BENCHMARK("SList PoolAllocator")
+		{
+			return run.template operator()<SList<size_t, PoolAllocator<size_t>>>();
+		};
+
+		BENCHMARK("ChunkedList PoolAllocator")
+		{
+			return run.template operator()<ChunkedList<size_t, PoolAllocator<size_t>>>();
+		};
+	}
+
+	/**
+	 * The same workload as SList::PushPop, through a Queue.
+	 */
+	BENCH(Queue)
+	{
+		constexpr size_t population = 1 << 10;
+		constexpr size_t numOperations = 1 << 16;
+
+		const auto run = []<typename Queue>(Queue& queue)
+		{
+			for (size_t i = 0; i < numOperations; ++i)
+			{
+				queue.Dequeue();
+				queue.Enqueue(i);
+			}
+			return queue.Front();
+		};
+
+		Queue<size_t, SList<size_t>> slistQueue{};
+		Queue<size_t, ChunkedList<size_t>> chunkedQueue{};
+		for (size_t i = 0; i < population; ++i)
+		{
+			slistQueue.Enqueue(i);
+			chunkedQueue.Enqueue(i);
+		}
+
+		BENCHMARK("SList")
+		{
+			return run(slistQueue);
+		};
+
+		BENCHMARK("ChunkedList")
+		{
+			return run(chunkedQueue);
+		};
+	}
+}
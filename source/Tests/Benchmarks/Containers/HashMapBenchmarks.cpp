@@ -0,0 +1,42 @@
+#include "../../pch.h"
+
+using namespace Library;
+
+#define BENCH(name) TEST_CASE("HashMap::" #name, "[.][benchmark][HashMap]")
+
+namespace UnitTests
+{
+	/**
+	 * Every insert allocates a node in one of the chains and every removal frees one.
+	 */
+	BENCH(InsertRemove)
+	{
+		constexpr int numKeys = 1 << 12;
+
+		const auto run = []<typename Map>(Map& map)
+		{
+			for (int i = 0; i < numKeys; ++i)
+			{
+				map.Emplace(i, i);
+			}
+			for (int i = 0; i < numKeys; ++i)
+			{
+				map.Remove(i);
+			}
+			return map.Size();
+		};
+
+		HashMap<int, int> mallocMap{};
+		HashMap<int, int, Hash<int>, std::equal_to<int>, Util::PrimeReserveStrategy, PoolAllocator<int>> poolMap{};
+
+		BENCHMARK("Allocator")
+		{
+			return run(mallocMap);
+		};
+
+		BENCHMARK("PoolAllocator")
+		{
+			return run(poolMap);
+		};
+	}
+}
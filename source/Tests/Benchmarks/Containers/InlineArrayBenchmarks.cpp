@@ -0,0 +1,51 @@
+#include "../../pch.h"
+#include "InlineArray.h"
+
+using namespace Library;
+
+#define BENCH(name) TEST_CASE("InlineArray::" #name, "[.][benchmark][InlineArray]")
+
+namespace UnitTests
+{
+	/**
+	 * Builds and tears down lots of arrays which only ever hold a couple of elements,
+	 * like the keys held down in a frame or the exceptions thrown by one Event.
+	 */
+	BENCH(SmallArrays)
+	{
+		constexpr size_t numArrays = 1 << 12;
+		constexpr size_t numElements = 3;
+
+		const auto run = []<typename Container>()
+		{
+			std::vector<Container> arrays(numArrays);
+			for (Container& array : arrays)
+			{
+				for (size_t i = 0; i < numElements; ++i)
+				{
+					array.PushBack(i);
+				}
+			}
+
+			size_t ret = 0;
+			for (const Container& array : arrays)
+			{
+				for (const size_t i : array)
+				{
+					ret += i;
+				}
+			}
+			return ret;
+		};
+
+		BENCHMARK("Array")
+		{
+			return run.template operator()<Array<size_t>>();
+		};
+
+		BENCHMARK("InlineArray")
+		{
+			return run.template operator()<InlineArray<size_t, 4>>();
+		};
+	}
+}
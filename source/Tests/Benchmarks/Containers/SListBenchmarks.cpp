@@ -0,0 +1,93 @@
+#include "../../pch.h"
+
+using namespace Library;
+
+#define BENCH(name) TEST_CASE("SList::" #name, "[.][benchmark][SList]")
+
+namespace UnitTests
+{
+	/**
+	 * Queue-style workload where every push allocates a node and every pop frees one.
+	 * Without a Pool this is dominated by the system allocator.
+	 */
+	BENCH(PushPop)
+	{
+		constexpr size_t population = 1 << 10;
+		constexpr size_t numOperations = 1 << 16;
+
+		const auto run = []<typename List>(List& list)
+		{
+			for (size_t i = 0; i < numOperations; ++i)
+			{
+				list.PopFront();
+				list.PushBack(i);
+			}
+			return list.Front();
+		};
+
+		SList<size_t> mallocList{};
+		SList<size_t, PoolAllocator<size_t>> poolList{};
+		SList<size_t, RecyclingAllocator<size_t>> recyclingList{};
+		for (size_t i = 0; i < population; ++i)
+		{
+			mallocList.PushBack(i);
+			poolList.PushBack(i);
+			recyclingList.PushBack(i);
+		}
+
+		BENCHMARK("Allocator")
+		{
+			return run(mallocList);
+		};
+
+		BENCHMARK("PoolAllocator")
+		{
+			return run(poolList);
+		};
+
+		BENCHMARK("RecyclingAllocator")
+		{
+			return run(recyclingList);
+		};
+	}
+
+	/**
+	 * A list which is built up and cleared every frame, like Event's pending operations.
+	 */
+	BENCH(ClearEveryFrame)
+	{
+		constexpr size_t numFrames = 1 << 10;
+		constexpr size_t opsPerFrame = 32;
+
+		const auto run = []<typename List>()
+		{
+			List list{};
+			size_t ret = 0;
+			for (size_t frame = 0; frame < numFrames; ++frame)
+			{
+				for (size_t i = 0; i < opsPerFrame; ++i)
+				{
+					list.PushBack(i);
+				}
+				ret += list.Size();
+				list.Clear();
+			}
+			return ret;
+		};
+
+		BENCHMARK("Allocator")
+		{
+			return run.template operator()<SList<size_t>>();
+		};
+
+		BENCHMARK("PoolAllocator")
+		{
+			return run.template operator()<SList<size_t, PoolAllocator<size_t>>>();
+		};
+
+		BENCHMARK("RecyclingAllocator")
+		{
+			return run.template operator()<SList<size_t, RecyclingAllocator<size_t>>>();
+		};
+	}
+}
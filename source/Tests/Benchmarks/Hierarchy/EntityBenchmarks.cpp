@@ -0,0 +1,64 @@
+#include "../../pch.h"
+#include "Engine.h"
+
+using namespace Library;
+
+#define BENCH(name) TEST_CASE("Entity::" #name, "[.][benchmark][Entity]")
+
+namespace UnitTests
+{
+	/**
+	 * Visits every Entity in the same order Update does.
+	 */
+	static size_t DepthFirst(Entity& entity)
+	{
+		size_t ret = 1;
+		for (auto& child : entity)
+		{
+			if (child->Enabled())
+			{
+				ret += DepthFirst(*child);
+			}
+		}
+		return ret;
+	}
+
+	/**
+	 * Builds a World of 100k Entities breadth first with other allocations interleaved, like a level which was loaded in pieces.
+	 * Walking it depth first jumps all over memory until Engine::Defrag lays each subtree out together.
+	 */
+	BENCH(Defrag)
+	{
+		constexpr size_t numEntities = 100'000;
+		constexpr size_t numChildren = 4;
+
+		Engine::Init();
+		Entity& world = Engine::World();
+
+		std::vector<SharedPtr<std::array<std::byte, 64>>> garbage{};
+		std::vector<Entity*> parents{ &world };
+		for (size_t i = 0; parents.size() < numEntities; ++i)
+		{
+			Entity& parent = *parents[i];
+			for (size_t j = 0; j < numChildren && parents.size() < numEntities; ++j)
+			{
+				parents.push_back(&*parent.CreateChild(String{ std::to_string(j) }));
+				garbage.push_back(SharedPtr<std::array<std::byte, 64>>::Make());
+			}
+		}
+		garbage.clear();
+		parents.clear();
+
+		BENCHMARK("allocation order")
+		{
+			return DepthFirst(world);
+		};
+
+		Engine::Defrag();
+
+		BENCHMARK("Engine::Defrag")
+		{
+			return DepthFirst(world);
+		};
+	}
+}
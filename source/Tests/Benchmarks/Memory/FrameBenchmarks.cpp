@@ -0,0 +1,57 @@
+#include "../../pch.h"
+#include "Frame.h"
+#include "LibAllocator.h"
+
+using namespace Library;
+
+#define BENCH(name) TEST_CASE("Memory::Frame::" #name, "[.][benchmark][Memory::Frame]")
+
+namespace UnitTests
+{
+	/**
+	 * Mimics Coroutines' pending ops: a list which is filled up during a frame then cleared at the start of the next.
+	 * With the Frame, clearing doesn't free anything and Reset throws all the nodes away at once.
+	 */
+	BENCH(PendingOps)
+	{
+		constexpr size_t numFrames = 64;
+		constexpr size_t opsPerFrame = 1 << 10;
+
+		Memory::Frame::Reserve(opsPerFrame * 64);
+
+		const auto run = []<typename List>(List& list)
+		{
+			size_t sum = 0;
+			for (size_t frame = 0; frame < numFrames; ++frame)
+			{
+				Memory::Frame::Reset();
+				for (const size_t op : list)
+				{
+					sum += op;
+				}
+				list.Clear();
+				for (size_t i = 0; i < opsPerFrame; ++i)
+				{
+					list.PushBack(i);
+				}
+			}
+			return sum;
+		};
+
+		SList<size_t> mallocList{};
+		SList<size_t, FrameAllocator<size_t>> frameList{};
+
+		BENCHMARK("Allocator")
+		{
+			return run(mallocList);
+		};
+
+		BENCHMARK("FrameAllocator")
+		{
+			return run(frameList);
+		};
+
+		// the nodes mustn't outlive their frame
+		frameList.Clear();
+	}
+}
@@ -0,0 +1,445 @@
+#include "../../pch.h"
+
+using namespace Library;
+
+#define BENCH(name) TEST_CASE("Memory::Manager::" #name, "[.][benchmark][Memory::Manager]")
+
+namespace UnitTests
+{
+	/**
+	 * @returns		how many bytes of this process are resident in physical memory, 0 if unknown
+	 */
+	static size_t ResidentBytes()
+	{
+		size_t numPages = 0;
+		size_t numResident = 0;
+#ifdef __linux__
+		std::ifstream("/proc/self/statm") >> numPages >> numResident;
+#endif
+		return numResident * Memory::PageSize();
+	}
+
+	/**
+	 * Runs f on a fresh thread, so that it gets its own Heaps which are all created under policy.
+	 */
+	template<typename F>
+	static void WithPolicy(const Memory::Manager::Policy& policy, F f)
+	{
+		std::thread([&policy, &f]
+		{
+			Memory::Manager::SetPolicy(policy);
+			f();
+			Memory::Manager::Defrag();
+			Memory::Manager::ShrinkToFit();
+		}).join();
+	}
+	
+	/**
+	 * Every thread does the same amount of work.
+	 * With contention-free allocation the time should stay flat as threads are added, up to the core count.
+	 */
+	BENCH(ThreadedMake)
+	{
+		constexpr size_t allocationsPerThread = 1 << 16;
+
+		for (size_t numThreads = 1; numThreads <= std::thread::hardware_concurrency(); numThreads *= 2)
+		{
+			BENCHMARK(std::to_string(numThreads) + " threads")
+			{
+				std::vector<std::thread> threads{};
+				threads.reserve(numThreads);
+				for (size_t i = 0; i < numThreads; ++i)
+				{
+					threads.emplace_back([]
+					{
+						std::vector<SharedPtr<uint64_t>> ptrs{};
+						ptrs.reserve(allocationsPerThread);
+						for (uint64_t j = 0; j < allocationsPerThread; ++j)
+						{
+							ptrs.push_back(SharedPtr<uint64_t>::Make(j));
+						}
+						ptrs.clear();
+						Memory::Manager::ShrinkToFit();
+					});
+				}
+				for (std::thread& thread : threads)
+				{
+					thread.join();
+				}
+			};
+		}
+	}
+
+	/**
+	 * Allocates with every Heap but the newest full of long-lived objects, like after a long session.
+	 * Full Heaps are skipped without being asked, so the latency should stay flat as Heaps are added.
+	 */
+	BENCH(AllocLatency)
+	{
+		for (const size_t numHeaps : { 4, 8, 12, 16 })
+		{
+			WithPolicy({}, [numHeaps]
+			{
+				using Object = std::array<uint64_t, 8>;
+				constexpr size_t numSamples = 1 << 14;
+
+				// keep allocating until the last Heap is made, every one before it is then full
+				std::vector<SharedPtr<Object>> survivors{};
+				while (Memory::Manager::TotalBytes() < 1024 * ((size_t(1) << numHeaps) - 1))
+				{
+					survivors.push_back(SharedPtr<Object>::Make());
+				}
+
+				std::vector<SharedPtr<Object>> ptrs{};
+				ptrs.reserve(numSamples);
+				std::vector<std::chrono::nanoseconds> latencies(numSamples);
+				for (std::chrono::nanoseconds& latency : latencies)
+				{
+					const auto start = std::chrono::steady_clock::now();
+					ptrs.push_back(SharedPtr<Object>::Make());
+					latency = std::chrono::steady_clock::now() - start;
+				}
+
+				std::sort(latencies.begin(), latencies.end());
+				const auto percentile = [&latencies](const double p) { return latencies[size_t(p * (latencies.size() - 1))].count(); };
+				WARN(numHeaps << " Heaps: p50 " << percentile(0.5) << " ns, p99 " << percentile(0.99) << " ns, p99.9 " << percentile(0.999) << " ns");
+			});
+		}
+	}
+
+	/**
+	 * Particle-style workload where a fixed population is constantly replaced without ever Defragging.
+	 * Freed holes get reused, so the Heaps stop growing once the population is reached.
+	 */
+	BENCH(Churn)
+	{
+		struct Particle
+		{
+			float position[3]{};
+			float velocity[3]{};
+			float lifetime{};
+		};
+		
+		constexpr size_t population = 1 << 12;
+		constexpr size_t spawnsPerFrame = population / 8;
+		constexpr size_t numFrames = 256;
+
+		std::deque<SharedPtr<Particle>> particles{};
+		for (size_t i = 0; i < population; ++i)
+		{
+			particles.push_back(SharedPtr<Particle>::Make());
+		}
+
+		BENCHMARK(std::to_string(numFrames) + " frames")
+		{
+			for (size_t frame = 0; frame < numFrames; ++frame)
+			{
+				for (size_t i = 0; i < spawnsPerFrame; ++i)
+				{
+					particles.pop_front();
+					particles.push_back(SharedPtr<Particle>::Make());
+				}
+			}
+			return Memory::Manager::TotalBytes();
+		};
+
+		particles.clear();
+		Memory::Manager::ShrinkToFit();
+	}
+
+	/**
+	 * Defrags Heaps where every other Handle has been freed.
+	 */
+	BENCH(Defrag)
+	{
+		for (const size_t numHandles : { size_t(1) << 14, size_t(1) << 17 })
+		{
+			BENCHMARK_ADVANCED(std::to_string(numHandles) + " handles")(Catch::Benchmark::Chronometer meter)
+			{
+				std::vector<SharedPtr<uint64_t>> ptrs{};
+				ptrs.reserve(numHandles);
+				for (uint64_t i = 0; i < numHandles; ++i)
+				{
+					ptrs.push_back(SharedPtr<uint64_t>::Make(i));
+				}
+				for (size_t i = 0; i < numHandles; i += 2)
+				{
+					ptrs[i] = nullptr;
+				}
+
+				meter.measure([] { Memory::Manager::Defrag(); });
+
+				ptrs.clear();
+				Memory::Manager::ShrinkToFit();
+			};
+		}
+	}
+
+	/**
+	 * A big generation where only a few long-lived objects survive.
+	 * Once Defragged, mapped Heaps give their unused tail back to the OS while Malloc'd ones stay resident.
+	 */
+	BENCH(Footprint)
+	{
+		constexpr size_t numObjects = 1 << 20;
+		constexpr size_t survivorInterval = 64;
+
+		for (const bool mapHeaps : { false, true })
+		{
+			Memory::Manager::Policy policy{};
+			policy.mapHeaps = mapHeaps;
+			WithPolicy(policy, [mapHeaps]
+			{
+				std::vector<SharedPtr<uint64_t>> ptrs{};
+				ptrs.reserve(numObjects);
+				for (uint64_t i = 0; i < numObjects; ++i)
+				{
+					ptrs.push_back(SharedPtr<uint64_t>::Make(i));
+				}
+				for (size_t i = 0; i < numObjects; ++i)
+				{
+					if (i % survivorInterval)
+					{
+						ptrs[i] = nullptr;
+					}
+				}
+
+				const size_t before = ResidentBytes();
+				const auto start = std::chrono::steady_clock::now();
+				Memory::Manager::Defrag();
+				const std::chrono::duration<double, std::milli> time = std::chrono::steady_clock::now() - start;
+				const size_t after = ResidentBytes();
+
+				WARN((mapHeaps ? "mapped" : "malloc") << " Heaps: Defrag took " << time.count()
+					<< " ms and released " << (before - std::min(before, after) >> 10) << " KiB of " << (before >> 10) << " KiB resident");
+			});
+		}
+	}
+
+	/**
+	 * Objects which live for a frame but stay weakly referenced for a while, like children holding a WeakPtr to a parent that's gone.
+	 * Their bytes can be reused long before the last WeakPtr lets go of their Handles, so the Heaps stay small.
+	 */
+	BENCH(ExpiredWeakPtrs)
+	{
+		struct Node
+		{
+			std::byte payload[256]{};
+		};
+
+		WithPolicy({}, []
+		{
+			constexpr size_t spawnsPerFrame = 1 << 10;
+			constexpr size_t numFrames = 256;
+			// how many frames each WeakPtr outlives its object by
+			constexpr size_t weakLifetime = 64;
+
+			std::vector<SharedPtr<Node>> nodes{};
+			std::deque<WeakPtr<Node>> weaks{};
+			size_t peak = 0;
+			const auto start = std::chrono::steady_clock::now();
+			for (size_t frame = 0; frame < numFrames; ++frame)
+			{
+				nodes.clear();
+				for (size_t i = 0; i < spawnsPerFrame; ++i)
+				{
+					weaks.emplace_back(nodes.emplace_back(SharedPtr<Node>::Make()));
+				}
+				while (weaks.size() > spawnsPerFrame * weakLifetime)
+				{
+					weaks.pop_front();
+				}
+				Memory::Manager::Collect(std::chrono::milliseconds(1));
+				peak = std::max(peak, Memory::Manager::TotalBytes());
+			}
+			const std::chrono::duration<double, std::milli> time = std::chrono::steady_clock::now() - start;
+
+			WARN(numFrames << " frames took " << time.count() << " ms with at most " << (peak >> 10) << " KiB of Heaps");
+		});
+	}
+
+	/**
+	 * Time spent in Collect each frame under steady churn, with big Heaps Defragged in place versus in the background.
+	 * In the background, this thread only has to move objects over to their copies once they're done.
+	 * Every object touched while copying has to be copied again by this thread, so the game writes to a few of them or all of them.
+	 */
+	BENCH(DefragInBackground)
+	{
+		for (const size_t touchStride : { 64, 1 })
+		{
+			for (const bool defragInBackground : { false, true })
+			{
+				Memory::Manager::Policy policy{};
+				policy.defragInBackground = defragInBackground;
+				WithPolicy(policy, [defragInBackground, touchStride]
+				{
+					using Object = std::array<uint64_t, 4>;
+					constexpr size_t population = 1 << 17;
+					constexpr size_t spawnsPerFrame = population / 16;
+					constexpr size_t numFrames = 256;
+					constexpr auto budget = std::chrono::milliseconds(2);
+
+					std::deque<SharedPtr<Object>> objects{};
+					for (size_t i = 0; i < population; ++i)
+					{
+						objects.push_back(SharedPtr<Object>::Make());
+					}
+
+					std::vector<std::chrono::nanoseconds> times{};
+					times.reserve(numFrames);
+					for (size_t frame = 0; frame < numFrames; ++frame)
+					{
+						for (size_t i = 0; i < spawnsPerFrame; ++i)
+						{
+							objects.pop_front();
+							objects.push_back(SharedPtr<Object>::Make());
+						}
+						for (size_t i = frame % touchStride; i < population; i += touchStride)
+						{
+							(*objects[i])[0]++;
+						}
+
+						const auto start = std::chrono::steady_clock::now();
+						Memory::Manager::Collect(budget);
+						times.push_back(std::chrono::steady_clock::now() - start);
+					}
+
+					// in the background, this is FinishBackgroundDefrag fixing up the big Heaps plus DefragStep on the small ones
+					std::chrono::nanoseconds defragTime{ 0 };
+					for (const Memory::Manager::GenerationStats& stats : Memory::Manager::GetGenerationStats())
+					{
+						defragTime += stats.defragTime;
+					}
+
+					std::sort(times.begin(), times.end());
+					const auto total = std::accumulate(times.begin(), times.end(), std::chrono::nanoseconds(0));
+					WARN((defragInBackground ? "background" : "in place") << ", touching 1/" << touchStride << " per frame: Collect took "
+						<< total.count() / 1000 << " us in total, p50 " << times[numFrames / 2].count() / 1000 << " us, max "
+						<< times.back().count() / 1000 << " us, of which " << defragTime.count() / 1000 << " us Defragging on this thread");
+				});
+			}
+		}
+	}
+
+	/**
+	 * Visits objects spread across a big Heap in random order, which is dominated by TLB misses.
+	 * Mapped Heaps are backed by huge pages when the OS allows it, so they need far fewer TLB entries.
+	 */
+	BENCH(Traverse)
+	{
+		constexpr size_t numObjects = 1 << 21;
+
+		for (const bool mapHeaps : { false, true })
+		{
+			Memory::Manager::Policy policy{};
+			policy.mapHeaps = mapHeaps;
+			WithPolicy(policy, [mapHeaps]
+			{
+				std::vector<SharedPtr<uint64_t>> ptrs{};
+				ptrs.reserve(numObjects);
+				for (uint64_t i = 0; i < numObjects; ++i)
+				{
+					ptrs.push_back(SharedPtr<uint64_t>::Make(i));
+				}
+				std::vector<uint64_t*> order{};
+				order.reserve(numObjects);
+				for (SharedPtr<uint64_t>& ptr : ptrs)
+				{
+					order.push_back(&*ptr);
+				}
+				std::shuffle(order.begin(), order.end(), std::mt19937_64{});
+
+				BENCHMARK(mapHeaps ? "mapped" : "malloc")
+				{
+					uint64_t sum = 0;
+					for (const uint64_t* value : order)
+					{
+						sum += *value;
+					}
+					return sum;
+				};
+			});
+		}
+	}
+
+	struct TreeNode
+	{
+		SharedPtr<TreeNode> left{};
+		SharedPtr<TreeNode> right{};
+		uint64_t payload[6]{};
+	};
+
+	/**
+	 * Calls f on every node under and including node, parents before children.
+	 */
+	template<typename F>
+	static void DepthFirst(const SharedPtr<TreeNode>& node, F& f)
+	{
+		if (node)
+		{
+			f(node);
+			DepthFirst(node->left, f);
+			DepthFirst(node->right, f);
+		}
+	}
+
+	/**
+	 * Walks a tree depth-first where the nodes were allocated in random order.
+	 * A plain Defrag keeps that order, while a Defrag with the walk as its Layout puts each subtree next to each other.
+	 */
+	BENCH(Layout)
+	{
+		constexpr size_t numNodes = 100'000;
+
+		WithPolicy({}, []
+		{
+			std::vector<size_t> order(numNodes);
+			for (size_t i = 0; i < numNodes; ++i)
+			{
+				order[i] = i;
+			}
+			std::shuffle(order.begin(), order.end(), std::default_random_engine{});
+
+			std::vector<SharedPtr<TreeNode>> nodes(numNodes, nullptr);
+			for (const size_t i : order)
+			{
+				nodes[i] = SharedPtr<TreeNode>::Make();
+				nodes[i]->payload[0] = i;
+			}
+			// node i's children are 2i + 1 and 2i + 2
+			for (size_t i = 0; 2 * i + 1 < numNodes; ++i)
+			{
+				nodes[i]->left = nodes[2 * i + 1];
+				if (2 * i + 2 < numNodes)
+				{
+					nodes[i]->right = nodes[2 * i + 2];
+				}
+			}
+			const SharedPtr<TreeNode> root = nodes.front();
+			nodes.clear();
+
+			const auto sum = [&root]
+			{
+				uint64_t ret = 0;
+				auto add = [&ret](const SharedPtr<TreeNode>& node) { ret += node->payload[0]; };
+				DepthFirst(root, add);
+				return ret;
+			};
+
+			Memory::Manager::Defrag();
+			BENCHMARK("allocation order")
+			{
+				return sum();
+			};
+
+			Memory::Manager::Layout layout{};
+			auto push = [&layout](const SharedPtr<TreeNode>& node) { layout.PushBack(node); };
+			DepthFirst(root, push);
+			Memory::Manager::Defrag(layout);
+			BENCHMARK("depth-first Layout")
+			{
+				return sum();
+			};
+		});
+	}
+}
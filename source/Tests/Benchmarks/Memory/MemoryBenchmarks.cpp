@@ -0,0 +1,93 @@
+#include "../../pch.h"
+#include "Simd.h"
+
+using namespace Library;
+
+#define BENCH(name) TEST_CASE("Memory::" #name, "[.][benchmark][Memory]")
+
+namespace UnitTests
+{
+	/**
+	 * From fitting in L1 to well past the last level cache, where the kernels switch to streaming stores.
+	 */
+	static std::vector<size_t> BenchSizes()
+	{
+		return { size_t(256), size_t(4) << 10, size_t(32) << 10, size_t(256) << 10, size_t(2) << 20, Memory::NonTemporalThreshold() };
+	}
+
+	static std::string IsaName(const Memory::Isa isa)
+	{
+		switch (isa)
+		{
+		case Memory::Isa::AVX2: return "AVX2";
+		case Memory::Isa::SSE2: return "SSE2";
+		default: return "Scalar";
+		}
+	}
+
+	BENCH(Copy)
+	{
+		const std::vector<size_t> sizes = BenchSizes();
+		std::vector<std::byte> source(sizes.back(), std::byte(1));
+		std::vector<std::byte> dest(sizes.back());
+
+		for (const size_t size : sizes)
+		{
+			const std::string suffix = " " + std::to_string(size >> 10) + " KiB";
+
+			BENCHMARK("std::memcpy" + suffix)
+			{
+				std::memcpy(dest.data(), source.data(), size);
+				return dest[size - 1];
+			};
+
+			for (auto isa = uint8_t(Memory::Isa::SSE2); isa <= uint8_t(Memory::DetectIsa()); ++isa)
+			{
+				BENCHMARK(IsaName(Memory::Isa(isa)) + suffix)
+				{
+					Memory::SimdCopy(dest.data(), source.data(), size, Memory::Isa(isa));
+					return dest[size - 1];
+				};
+			}
+		}
+	}
+
+	/**
+	 * Heap::DebugFill's 0xF1EA pattern, compared with a byte memset which can't do 2 byte patterns and the word at a time loop it replaced.
+	 */
+	BENCH(Fill)
+	{
+		const std::vector<size_t> sizes = BenchSizes();
+		std::vector<std::byte> dest(sizes.back());
+
+		for (const size_t size : sizes)
+		{
+			const std::string suffix = " " + std::to_string(size >> 10) + " KiB";
+
+			BENCHMARK("std::memset" + suffix)
+			{
+				std::memset(dest.data(), 0xEA, size);
+				return dest[size - 1];
+			};
+
+			BENCHMARK("word loop" + suffix)
+			{
+				auto* words = reinterpret_cast<uint16_t*>(dest.data());
+				for (size_t i = 0; i < size / 2; ++i)
+				{
+					words[i] = 0xF1EA;
+				}
+				return dest[size - 1];
+			};
+
+			for (auto isa = uint8_t(Memory::Isa::SSE2); isa <= uint8_t(Memory::DetectIsa()); ++isa)
+			{
+				BENCHMARK(IsaName(Memory::Isa(isa)) + suffix)
+				{
+					Memory::SimdFill(dest.data(), 0xF1EA, size, Memory::Isa(isa));
+					return dest[size - 1];
+				};
+			}
+		}
+	}
+}
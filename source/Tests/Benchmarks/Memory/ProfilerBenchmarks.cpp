@@ -0,0 +1,49 @@
+#include "../../pch.h"
+#include "Profiler.h"
+
+using namespace Library;
+using namespace Library::Memory;
+
+#define BENCH(name) TEST_CASE("Memory::Profiler::" #name, "[.][benchmark][Memory::Profiler]")
+
+namespace UnitTests
+{
+	/**
+	 * What the hooks cost Malloc and Free while stopped, and at a few sample intervals.
+	 */
+	BENCH(Malloc)
+	{
+		constexpr size_t numAllocs = 10'000;
+		std::vector<void*> ptrs(numAllocs);
+
+		const auto run = [&ptrs]
+		{
+			for (void*& p : ptrs)
+			{
+				p = Malloc(64);
+			}
+			for (void*& p : ptrs)
+			{
+				Free(p);
+			}
+			return ptrs.size();
+		};
+
+		Profiler::Clear();
+		BENCHMARK("stopped")
+		{
+			return run();
+		};
+
+		for (const size_t interval : { 4096, 256, 1 })
+		{
+			Profiler::Start(interval);
+			BENCHMARK("every " + std::to_string(interval))
+			{
+				return run();
+			};
+			Profiler::Stop();
+		}
+		Profiler::Clear();
+	}
+}
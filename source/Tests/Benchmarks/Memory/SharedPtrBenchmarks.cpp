@@ -0,0 +1,143 @@
+#include "../../pch.h"
+
+using namespace Library;
+
+#define BENCH(name) TEST_CASE("SharedPtr::" #name, "[.][benchmark][SharedPtr]")
+
+namespace UnitTests
+{
+	/**
+	 * Copying and destroying is all reference counting, so this compares the cost of each RefCount policy.
+	 */
+	BENCH(Copy)
+	{
+		constexpr size_t numCopies = 1 << 16;
+
+		auto copy = [](auto& ptr)
+		{
+			for (size_t i = 0; i < numCopies; ++i)
+			{
+				auto copy = ptr;
+				Catch::Benchmark::deoptimize_value(copy);
+			}
+		};
+
+		auto shared = SharedPtr<uint64_t>::Make();
+		auto atomic = AtomicSharedPtr<uint64_t>::Make();
+		auto std = std::make_shared<uint64_t>();
+
+		BENCHMARK("SharedPtr") { copy(shared); };
+		BENCHMARK("AtomicSharedPtr") { copy(atomic); };
+		BENCHMARK("std::shared_ptr") { copy(std); };
+	}
+
+	/**
+	 * Same as Copy, but every thread hammers the same counts.
+	 */
+	BENCH(ContendedCopy)
+	{
+		constexpr size_t numCopies = 1 << 16;
+		const size_t numThreads = std::max(2u, std::thread::hardware_concurrency());
+
+		auto copy = [numThreads](auto& ptr)
+		{
+			std::vector<std::thread> threads{};
+			threads.reserve(numThreads);
+			for (size_t i = 0; i < numThreads; ++i)
+			{
+				threads.emplace_back([&ptr]
+				{
+					for (size_t j = 0; j < numCopies; ++j)
+					{
+						auto copy = ptr;
+						Catch::Benchmark::deoptimize_value(copy);
+					}
+				});
+			}
+			for (std::thread& thread : threads)
+			{
+				thread.join();
+			}
+		};
+
+		auto atomic = AtomicSharedPtr<uint64_t>::Make();
+		auto std = std::make_shared<uint64_t>();
+
+		BENCHMARK("AtomicSharedPtr") { copy(atomic); };
+		BENCHMARK("std::shared_ptr") { copy(std); };
+	}
+
+	/**
+	 * Bulk storage of many small objects, either each behind its own Handle or all behind one.
+	 * Includes a Defrag since that's where the number of Handles costs the most.
+	 */
+	BENCH(MakeArray)
+	{
+		constexpr size_t count = 1 << 14;
+
+		BENCHMARK("Make")
+		{
+			std::vector<SharedPtr<uint64_t>> objects{};
+			objects.reserve(count);
+			for (size_t i = 0; i < count; ++i)
+			{
+				objects.push_back(SharedPtr<uint64_t>::Make(i));
+			}
+			Memory::Manager::Defrag();
+			uint64_t sum = 0;
+			for (const auto& object : objects)
+			{
+				sum += *object;
+			}
+			return sum;
+		};
+
+		BENCHMARK("MakeArray")
+		{
+			auto objects = SharedPtr<uint64_t>::MakeArray(count);
+			for (size_t i = 0; i < count; ++i)
+			{
+				objects[i] = i;
+			}
+			Memory::Manager::Defrag();
+			uint64_t sum = 0;
+			for (const uint64_t object : objects)
+			{
+				sum += object;
+			}
+			return sum;
+		};
+	}
+
+	/**
+	 * Summing through many pointers, where every SharedPtr has to load its Handle before it can load the object.
+	 */
+	BENCH(MakePinned)
+	{
+		constexpr size_t count = 1 << 16;
+
+		const auto sum = [](auto& objects)
+		{
+			uint64_t ret = 0;
+			for (auto& object : objects)
+			{
+				ret += *object;
+			}
+			return ret;
+		};
+
+		std::vector<SharedPtr<uint64_t>> shared{};
+		std::vector<PinnedPtr<uint64_t>> pinned{};
+		shared.reserve(count);
+		pinned.reserve(count);
+		for (size_t i = 0; i < count; ++i)
+		{
+			shared.push_back(SharedPtr<uint64_t>::Make(i));
+			pinned.push_back(SharedPtr<uint64_t>::MakePinned(i));
+		}
+		Memory::Manager::Defrag();
+
+		BENCHMARK("SharedPtr") { return sum(shared); };
+		BENCHMARK("PinnedPtr") { return sum(pinned); };
+	}
+}
@@ -0,0 +1,103 @@
+#include "../../pch.h"
+#include "Parallel.h"
+
+using namespace Library;
+using namespace Library::Util;
+
+#define BENCH(name) TEST_CASE("Parallel::" #name, "[.][benchmark][Parallel]")
+
+namespace UnitTests
+{
+	constexpr size_t numElements = 1 << 20;
+
+	static Array<float> RandomArray()
+	{
+		std::mt19937 rng{ 1 };
+		std::uniform_real_distribution<float> distribution{ -1000.f, 1000.f };
+		Array<float> ret(numElements);
+		for (size_t i = 0; i < numElements; ++i)
+		{
+			ret.PushBack(distribution(rng));
+		}
+		return ret;
+	}
+
+	/**
+	 * Runs benchmark once for each Worker count from 1 up to 32, as long as there are cores for them.
+	 */
+	template<typename Benchmark>
+	static void Scale(const char* name, Benchmark benchmark)
+	{
+		const size_t maxCount = std::max(1u, std::thread::hardware_concurrency());
+		for (size_t count = 1; count <= std::min(size_t(32), maxCount); count *= 2)
+		{
+			Parallel::Workers::SetCount(count);
+			benchmark(std::string(name) + " x" + std::to_string(count));
+		}
+		Parallel::Workers::SetCount(0);
+	}
+
+	BENCH(ForEach)
+	{
+		Array<float> a = RandomArray();
+		Scale("ForEach", [&a](std::string name)
+		{
+			BENCHMARK(std::move(name))
+			{
+				Parallel::ForEach(a, [](float& f) { f = std::sqrt(std::abs(f)) * std::sin(f); });
+				return a.Front();
+			};
+		});
+	}
+
+	BENCH(Transform)
+	{
+		const Array<float> a = RandomArray();
+		Array<float> out(numElements, 0.f);
+		Scale("Transform", [&a, &out](std::string name)
+		{
+			BENCHMARK(std::move(name))
+			{
+				return *(Parallel::Transform(a, out.begin(), [](const float f) { return std::exp(f / 1000.f); }) - 1);
+			};
+		});
+	}
+
+	BENCH(Reduce)
+	{
+		const Array<float> a = RandomArray();
+		Scale("Reduce", [&a](std::string name)
+		{
+			BENCHMARK(std::move(name))
+			{
+				return Parallel::Reduce(a, 0.0, std::plus<>{});
+			};
+		});
+	}
+
+	BENCH(Sort)
+	{
+		const Array<float> a = RandomArray();
+		Scale("Sort", [&a](std::string name)
+		{
+			BENCHMARK_ADVANCED(std::move(name))(Catch::Benchmark::Chronometer meter)
+			{
+				std::vector<Array<float>> copies(meter.runs(), a);
+				meter.measure([&copies](const int i) { Parallel::Sort(copies[i]); });
+			};
+		});
+	}
+
+	BENCH(Partition)
+	{
+		const Array<float> a = RandomArray();
+		Scale("Partition", [&a](std::string name)
+		{
+			BENCHMARK_ADVANCED(std::move(name))(Catch::Benchmark::Chronometer meter)
+			{
+				std::vector<Array<float>> copies(meter.runs(), a);
+				meter.measure([&copies](const int i) { return Parallel::Partition(copies[i], [](const float f) { return f < 0.f; }) - copies[i].begin(); });
+			};
+		});
+	}
+}
@@ -25,6 +25,8 @@ namespace UnitTests
 
 		~MemLeak()
 		{
+			// recycled Nodes outlive the containers which freed them
+			Library::Memory::Recycler::Release();
 			Library::Memory::Manager::Defrag();
 			TestUtil::EndMemState();
 		}
@@ -44,6 +46,7 @@ namespace UnitTests
 			b = true;
 			
 			Math::NextPrime(500);
+			Memory::Frame::Reserve(64 << 10);
 			Enum<Digit>::ToString(Digit());
 			Enum<Digit>::FromString("Zero");
 			Enum<Datum::Type>::ToString(Datum::Type());
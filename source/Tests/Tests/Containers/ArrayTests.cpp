@@ -445,6 +445,56 @@ namespace UnitTests
 		const auto& t = Random::Element(c);
 		REQUIRE(Util::Exists(c, [&t](const auto& a) { return t == a; }));
 	}
+
+	TEST(Count)
+	{
+		auto c = Random::Next<CONTAINER>(100);
+		const auto t = Random::Element(c);
+		c.PushBack(t);
+		const auto expected = size_t(std::count(c.begin(), c.end(), t));
+		REQUIRE(c.Count(t) == expected);
+		REQUIRE(c.Count([&t](const auto& a) { return t == a; }) == expected);
+		REQUIRE(c.Contains(t));
+		REQUIRE(*c.Find(t) == t);
+		REQUIRE(c.Find(t) == c.begin() + c.IndexOf(t));
+
+		c.RemoveAll(t);
+		REQUIRE(c.Count(t) == 0);
+		REQUIRE(!c.Contains(t));
+		REQUIRE(c.Find(t) == c.end());
+		REQUIRE(CONTAINER().Count(t) == 0);
+	}
+
+	TEST_NO_TEMPLATE(SearchFloatingPoint)
+	{
+		constexpr float nan = std::numeric_limits<float>::quiet_NaN();
+		Array<float> a(100, 1.f);
+		a[40] = -0.f;
+		a[60] = 0.f;
+		a[80] = nan;
+
+		// -0 and 0 are equal but differ bitwise
+		REQUIRE(a.IndexOf(0.f) == 40);
+		REQUIRE(a.IndexOf(-0.f) == 40);
+		REQUIRE(a.Count(0.f) == 2);
+		REQUIRE(a.Count(-0.f) == 2);
+
+		// NaN isn't equal to anything, even itself
+		REQUIRE(a.IndexOf(nan) == a.Size());
+		REQUIRE(a.Count(nan) == 0);
+		REQUIRE(!a.Contains(nan));
+		REQUIRE(!a.Remove(nan));
+
+		REQUIRE(a.Remove(0.f));
+		REQUIRE(a.IndexOf(0.f) == 59);
+		REQUIRE(a.RemoveAll(1.f));
+		REQUIRE(a.Size() == 2);
+
+		Array<double> d(17, 2.0);
+		d.PushBack(-0.0);
+		REQUIRE(d.IndexOf(0.0) == 17);
+		REQUIRE(d.Count(2.0) == 17);
+	}
 #pragma endregion
 
 #pragma region Insert
@@ -554,6 +604,57 @@ namespace UnitTests
 		Array<TestType> c2;
 		c2.PushFront(v.begin(), v.end());
 		REQUIRE(c1 == c2);
+
+		std::vector<TestType> expected = Random::Next<std::vector<TestType>>(5);
+		Array<TestType> c3(expected);
+		c3.PushFront(v.begin(), v.end());
+		expected.insert(expected.begin(), v.begin(), v.end());
+		REQUIRE(std::equal(c3.begin(), c3.end(), expected.begin(), expected.end()));
+	}
+
+	TEST(EmplaceOwnElement)
+	{
+		CONTAINER c{ Random::Next<TestType>() };
+		c.ShrinkToFit();
+		for (size_t i = 0; i < 10; ++i)
+		{
+			// the element being copied lives in the storage that may be about to move
+			c.Emplace(0, c.Back());
+		}
+		for (const auto& t : c)
+		{
+			REQUIRE(t == c.Front());
+		}
+	}
+
+	TEST_NO_TEMPLATE(NotTriviallyRelocatable)
+	{
+		// std::string may point into itself so it must be moved one at a time rather than memmoved
+		static_assert(!Util::IsTriviallyRelocatable<std::string>::value);
+		static_assert(Util::IsTriviallyRelocatable<Array<std::string>>::value);
+
+		Array<std::string> c;
+		std::vector<std::string> expected;
+		for (size_t i = 0; i < 50; ++i)
+		{
+			const std::string s(Random::Range<size_t>(0, 40), 'a' + char(i % 26));
+			const size_t index = Random::Range<size_t>(0, expected.size());
+			c.Insert(index, s);
+			expected.insert(expected.begin() + index, s);
+		}
+		REQUIRE(std::equal(c.begin(), c.end(), expected.begin(), expected.end()));
+
+		c.Reserve(c.Capacity() * 2);
+		c.ShrinkToFit();
+		REQUIRE(std::equal(c.begin(), c.end(), expected.begin(), expected.end()));
+
+		while (!expected.empty())
+		{
+			const size_t index = Random::Range<size_t>(0, expected.size() - 1);
+			c.RemoveAt(index);
+			expected.erase(expected.begin() + index);
+			REQUIRE(std::equal(c.begin(), c.end(), expected.begin(), expected.end()));
+		}
 	}
 #pragma endregion
 
@@ -0,0 +1,271 @@
+#include "../../pch.h"
+#include "BitArray.h"
+
+using namespace std::string_literals;
+using namespace Library;
+using namespace Library::Literals;
+
+#define NAMESPACE "BitArray::"
+#define CATEGORY "[BitArray]"
+#define TEST(name) TEST_CASE_METHOD(MemLeak, NAMESPACE #name, CATEGORY)
+
+namespace UnitTests
+{
+	/**
+	 * @returns		whether a holds exactly the values of expected
+	 */
+	static bool Matches(const BitArray<>& a, const std::vector<bool>& expected)
+	{
+		return a.Size() == expected.size() && std::equal(a.begin(), a.end(), expected.begin());
+	}
+
+	/**
+	 * @returns		a random vector of count bools, each true with the given chance
+	 */
+	static std::vector<bool> RandomBools(const size_t count, const double chance = 0.5)
+	{
+		std::vector<bool> ret(count);
+		for (size_t i = 0; i < count; ++i)
+		{
+			ret[i] = Random::Range(0.0, 1.0) < chance;
+		}
+		return ret;
+	}
+
+	TEST(operator<<)
+	{
+		BitArray<> a{ true, false, true };
+		std::stringstream stream;
+		stream << a;
+		REQUIRE(stream.str() == "{ 1, 0, 1 }");
+	}
+
+	TEST(Memory)
+	{
+		BitArray<> a(1000, true);
+		REQUIRE(a.Size() == 1000);
+		REQUIRE(a.Capacity() == 1024);
+		REQUIRE(a.Count() == 1000);
+		// 1000 = 15 * 64 + 40
+		REQUIRE(a.Data()[15] == (BitArray<>::Word(1) << 40) - 1);
+	}
+
+	TEST(reference)
+	{
+		BitArray<> a(130, false);
+		a[129] = true;
+		a[64] = a[129];
+		a.At(0).Flip();
+		REQUIRE(a.Front());
+		REQUIRE(a.Back());
+		REQUIRE(a[64]);
+		REQUIRE(a.Count() == 3);
+
+		swap(a[0], a[1]);
+		REQUIRE(!a[0]);
+		REQUIRE(a[1]);
+
+		REQUIRE_THROWS_AS(a[130], std::out_of_range);
+		REQUIRE_THROWS_AS(BitArray<>().Front(), std::out_of_range);
+	}
+
+	TEST(PushAndInsert)
+	{
+		BitArray<> a;
+		std::vector<bool> expected;
+		for (size_t i = 0; i < 500; ++i)
+		{
+			const bool t = Random::Next<bool>();
+			switch (i % 3)
+			{
+			case 0:
+				a.PushBack(t);
+				expected.push_back(t);
+				break;
+			case 1:
+				a.PushFront(t);
+				expected.insert(expected.begin(), t);
+				break;
+			default:
+				const size_t index = Random::Range<size_t>(0, expected.size());
+				a.Insert(index, t);
+				expected.insert(expected.begin() + index, t);
+				break;
+			}
+			REQUIRE(Matches(a, expected));
+		}
+		REQUIRE_THROWS_AS(a.Insert(a.Size() + 1, true), std::out_of_range);
+	}
+
+	TEST(Remove)
+	{
+		std::vector<bool> expected = RandomBools(1000);
+		BitArray<> a(expected.begin(), expected.end());
+		REQUIRE(Matches(a, expected));
+
+		while (!expected.empty())
+		{
+			const size_t first = Random::Range<size_t>(0, expected.size() - 1);
+			const size_t last = std::min(expected.size(), first + Random::Range<size_t>(0, 150));
+			REQUIRE(a.Remove(first, last) == last - first);
+			expected.erase(expected.begin() + first, expected.begin() + last);
+			REQUIRE(Matches(a, expected));
+
+			if (!expected.empty())
+			{
+				const size_t index = Random::Range<size_t>(0, expected.size() - 1);
+				a.RemoveAt(index);
+				expected.erase(expected.begin() + index);
+				REQUIRE(Matches(a, expected));
+			}
+		}
+
+		REQUIRE(a.Remove(5, 10) == 0);
+		REQUIRE_THROWS_AS(a.Remove(10, 5), std::invalid_argument);
+		REQUIRE_THROWS_AS(a.RemoveAt(0), std::out_of_range);
+	}
+
+	TEST(RemoveValue)
+	{
+		BitArray<> a(200, false);
+		a[150] = true;
+		REQUIRE(a.Remove(true));
+		REQUIRE(a.Size() == 199);
+		REQUIRE(a.Count() == 0);
+		REQUIRE(!a.Remove(true));
+		REQUIRE(a.Remove([](const bool t) { return !t; }));
+		REQUIRE(a.Size() == 198);
+	}
+
+	TEST(RemoveAll)
+	{
+		const std::vector<bool> values = RandomBools(777);
+		BitArray<> a(values.begin(), values.end());
+		const size_t numTrue = std::count(values.begin(), values.end(), true);
+
+		REQUIRE(a.RemoveAll(true) == numTrue);
+		REQUIRE(Matches(a, std::vector<bool>(values.size() - numTrue, false)));
+
+		a = BitArray<>(values.begin(), values.end());
+		REQUIRE(erase_if(a, [](const bool t) { return !t; }) == values.size() - numTrue);
+		REQUIRE(Matches(a, std::vector<bool>(numTrue, true)));
+
+		REQUIRE(a.RemoveAll([](bool) { return false; }) == 0);
+		REQUIRE(a.RemoveAll([](bool) { return true; }) == numTrue);
+		REQUIRE(a.IsEmpty());
+	}
+
+	TEST(IndexOf)
+	{
+		BitArray<> a(300, false);
+		REQUIRE(a.IndexOf(true) == a.Size());
+		REQUIRE(a.IndexOf(false) == 0);
+
+		a[70] = a[200] = true;
+		REQUIRE(a.IndexOf(true) == 70);
+		REQUIRE(a.IndexOf(true, 70) == 70);
+		REQUIRE(a.IndexOf(true, 71) == 200);
+		REQUIRE(a.IndexOf(true, 201) == a.Size());
+		REQUIRE(a.IndexOf([](const bool t) { return t; }) == 70);
+
+		a.Flip();
+		REQUIRE(a.Count() == 298);
+		REQUIRE(a.IndexOf(false) == 70);
+		REQUIRE(a.IndexOf(false, 71) == 200);
+		// the unused bits of the last word mustn't be found
+		REQUIRE(a.IndexOf(false, 201) == a.Size());
+	}
+
+	TEST(ForEachIndexOf)
+	{
+		for (const double chance : { 0.0, 0.01, 0.5, 1.0 })
+		{
+			const std::vector<bool> values = RandomBools(Random::Range<size_t>(0, 1000), chance);
+			const BitArray<> a(values.begin(), values.end());
+			for (const bool t : { true, false })
+			{
+				std::vector<size_t> expected;
+				for (size_t i = 0; i < values.size(); ++i)
+				{
+					if (values[i] == t)
+					{
+						expected.push_back(i);
+					}
+				}
+
+				std::vector<size_t> indices;
+				a.ForEachIndexOf(t, [&](const size_t i) { indices.push_back(i); });
+				REQUIRE(indices == expected);
+				REQUIRE(a.Count(t) == expected.size());
+			}
+		}
+	}
+
+	TEST(Resize)
+	{
+		BitArray<> a(10, true);
+		a.Resize(100, false);
+		REQUIRE(a.Count() == 10);
+		a.Resize(5);
+		REQUIRE(a.Count() == 5);
+		// shrinking must clear the cut off bits so they don't come back
+		a.Resize(100);
+		REQUIRE(a.Count() == 5);
+
+		a.ShrinkToFit();
+		REQUIRE(a.Capacity() == 128);
+		a.Clear();
+		a.ShrinkToFit();
+		REQUIRE(a.Capacity() == 0);
+		REQUIRE(a.Data() == nullptr);
+	}
+
+	TEST(Bitwise)
+	{
+		const std::vector<bool> left = RandomBools(333);
+		const std::vector<bool> right = RandomBools(333);
+		const BitArray<> l(left.begin(), left.end());
+		const BitArray<> r(right.begin(), right.end());
+
+		std::vector<bool> expected(left.size());
+		for (size_t i = 0; i < left.size(); ++i)
+		{
+			expected[i] = left[i] && right[i];
+		}
+		REQUIRE(Matches(BitArray<>(l) &= r, expected));
+
+		for (size_t i = 0; i < left.size(); ++i)
+		{
+			expected[i] = left[i] || right[i];
+		}
+		REQUIRE(Matches(BitArray<>(l) |= r, expected));
+
+		for (size_t i = 0; i < left.size(); ++i)
+		{
+			expected[i] = left[i] != right[i];
+		}
+		REQUIRE(Matches(BitArray<>(l) ^= r, expected));
+	}
+
+	TEST(CopyAndMove)
+	{
+		const std::vector<bool> values = RandomBools(200);
+		BitArray<> a(values.begin(), values.end());
+		BitArray<> b(a);
+		REQUIRE(a == b);
+		b.PopBack();
+		REQUIRE(a != b);
+		b = a;
+		REQUIRE(a == b);
+
+		BitArray<> c(std::move(b));
+		REQUIRE(b.IsEmpty());
+		REQUIRE(c == a);
+		b = std::move(c);
+		REQUIRE(c.IsEmpty());
+		REQUIRE(b == a);
+
+		std::reverse(b.begin(), b.end());
+		REQUIRE(std::equal(b.begin(), b.end(), values.rbegin()));
+	}
+}
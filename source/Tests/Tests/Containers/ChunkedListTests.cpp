@@ -0,0 +1,349 @@
+#include "../../pch.h"
+#include "ChunkedList.h"
+
+using namespace std::string_literals;
+using namespace Library;
+using namespace Library::Literals;
+
+#define NAMESPACE "ChunkedList::"
+#define CATEGORY "[ChunkedList]"
+#define TYPES int, uint64_t, std::string, Array<int>, SList<std::string>
+#define TEST_NO_TEMPLATE(name) TEST_CASE_METHOD(MemLeak, NAMESPACE #name, CATEGORY)
+#define TEST(name) TEMPLATE_TEST_CASE_METHOD(TemplateMemLeak, NAMESPACE #name, CATEGORY, TYPES)
+#define CONTAINER ChunkedList<TestType>
+
+namespace UnitTests
+{
+	// enough elements to span plenty of Nodes for any TestType
+	constexpr size_t numElements = 200;
+
+	template<typename Container, typename Expected>
+	static bool Equal(const Container& c, const Expected& expected)
+	{
+		return c.Size() == expected.size() && std::equal(c.begin(), c.end(), expected.begin(), expected.end());
+	}
+
+	TEST_NO_TEMPLATE(operator<<)
+	{
+		ChunkedList<int> l{ 1, 2, 3 };
+		std::stringstream stream;
+		stream << l;
+		REQUIRE(stream.str() == "{ 1, 2, 3 }");
+	}
+
+	TEST_NO_TEMPLATE(chunkCapacity)
+	{
+		// a Node is a whole number of cache lines with room for a handful of elements
+		REQUIRE(ChunkedList<int>::chunkCapacity * sizeof(int) <= 64);
+		REQUIRE(ChunkedList<int>::chunkCapacity * sizeof(int) > 64 - 4 * sizeof(int));
+		REQUIRE(ChunkedList<char>::chunkCapacity > ChunkedList<uint64_t>::chunkCapacity);
+		REQUIRE(ChunkedList<std::string>::chunkCapacity >= 4);
+	}
+
+	TEST(PushPop)
+	{
+		CONTAINER c;
+		std::list<TestType> expected;
+		REQUIRE(c.IsEmpty());
+		REQUIRE_THROWS_AS(c.Front(), std::out_of_range);
+		REQUIRE_THROWS_AS(c.Back(), std::out_of_range);
+
+		for (size_t i = 0; i < numElements; ++i)
+		{
+			const auto t = Random::Next<TestType>();
+			if (i % 3 == 0)
+			{
+				c.PushFront(t);
+				expected.push_front(t);
+			}
+			else
+			{
+				c.PushBack(t);
+				expected.push_back(t);
+			}
+		}
+		REQUIRE(Equal(c, expected));
+		REQUIRE(c.Front() == expected.front());
+		REQUIRE(c.Back() == expected.back());
+
+		while (!c.IsEmpty())
+		{
+			if (c.Size() % 2 == 0)
+			{
+				c.PopFront();
+				expected.pop_front();
+			}
+			else
+			{
+				c.PopBack();
+				expected.pop_back();
+			}
+			REQUIRE(Equal(c, expected));
+		}
+		REQUIRE(c.begin() == c.end());
+
+		c.PopFront();
+		c.PopBack();
+		REQUIRE(c.IsEmpty());
+	}
+
+	TEST(Emplace)
+	{
+		CONTAINER c;
+		const auto a = Random::Next<TestType>();
+		const auto b = Random::Next<TestType>();
+		REQUIRE(c.EmplaceBack(a) == a);
+		REQUIRE(c.EmplaceFront(b) == b);
+		REQUIRE(c.Front() == b);
+		REQUIRE(c.Back() == a);
+	}
+
+	TEST(At)
+	{
+		const auto expected = Random::Next<std::vector<TestType>>(numElements);
+		const CONTAINER c(expected);
+		for (size_t i = 0; i < expected.size(); ++i)
+		{
+			REQUIRE(c.At(i) == expected[i]);
+		}
+		REQUIRE_THROWS_AS(c.At(expected.size()), std::out_of_range);
+	}
+
+	TEST(iterator)
+	{
+		const auto expected = Random::Next<std::vector<TestType>>(numElements);
+		CONTAINER c(expected);
+
+		auto it = c.begin();
+		REQUIRE(it);
+		REQUIRE(*it++ == expected[0]);
+		REQUIRE(*it == expected[1]);
+		REQUIRE(*++it == expected[2]);
+
+		size_t i = 0;
+		for (const auto& t : c)
+		{
+			REQUIRE(t == expected[i++]);
+		}
+		REQUIRE(i == expected.size());
+
+		const CONTAINER& constC = c;
+		REQUIRE(std::equal(constC.cbegin(), constC.cend(), expected.begin(), expected.end()));
+		REQUIRE(!c.end());
+		REQUIRE_THROWS_AS(*c.end(), std::out_of_range);
+	}
+
+	TEST(InsertAfter)
+	{
+		CONTAINER c;
+		std::list<TestType> expected;
+
+		// inserting at random spots splits full Nodes in both halves
+		for (size_t i = 0; i < numElements; ++i)
+		{
+			const auto t = Random::Next<TestType>();
+			if (c.IsEmpty())
+			{
+				c.PushBack(t);
+				expected.push_back(t);
+				continue;
+			}
+
+			const size_t index = Random::Range<size_t>(0, c.Size() - 1);
+			auto it = c.begin();
+			auto jt = expected.begin();
+			std::advance(it, index);
+			std::advance(jt, index + 1);
+
+			const auto inserted = c.InsertAfter(it, t);
+			expected.insert(jt, t);
+			REQUIRE(*inserted == t);
+			REQUIRE(Equal(c, expected));
+		}
+
+		// end() appends
+		const auto t = Random::Next<TestType>();
+		REQUIRE(*c.InsertAfter(c.end(), t) == t);
+		REQUIRE(c.Back() == t);
+	}
+
+	TEST(InsertAfterOwnElement)
+	{
+		CONTAINER c;
+		for (size_t i = 0; i < CONTAINER::chunkCapacity; ++i)
+		{
+			c.PushBack(Random::Next<TestType>());
+		}
+		// The first Node is full, so this splits it while the argument is one of its elements.
+		const auto copy = c.Front();
+		c.InsertAfter(c.begin(), c.Front());
+		REQUIRE(c.At(0) == copy);
+		REQUIRE(c.At(1) == copy);
+		REQUIRE(c.Size() == CONTAINER::chunkCapacity + 1);
+	}
+
+	TEST(RemoveAt)
+	{
+		const auto values = Random::Next<std::vector<TestType>>(numElements);
+		CONTAINER c(values);
+		std::list<TestType> expected(values.begin(), values.end());
+
+		while (!c.IsEmpty())
+		{
+			const size_t index = Random::Range<size_t>(0, c.Size() - 1);
+			auto it = c.begin();
+			auto jt = expected.begin();
+			std::advance(it, index);
+			std::advance(jt, index);
+
+			const auto next = c.RemoveAt(it);
+			jt = expected.erase(jt);
+			REQUIRE(Equal(c, expected));
+			if (jt == expected.end())
+			{
+				REQUIRE(next == c.end());
+			}
+			else
+			{
+				REQUIRE(*next == *jt);
+			}
+		}
+		REQUIRE(c.RemoveAt(c.end()) == c.end());
+	}
+
+	TEST(Remove)
+	{
+		auto values = Random::Next<std::vector<TestType>>(numElements);
+		CONTAINER c(values);
+		const auto t = values[numElements / 2];
+		c.Remove(t);
+		values.erase(std::find(values.begin(), values.end(), t));
+		REQUIRE(Equal(c, values));
+
+		c.Remove([](const TestType&) { return false; });
+		REQUIRE(Equal(c, values));
+	}
+
+	TEST(RemoveAll)
+	{
+		auto values = Random::Next<std::vector<TestType>>(numElements);
+		CONTAINER c(values);
+
+		size_t i = 0;
+		const auto odd = [&i](const TestType&) { return i++ % 2 == 1; };
+		const size_t expected = values.size() / 2;
+		REQUIRE(c.RemoveAll(odd) == expected);
+		i = 0;
+		values.erase(std::remove_if(values.begin(), values.end(), odd), values.end());
+		REQUIRE(Equal(c, values));
+
+		// in long runs, so whole Nodes empty out
+		i = 0;
+		const auto run = [&i](const TestType&) { return i++ / 10 % 2 == 0; };
+		c.RemoveAll(run);
+		i = 0;
+		values.erase(std::remove_if(values.begin(), values.end(), run), values.end());
+		REQUIRE(Equal(c, values));
+
+		REQUIRE(c.RemoveAll([](const TestType&) { return true; }) == values.size());
+		REQUIRE(c.IsEmpty());
+		REQUIRE(c.begin() == c.end());
+		c.PushBack(Random::Next<TestType>());
+		REQUIRE(c.Size() == 1);
+	}
+
+	TEST_NO_TEMPLATE(RemoveAllThrows)
+	{
+		ChunkedList<std::string> c;
+		std::vector<std::string> expected;
+		for (size_t i = 0; i < numElements; ++i)
+		{
+			c.PushBack(std::to_string(i));
+			if (i % 2 == 1 || i >= numElements / 2)
+			{
+				expected.push_back(std::to_string(i));
+			}
+		}
+
+		size_t i = 0;
+		REQUIRE_THROWS_AS(c.RemoveAll([&i](const std::string&)
+		{
+			if (i == numElements / 2)
+			{
+				throw std::runtime_error("predicate");
+			}
+			return i++ % 2 == 0;
+		}), std::runtime_error);
+		REQUIRE(Equal(c, expected));
+	}
+
+	TEST(ShrinkToFit)
+	{
+		auto values = Random::Next<std::vector<TestType>>(numElements);
+		CONTAINER c(values);
+		const std::vector<TestType> front(values.rend() - numElements / 3, values.rend());
+		for (size_t i = 0; i < numElements / 3; ++i)
+		{
+			c.PushFront(values[i]);
+		}
+		values.insert(values.begin(), front.begin(), front.end());
+
+		size_t i = 0;
+		const auto everyThird = [&i](const TestType&) { return i++ % 3 == 0; };
+		c.RemoveAll(everyThird);
+		i = 0;
+		values.erase(std::remove_if(values.begin(), values.end(), everyThird), values.end());
+
+		c.ShrinkToFit();
+		REQUIRE(Equal(c, values));
+		c.PushBack(values.front());
+		c.PushFront(values.back());
+		REQUIRE(c.Size() == values.size() + 2);
+	}
+
+	TEST(CopyMove)
+	{
+		const auto values = Random::Next<std::vector<TestType>>(numElements);
+		const CONTAINER a(values);
+
+		CONTAINER b = a;
+		REQUIRE(a == b);
+		b.PopBack();
+		REQUIRE(a != b);
+
+		b = a;
+		REQUIRE(a == b);
+
+		CONTAINER c = std::move(b);
+		REQUIRE(a == c);
+		REQUIRE(b.IsEmpty());
+
+		b = std::move(c);
+		REQUIRE(a == b);
+		REQUIRE(c.IsEmpty());
+
+		c = { values[0], values[1] };
+		REQUIRE(c.Size() == 2);
+		REQUIRE(c.Back() == values[1]);
+	}
+
+	TEST_NO_TEMPLATE(QueueStack)
+	{
+		Queue<int, ChunkedList<int>> queue;
+		Stack<int, ChunkedList<int>> stack;
+		for (int i = 0; i < int(numElements); ++i)
+		{
+			queue.Enqueue(i);
+			stack.Emplace(i);
+		}
+		for (int i = 0; i < int(numElements); ++i)
+		{
+			REQUIRE(queue.Front() == i);
+			REQUIRE(stack.Top() == int(numElements) - i - 1);
+			queue.Dequeue();
+			stack.Pop();
+		}
+		REQUIRE(queue.IsEmpty());
+		REQUIRE(stack.IsEmpty());
+	}
+}
@@ -0,0 +1,175 @@
+#include "../../pch.h"
+#include "InlineArray.h"
+
+using namespace std::string_literals;
+using namespace Library;
+using namespace Library::Literals;
+
+#define NAMESPACE "InlineArray::"
+#define CATEGORY "[InlineArray]"
+#define TYPES int, uint64_t, std::string, Array<int>, SList<std::string>
+#define TEST_NO_TEMPLATE(name) TEST_CASE_METHOD(MemLeak, NAMESPACE #name, CATEGORY)
+#define TEST(name) TEMPLATE_TEST_CASE_METHOD(TemplateMemLeak, NAMESPACE #name, CATEGORY, TYPES)
+#define CONTAINER InlineArray<TestType, 4>
+
+namespace UnitTests
+{
+	TEST_NO_TEMPLATE(operator<<)
+	{
+		InlineArray<int, 2> a{ 1, 2, 3 };
+		std::stringstream stream;
+		stream << a;
+		REQUIRE(stream.str() == "{ 1, 2, 3 }");
+	}
+
+	TEST(Spill)
+	{
+		CONTAINER c;
+		REQUIRE(c.IsInline());
+		REQUIRE(c.Capacity() == 4);
+
+		std::vector<TestType> expected;
+		for (size_t i = 0; i < 4; ++i)
+		{
+			expected.push_back(Random::Next<TestType>());
+			c.PushBack(expected.back());
+		}
+		REQUIRE(c.IsInline());
+		REQUIRE(c.IsFull());
+		REQUIRE(reinterpret_cast<std::byte*>(c.Data()) >= reinterpret_cast<std::byte*>(&c));
+		REQUIRE(reinterpret_cast<std::byte*>(c.Data()) < reinterpret_cast<std::byte*>(&c + 1));
+
+		expected.push_back(Random::Next<TestType>());
+		c.PushBack(expected.back());
+		REQUIRE(!c.IsInline());
+		REQUIRE(c.Capacity() > 4);
+		REQUIRE(std::equal(c.begin(), c.end(), expected.begin(), expected.end()));
+
+		c.PopBack();
+		c.ShrinkToFit();
+		REQUIRE(c.IsInline());
+		REQUIRE(std::equal(c.begin(), c.end(), expected.begin(), expected.end() - 1));
+
+		c.Empty();
+		REQUIRE(c.IsInline());
+		REQUIRE(c.IsEmpty());
+	}
+
+	TEST(PushBackOwnElement)
+	{
+		CONTAINER c;
+		c.PushBack(Random::Next<TestType>());
+		while (c.IsInline())
+		{
+			// the element being copied lives in the storage that's about to move
+			c.PushBack(c.Front());
+		}
+		for (const auto& t : c)
+		{
+			REQUIRE(t == c.Front());
+		}
+	}
+
+	TEST(InsertAndRemove)
+	{
+		CONTAINER c;
+		std::vector<TestType> expected;
+		for (size_t i = 0; i < 50; ++i)
+		{
+			const TestType t = Random::Next<TestType>();
+			const size_t index = Random::Range<size_t>(0, expected.size());
+			c.Insert(index, t);
+			expected.insert(expected.begin() + index, t);
+			REQUIRE(std::equal(c.begin(), c.end(), expected.begin(), expected.end()));
+		}
+		REQUIRE_THROWS_AS(c.Insert(c.Size() + 1, TestType()), std::out_of_range);
+
+		while (!expected.empty())
+		{
+			const size_t first = Random::Range<size_t>(0, expected.size() - 1);
+			const size_t last = std::min(expected.size(), first + Random::Range<size_t>(0, 5));
+			REQUIRE(c.Remove(first, last) == last - first);
+			expected.erase(expected.begin() + first, expected.begin() + last);
+			REQUIRE(std::equal(c.begin(), c.end(), expected.begin(), expected.end()));
+		}
+		REQUIRE_THROWS_AS(c.RemoveAt(0), std::out_of_range);
+		REQUIRE_THROWS_AS(c.Remove(1, 0), std::invalid_argument);
+	}
+
+	TEST(RemoveValue)
+	{
+		const TestType a = Random::Next<TestType>();
+		const TestType b = Random::NotEqualTo(a);
+
+		CONTAINER c{ a, b, a, b, a, b };
+		REQUIRE(c.IndexOf(b) == 1);
+		REQUIRE(c.Remove(b));
+		REQUIRE(c.IndexOf(b) == 2);
+		REQUIRE(c.RemoveAll(a) == 3);
+		REQUIRE(c == CONTAINER{ b, b });
+		REQUIRE(erase_if(c, [&b](const TestType& t) { return t == b; }) == 2);
+		REQUIRE(c.IsEmpty());
+		REQUIRE(!c.Remove(a));
+	}
+
+	TEST(CopyAndMove)
+	{
+		for (const size_t count : { 2_z, 10_z })
+		{
+			CONTAINER a;
+			for (size_t i = 0; i < count; ++i)
+			{
+				a.PushBack(Random::Next<TestType>());
+			}
+
+			CONTAINER b(a);
+			REQUIRE(a == b);
+			CONTAINER c(std::move(b));
+			REQUIRE(b.IsEmpty());
+			REQUIRE(b.IsInline());
+			REQUIRE(a == c);
+
+			b = c;
+			REQUIRE(b == c);
+			c = std::move(b);
+			REQUIRE(b.IsEmpty());
+			REQUIRE(b.IsInline());
+			REQUIRE(a == c);
+			REQUIRE(c.IsInline() == (count <= 4));
+
+			// moving into one that's already spilled must free what it had
+			b = CONTAINER(20, Random::Next<TestType>());
+			b = std::move(c);
+			REQUIRE(a == b);
+		}
+	}
+
+	TEST(Resize)
+	{
+		const TestType t = Random::Next<TestType>();
+		CONTAINER c;
+		c.Resize(3, t);
+		REQUIRE(c.IsInline());
+		REQUIRE(c == CONTAINER{ t, t, t });
+		c.Resize(10, t);
+		REQUIRE(!c.IsInline());
+		REQUIRE(c.Size() == 10);
+		c.Resize(1);
+		REQUIRE(c == CONTAINER{ t });
+
+		CONTAINER reserved(100);
+		REQUIRE(reserved.Capacity() == 100);
+		REQUIRE(reserved.IsEmpty());
+	}
+
+	TEST(At)
+	{
+		CONTAINER c{ Random::Next<TestType>() };
+		REQUIRE(c.Front() == c.Back());
+		REQUIRE(&c[0] == c.Data());
+		REQUIRE_THROWS_AS(c.At(1), std::out_of_range);
+		c.Clear();
+		REQUIRE_THROWS_AS(c.Front(), std::out_of_range);
+		REQUIRE_THROWS_AS(std::as_const(c).Back(), std::out_of_range);
+	}
+}
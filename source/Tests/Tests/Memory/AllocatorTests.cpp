@@ -5,13 +5,242 @@ using namespace std::string_literals;
 using namespace Library;
 
 #define TEST(name) TEST_CASE_METHOD(MemLeak, "Allocator" #name, "[Allocator]")
+// The Pool keeps its slabs for the life of the process, which MemLeak would report.
+#define TEST_NO_MEM_CHECK(name) TEST_CASE("Allocator" #name, "[Allocator]")
 
 namespace UnitTests
 {
+	/**
+	 * Counts how many times a RecyclingAllocator had to go past its free list.
+	 */
+	struct CountingStrategy final
+	{
+		STATIC_CLASS(CountingStrategy)
+
+		static inline size_t numAllocations{};
+		static inline size_t numDeallocations{};
+
+		[[nodiscard]] static void* Allocate(const size_t numBytes, const size_t alignment) noexcept
+		{
+			numAllocations++;
+			return Memory::MallocStrategy::Allocate(numBytes, alignment);
+		}
+
+		static void Deallocate(void* p, const size_t numBytes, const size_t alignment) noexcept
+		{
+			numDeallocations++;
+			Memory::MallocStrategy::Deallocate(p, numBytes, alignment);
+		}
+	};
+
 	TEST(std::vector)
 	{
 		std::vector<int, Allocator<int>> v;
 		v.push_back(5);
 		REQUIRE(Allocator<int>::NumAllocations() == 1);
 	}
+
+	TEST_NO_MEM_CHECK(Pool)
+	{
+		// freed blocks are handed straight back out
+		void* a = Memory::Pool::Alloc(24);
+		Memory::Pool::Free(a, 24);
+		void* b = Memory::Pool::Alloc(17);
+		REQUIRE(a == b);
+		REQUIRE(size_t(b) % Memory::Pool::granularity == 0);
+		Memory::Pool::Free(b, 17);
+
+		// blocks may be freed by a thread other than the one which allocated them
+		std::vector<void*> blocks{};
+		std::thread([&blocks]
+		{
+			for (size_t i = 0; i < 1000; ++i)
+			{
+				blocks.push_back(Memory::Pool::Alloc(64));
+			}
+		}).join();
+		for (void* block : blocks)
+		{
+			Memory::Pool::Free(block, 64);
+		}
+	}
+
+	TEST_NO_MEM_CHECK(PoolTornDown)
+	{
+		// a size class nothing else uses
+		constexpr size_t numBytes = Memory::Pool::maxBlockSize - 1;
+		static std::atomic<void*> freedLate{ nullptr };
+		struct Late final
+		{
+			void* block{ nullptr };
+
+			~Late()
+			{
+				Memory::Pool::Free(block, numBytes);
+				freedLate = block;
+			}
+		};
+
+		std::thread([]
+		{
+			// constructed before this thread's cache, so it's destroyed after it
+			static thread_local Late late{};
+			late.block = Memory::Pool::Alloc(numBytes);
+		}).join();
+
+		// the block went to the depot rather than the destroyed cache, so another thread gets it back
+		bool found = false;
+		std::thread([&found]
+		{
+			std::vector<void*> blocks{};
+			for (size_t i = 0; i < 1000 && !found; ++i)
+			{
+				found = blocks.emplace_back(Memory::Pool::Alloc(numBytes)) == freedLate;
+			}
+			for (void* block : blocks)
+			{
+				Memory::Pool::Free(block, numBytes);
+			}
+		}).join();
+		REQUIRE(found);
+	}
+
+	TEST_NO_MEM_CHECK(PoolAllocator)
+	{
+		{
+			SList<std::string, PoolAllocator<std::string>> list{ "a", "b", "c" };
+			list.PopFront();
+			list.PushBack("d");
+			REQUIRE(list == SList<std::string, PoolAllocator<std::string>>{ "b", "c", "d" });
+		}
+		{
+			HashMap<int, std::string, Hash<int>, std::equal_to<int>, Util::PrimeReserveStrategy, PoolAllocator<int>> map{};
+			for (int i = 0; i < 100; ++i)
+			{
+				map.Emplace(i, std::to_string(i));
+			}
+			for (int i = 0; i < 100; i += 2)
+			{
+				map.Remove(i);
+			}
+			REQUIRE(map.Size() == 50);
+			REQUIRE(map.At(51) == "51");
+		}
+		{
+			Queue<int, SList<int, PoolAllocator<int>>> queue{};
+			Stack<int, SList<int, PoolAllocator<int>>> stack{};
+			for (int i = 0; i < 10; ++i)
+			{
+				queue.Enqueue(i);
+				stack.Push(i);
+			}
+			REQUIRE(queue.Front() == 0);
+			REQUIRE(stack.Top() == 9);
+		}
+
+		// big or over-aligned allocations don't come from the Pool
+		std::vector<uint64_t, PoolAllocator<uint64_t>> v(1000);
+		REQUIRE(v.size() == 1000);
+	}
+
+	TEST(RecyclingAllocator)
+	{
+		constexpr size_t capacity = 16;
+		using TestAllocator = RecyclingAllocator<std::string, capacity, CountingStrategy>;
+		CountingStrategy::numAllocations = CountingStrategy::numDeallocations = 0;
+
+		SList<std::string, TestAllocator> list{};
+		for (size_t i = 0; i < capacity; ++i)
+		{
+			list.PushBack(std::to_string(i));
+		}
+		REQUIRE(CountingStrategy::numAllocations == capacity);
+
+		// steady state push/pop cycles
+		for (size_t i = 0; i < 1000; ++i)
+		{
+			list.PopFront();
+			list.PushBack(std::to_string(i));
+		}
+		REQUIRE(CountingStrategy::numAllocations == capacity);
+		REQUIRE(CountingStrategy::numDeallocations == 0);
+
+		// built and cleared every frame
+		for (size_t frame = 0; frame < 10; ++frame)
+		{
+			list.Clear();
+			REQUIRE(Memory::Recycler::NumRecycled() == capacity);
+			for (size_t i = 0; i < capacity; ++i)
+			{
+				list.PushBack(std::to_string(i));
+			}
+			REQUIRE(Memory::Recycler::NumRecycled() == 0);
+		}
+		REQUIRE(CountingStrategy::numAllocations == capacity);
+
+		// only capacity Nodes are kept past a spike
+		for (size_t i = 0; i < capacity; ++i)
+		{
+			list.PushBack(std::to_string(i));
+		}
+		list.Clear();
+		REQUIRE(CountingStrategy::numAllocations == 2 * capacity);
+		REQUIRE(CountingStrategy::numDeallocations == capacity);
+		REQUIRE(Memory::Recycler::NumRecycled() == capacity);
+
+		Memory::Recycler::Release();
+		REQUIRE(Memory::Recycler::NumRecycled() == 0);
+		REQUIRE(CountingStrategy::numDeallocations == CountingStrategy::numAllocations);
+	}
+
+	TEST(RecyclingAllocatorTornDown)
+	{
+		using TestAllocator = RecyclingAllocator<std::string, 16, CountingStrategy>;
+		CountingStrategy::numAllocations = CountingStrategy::numDeallocations = 0;
+
+		// constructed before the thread's free list, so it's destroyed after it
+		std::thread([]
+		{
+			static thread_local SList<std::string, TestAllocator> late{};
+			late.PushBack("late");
+		}).join();
+		REQUIRE(CountingStrategy::numAllocations == 1);
+		REQUIRE(CountingStrategy::numDeallocations == 1);
+	}
+
+	TEST(RecyclingAllocatorHashMap)
+	{
+		using TestAllocator = RecyclingAllocator<int, 64, CountingStrategy>;
+		HashMap<int, std::string, Hash<int>, std::equal_to<int>, Util::PrimeReserveStrategy, TestAllocator> map{};
+		for (int i = 0; i < 50; ++i)
+		{
+			map.Emplace(i, std::to_string(i));
+		}
+		CountingStrategy::numAllocations = CountingStrategy::numDeallocations = 0;
+
+		// chain Nodes are reused, and the buckets don't change size
+		for (int i = 0; i < 1000; ++i)
+		{
+			map.Remove(i);
+			map.Emplace(i + 50, std::to_string(i + 50));
+		}
+		REQUIRE(map.Size() == 50);
+		REQUIRE(map.At(1049) == "1049");
+		REQUIRE(CountingStrategy::numAllocations == 0);
+		REQUIRE(CountingStrategy::numDeallocations == 0);
+
+		// a Queue with the same population
+		Queue<int, SList<int, RecyclingAllocator<int, 64, CountingStrategy>>> queue{};
+		for (int i = 0; i < 50; ++i)
+		{
+			queue.Enqueue(i);
+		}
+		const size_t numAllocations = CountingStrategy::numAllocations;
+		for (int i = 0; i < 1000; ++i)
+		{
+			queue.Dequeue();
+			queue.Enqueue(i);
+		}
+		REQUIRE(CountingStrategy::numAllocations == numAllocations);
+	}
 }
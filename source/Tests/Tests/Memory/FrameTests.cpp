@@ -0,0 +1,134 @@
+#include "../../pch.h"
+#include "Frame.h"
+#include "LibAllocator.h"
+
+using namespace Library;
+using namespace Library::Memory;
+
+#define TEST(name) TEST_CASE_METHOD(MemLeak, "Frame::" #name, "[Frame]")
+// Overflowing makes the arenas grow, and they keep that memory for the life of the process, which MemLeak would report.
+#define TEST_NO_MEM_CHECK(name) TEST_CASE("Frame::" #name, "[Frame]")
+
+namespace UnitTests
+{
+	TEST(Alloc)
+	{
+		Frame::Reset();
+		REQUIRE(Frame::BytesUsed() == 0);
+
+		char* c = Frame::Alloc<char>();
+		double* d = Frame::Alloc<double>(3);
+		REQUIRE(size_t(d) % alignof(double) == 0);
+		REQUIRE(reinterpret_cast<std::byte*>(d) > reinterpret_cast<std::byte*>(c));
+		REQUIRE(Frame::BytesUsed() == 4 * sizeof(double));
+
+		void* p = Frame::Alloc(1, alignof(std::max_align_t));
+		REQUIRE(size_t(p) % alignof(std::max_align_t) == 0);
+	}
+
+	TEST(Lifetime)
+	{
+		Frame::Reset();
+		int* a = Frame::Alloc<int>();
+		*a = 5;
+
+		// still valid for the whole of the next frame
+		Frame::Reset();
+		REQUIRE(Frame::BytesUsed() == 0);
+		int* b = Frame::Alloc<int>();
+		*b = 6;
+		REQUIRE(*a == 5);
+
+		// two frames later the same memory gets handed out again
+		Frame::Reset();
+		REQUIRE(Frame::Alloc<int>() == a);
+		REQUIRE(*b == 6);
+	}
+
+	TEST_NO_MEM_CHECK(Overflow)
+	{
+		Frame::Reset();
+		Frame::Reset();
+
+		// far more than the arena holds, so the rest spills into Malloc
+		constexpr size_t numBytes = 1 << 20;
+		std::vector<std::byte*> blocks{};
+		for (size_t i = 0; i < 16; ++i)
+		{
+			std::byte* block = Frame::Alloc<std::byte>(numBytes / 16);
+			std::fill_n(block, numBytes / 16, std::byte(i));
+			blocks.push_back(block);
+		}
+		REQUIRE(Frame::BytesUsed() >= numBytes);
+		for (size_t i = 0; i < blocks.size(); ++i)
+		{
+			REQUIRE(blocks[i][numBytes / 16 - 1] == std::byte(i));
+		}
+
+		// the next time this arena comes around it's big enough to hold everything in one piece
+		Frame::Reset();
+		Frame::Reset();
+		std::byte* first = Frame::Alloc<std::byte>(numBytes / 16);
+		for (size_t i = 1; i < 16; ++i)
+		{
+			REQUIRE(Frame::Alloc<std::byte>(numBytes / 16) == first + i * numBytes / 16);
+		}
+		REQUIRE(Frame::BytesUsed() == numBytes);
+	}
+
+	TEST(FrameAllocator)
+	{
+		Frame::Reset();
+		const size_t before = Frame::BytesUsed();
+		{
+			SList<std::string, FrameAllocator<std::string>> list{ "a", "b", "c" };
+			list.PopFront();
+			list.PushBack("d");
+			REQUIRE(list == SList<std::string, FrameAllocator<std::string>>{ "b", "c", "d" });
+
+			std::vector<int, FrameAllocator<int>> v{};
+			for (int i = 0; i < 100; ++i)
+			{
+				v.push_back(i);
+			}
+			REQUIRE(v.back() == 99);
+		}
+		// nothing is given back until the frame is over
+		REQUIRE(Frame::BytesUsed() > before);
+	}
+
+	TEST(Threads)
+	{
+		Frame::Reset();
+
+		constexpr size_t numThreads = 4;
+		constexpr size_t numAllocs = 256;
+		std::array<std::vector<size_t*>, numThreads> results{};
+		std::vector<std::thread> threads{};
+		for (size_t t = 0; t < numThreads; ++t)
+		{
+			threads.emplace_back([t, &results]
+			{
+				for (size_t i = 0; i < numAllocs; ++i)
+				{
+					size_t* p = Frame::Alloc<size_t>();
+					*p = t * numAllocs + i;
+					results[t].push_back(p);
+				}
+			});
+		}
+		for (std::thread& thread : threads)
+		{
+			thread.join();
+		}
+
+		// no two threads were handed the same memory
+		for (size_t t = 0; t < numThreads; ++t)
+		{
+			for (size_t i = 0; i < numAllocs; ++i)
+			{
+				REQUIRE(*results[t][i] == t * numAllocs + i);
+			}
+		}
+	}
+}
@@ -163,10 +163,579 @@ namespace UnitTests
 		}
 	}
 
+	TEST(AllocSkipsFullHeaps)
+	{
+		std::vector<SharedPtr<uint64_t>> ptrs{};
+		while (Memory::Manager::TotalBytes() <= 1024 + 2048)
+		{
+			ptrs.push_back(SharedPtr<uint64_t>::Make());
+		}
+		const auto numHandles = []
+		{
+			std::vector<size_t> ret{};
+			for (const Memory::Manager::GenerationStats& stats : Memory::Manager::GetGenerationStats())
+			{
+				ret.push_back(stats.numHandles);
+			}
+			return ret;
+		};
+		auto before = numHandles();
+		REQUIRE(before.size() == 3);
+
+		// too big for the leftovers of the first two Heaps
+		auto _64 = SharedPtr<uint64_t>::Make();
+		auto after = numHandles();
+		REQUIRE(after[0] == before[0]);
+		REQUIRE(after[1] == before[1]);
+		REQUIRE(after[2] == before[2] + 1);
+
+		// but the youngest Heap with room is still preferred
+		before = after;
+		auto _8 = SharedPtr<uint8_t>::Make();
+		after = numHandles();
+		REQUIRE(after[0] == before[0] + 1);
+
+		_8 = nullptr;
+		_64 = nullptr;
+		ptrs.clear();
+		Memory::Manager::ShrinkToFit();
+		REQUIRE(Memory::Manager::IsEmpty());
+	}
+
+	TEST(ReuseFreedHoles)
+	{
+		using T = uint64_t;
+		
+		std::deque<SharedPtr<T>> bloat{};
+		while (Memory::Manager::TotalBytes() <= 1024 + 2048)
+		{
+			bloat.push_back(SharedPtr<T>::Make(T(bloat.size())));
+		}
+		
+		// the last allocation needed a new Heap, get rid of it
+		bloat.pop_back();
+		Memory::Manager::ShrinkToFit();
+		REQUIRE(Memory::Manager::TotalBytes() == 1024 + 2048);
+
+		// free every other allocation, leaving holes all throughout both Heaps
+		for (size_t i = 0; i < bloat.size(); i += 2)
+		{
+			bloat[i] = nullptr;
+		}
+
+		// the holes get reused without needing to Defrag or make a new Heap
+		for (size_t i = 0; i < bloat.size(); i += 2)
+		{
+			bloat[i] = SharedPtr<T>::Make(T(i));
+		}
+		REQUIRE(Memory::Manager::TotalBytes() == 1024 + 2048);
+		for (size_t i = 0; i < bloat.size(); i++)
+		{
+			REQUIRE(*bloat[i] == T(i));
+		}
+
+		bloat.clear();
+		Memory::Manager::ShrinkToFit();
+		REQUIRE(Memory::Manager::IsEmpty());
+	}
+
+	TEST(DefragStep)
+	{
+		using namespace std::chrono_literals;
+		using T = uint64_t;
+		
+		std::vector<SharedPtr<T>> ptrs{};
+		for (T i = 0; i < 1024; ++i)
+		{
+			ptrs.push_back(SharedPtr<T>::Make(i));
+		}
+		for (size_t i = 0; i < ptrs.size(); i += 2)
+		{
+			ptrs[i] = nullptr;
+		}
+
+		// with no budget each step still makes a little progress
+		// allocating in between steps must not disturb the Defrag in progress
+		size_t numSteps = 0;
+		while (!Memory::Manager::DefragStep(0ns))
+		{
+			ptrs.push_back(SharedPtr<T>::Make(T(ptrs.size())));
+			numSteps++;
+		}
+		REQUIRE(numSteps > 1);
+
+		for (size_t i = 1; i < ptrs.size(); i += (i < 1024 ? 2 : 1))
+		{
+			REQUIRE(*ptrs[i] == T(i));
+		}
+
+		// nothing has changed since, so there's nothing left to do
+		REQUIRE(Memory::Manager::DefragStep(0ns));
+
+		ptrs.clear();
+		Memory::Manager::Defrag();
+		Memory::Manager::ShrinkToFit();
+		REQUIRE(Memory::Manager::IsEmpty());
+	}
+
+	TEST(Collect)
+	{
+		using namespace std::chrono_literals;
+		using T = uint64_t;
+
+		const Memory::Manager::Policy original = Memory::Manager::GetPolicy();
+		Memory::Manager::Policy policy = original;
+		policy.graduateOccupancy = 0.5f;
+		policy.graduateSurvival = 0.9f;
+		// only the latest Defrag counts
+		policy.survivalSmoothing = 1.f;
+		Memory::Manager::SetPolicy(policy);
+		const size_t numGraduations = Memory::Manager::GetGenerationStats().front().numGraduations;
+
+		// fill most of the nursery with objects that will all survive
+		std::vector<SharedPtr<T>> ptrs{};
+		while (Memory::Manager::GetGenerationStats().front().usedBytes < 768)
+		{
+			ptrs.push_back(SharedPtr<T>::Make(T(ptrs.size())));
+		}
+
+		// Collect Defrags the nursery, sees that everything survived, then Graduates it
+		Memory::Manager::Collect(1s);
+		auto stats = Memory::Manager::GetGenerationStats();
+		REQUIRE(stats[0].numGraduations == numGraduations + 1);
+		REQUIRE(stats[0].numHandles == 0);
+		REQUIRE(stats[1].numHandles == ptrs.size());
+
+		// objects which die young are Defragged away instead
+		std::vector<SharedPtr<T>> temporaries{};
+		for (size_t i = 0; i < 64; ++i)
+		{
+			if (i % 4)
+			{
+				temporaries.push_back(SharedPtr<T>::Make());
+			}
+			else
+			{
+				ptrs.push_back(SharedPtr<T>::Make(T(ptrs.size())));
+			}
+		}
+		temporaries.clear();
+		Memory::Manager::Collect(1s);
+		stats = Memory::Manager::GetGenerationStats();
+		REQUIRE(stats[0].numGraduations == numGraduations + 1);
+		REQUIRE(stats[0].numHandles == 16);
+		REQUIRE(stats[0].usedBytes == 16 * sizeof(T));
+		
+		for (size_t i = 0; i < ptrs.size(); ++i)
+		{
+			REQUIRE(*ptrs[i] == T(i));
+		}
+
+		Memory::Manager::SetPolicy(original);
+		ptrs.clear();
+		Memory::Manager::Defrag();
+		Memory::Manager::ShrinkToFit();
+		REQUIRE(Memory::Manager::IsEmpty());
+	}
+
+	TEST(Stats)
+	{
+		using T = uint64_t;
+
+		Memory::Manager::ResetAllocationStats();
+		std::vector<SharedPtr<T>> ptrs{};
+		for (T i = 0; i < 16; ++i)
+		{
+			ptrs.push_back(SharedPtr<T>::Make(i));
+		}
+		auto _16 = SharedPtr<uint16_t>::Make();
+
+		const auto& allocations = Memory::Manager::GetAllocationStats();
+		REQUIRE(allocations.numAllocations == 17);
+		REQUIRE(allocations.sizes[std::bit_width(sizeof(T))] == 16);
+		REQUIRE(allocations.sizes[std::bit_width(sizeof(uint16_t))] == 1);
+		REQUIRE(allocations.alignments[std::countr_zero(alignof(T))] == 16);
+		REQUIRE(allocations.alignments[std::countr_zero(alignof(uint16_t))] == 1);
+
+		// kill every other one, none of which are at the top
+		for (size_t i = 0; i < ptrs.size(); i += 2)
+		{
+			ptrs[i] = nullptr;
+		}
+		REQUIRE(allocations.numFrees == 8);
+
+		auto stats = Memory::Manager::GetGenerationStats().front();
+		REQUIRE(stats.numHandles == 17);
+		REQUIRE(stats.numDeadHandles == 8);
+		REQUIRE(stats.deadBytes == 8 * sizeof(T));
+		REQUIRE(stats.fragmentation == float(stats.deadBytes) / stats.usedBytes);
+
+		Memory::Manager::Defrag();
+		stats = Memory::Manager::GetGenerationStats().front();
+		REQUIRE(stats.numDeadHandles == 0);
+		REQUIRE(stats.deadBytes == 0);
+		REQUIRE(stats.fragmentation == 0.f);
+		REQUIRE(stats.defragTime > std::chrono::nanoseconds(0));
+
+		ptrs.clear();
+		_16 = nullptr;
+		Memory::Manager::Defrag();
+		Memory::Manager::ShrinkToFit();
+		REQUIRE(Memory::Manager::IsEmpty());
+	}
+
 	TEST(GraduateEmpty)
 	{
 		REQUIRE(Memory::Manager::IsEmpty());
 		Memory::Manager::Graduate();
 		REQUIRE(Memory::Manager::IsEmpty());
 	}
+
+	TEST(ThreadLocalHeaps)
+	{
+		Memory::Manager::ShrinkToFit();
+		const size_t totalBytes = Memory::Manager::TotalBytes();
+		const size_t orphanedBytes = Memory::Manager::OrphanedBytes();
+		
+		SharedString shared;
+		std::thread([&shared]
+		{
+			std::deque<SharedString> bloat{};
+			while (Memory::Manager::TotalBytes() <= 1024 + 2048)
+			{
+				bloat.push_back(SharedString::Make());
+			}
+			shared = SharedString::Make("from another thread");
+		}).join();
+
+		// the other thread's allocations do not come from this thread's Heaps
+		REQUIRE(Memory::Manager::TotalBytes() == totalBytes);
+		// the other thread has exited, but its memory is still alive
+		REQUIRE(*shared == "from another thread");
+		REQUIRE(Memory::Manager::OrphanedBytes() > orphanedBytes);
+
+		// freeing from this thread lets the orphaned Heaps be reclaimed
+		shared = nullptr;
+		Memory::Manager::ShrinkToFit();
+		REQUIRE(Memory::Manager::OrphanedBytes() == orphanedBytes);
+		REQUIRE(Memory::Manager::TotalBytes() == totalBytes);
+	}
+
+	TEST(FreedAfterThreadExit)
+	{
+		Memory::Manager::ShrinkToFit();
+		const size_t orphanedBytes = Memory::Manager::OrphanedBytes();
+
+		std::thread([]
+		{
+			// constructed before this thread's Chain, so it's destroyed after it
+			static thread_local SharedString late{};
+			late = SharedString::Make("outlives its Chain");
+		}).join();
+
+		// the orphaned Chain was told about the free, even though the freeing thread's Chain was gone
+		Memory::Manager::ShrinkToFit();
+		REQUIRE(Memory::Manager::OrphanedBytes() == orphanedBytes);
+	}
+
+	TEST(Share)
+	{
+		Memory::Manager::ShrinkToFit();
+		std::vector<SharedPtr<uint64_t>> ptrs{};
+		for (uint64_t i = 0; i < 1000; ++i)
+		{
+			ptrs.push_back(SharedPtr<uint64_t>::Make(i));
+		}
+		for (size_t i = 0; i < ptrs.size(); i += 2)
+		{
+			ptrs[i] = nullptr;
+		}
+		const uint64_t* addr = &*ptrs.back();
+
+		// nothing moves while another thread may be dereferencing
+		Memory::Manager::Share();
+		for (size_t frame = 0; frame < 10; ++frame)
+		{
+			Memory::Manager::Collect(std::chrono::seconds(1));
+		}
+		REQUIRE(&*ptrs.back() == addr);
+
+		Memory::Manager::Unshare();
+		Memory::Manager::Collect(std::chrono::seconds(1));
+		REQUIRE(&*ptrs.back() != addr);
+		REQUIRE(*ptrs.back() == 999);
+	}
+
+	TEST(AllocatedAfterThreadExit)
+	{
+		Memory::Manager::ShrinkToFit();
+		const size_t orphanedBytes = Memory::Manager::OrphanedBytes();
+
+		static std::atomic<bool> made{ false };
+		struct Late final
+		{
+			~Late()
+			{
+				const SharedString s = SharedString::Make("made after its thread's Chain was orphaned");
+				made = !s->empty();
+			}
+		};
+		std::thread([]
+		{
+			// constructed before this thread's Chain, so it's destroyed after it
+			static thread_local Late late{};
+			SharedString::Make("made first");
+		}).join();
+		REQUIRE(made);
+
+		// the late Chain is orphaned too
+		Memory::Manager::ShrinkToFit();
+		REQUIRE(Memory::Manager::OrphanedBytes() == orphanedBytes);
+	}
+
+	TEST(DestroyedOnAnotherThread)
+	{
+		// holds its destructor open until told to finish
+		struct Slow final
+		{
+			std::atomic<bool>* destroying;
+			std::atomic<bool>* finish;
+			std::atomic<bool>* intact;
+			std::string s{ "still being destroyed" };
+
+			Slow(std::atomic<bool>* destroying, std::atomic<bool>* finish, std::atomic<bool>* intact) :
+				destroying(destroying), finish(finish), intact(intact) {}
+
+			~Slow()
+			{
+				*destroying = true;
+				while (!*finish)
+				{
+					std::this_thread::yield();
+				}
+				*intact = s == "still being destroyed";
+			}
+		};
+
+		Memory::Manager::ShrinkToFit();
+		std::atomic<bool> destroying{ false }, finish{ false }, intact{ false };
+		auto slow = AtomicSharedPtr<Slow>::Make(&destroying, &finish, &intact);
+		const Slow* const address = slow.Raw();
+		std::thread thread([slow = std::move(slow)]() mutable { slow = nullptr; });
+		while (!destroying)
+		{
+			std::this_thread::yield();
+		}
+
+		// the last reference is gone, but the bytes aren't free until the destructor returns
+		Memory::Manager::ShrinkToFit();
+		auto other = AtomicSharedPtr<Slow>::Make(&destroying, &finish, &intact);
+		REQUIRE(other.Raw() != address);
+
+		finish = true;
+		thread.join();
+		REQUIRE(intact);
+		other = nullptr;
+		Memory::Manager::ShrinkToFit();
+		REQUIRE(Memory::Manager::IsEmpty());
+	}
+
+	TEST(DefragLayout)
+	{
+		using T = uint64_t;
+		constexpr T numObjects = 128;
+
+		// half in the nursery and half in an older generation, with holes in both
+		std::vector<SharedPtr<T>> ptrs{};
+		for (T i = 0; i < numObjects; ++i)
+		{
+			if (i == numObjects / 2)
+			{
+				Memory::Manager::Graduate();
+			}
+			ptrs.push_back(SharedPtr<T>::Make(i));
+		}
+		for (size_t i = 0; i < numObjects; i += 3)
+		{
+			ptrs[i] = nullptr;
+		}
+
+		SharedPtr<T> foreign;
+		std::thread([&foreign] { foreign = SharedPtr<T>::Make(numObjects); }).join();
+		const T* const foreignBefore = foreign.Raw();
+
+		// every other survivor, backwards, along with some that shouldn't be moved
+		Memory::Manager::Layout layout{};
+		std::vector<SharedPtr<T>> expected{};
+		for (size_t i = numObjects; i-- > 0;)
+		{
+			if (ptrs[i] && i % 2)
+			{
+				layout.PushBack(ptrs[i]);
+				expected.push_back(ptrs[i]);
+			}
+		}
+		layout.PushBack(SharedPtr<T>());
+		layout.PushBack(expected.front());
+		layout.PushBack(foreign);
+		REQUIRE(layout.Size() == expected.size() + 2);
+
+		Memory::Manager::Defrag(layout);
+
+		// next to each other in the order of the Layout
+		for (size_t i = 1; i < expected.size(); ++i)
+		{
+			REQUIRE(expected[i].Raw() == expected[i - 1].Raw() + 1);
+		}
+		for (T i = 0; i < numObjects; ++i)
+		{
+			if (ptrs[i])
+			{
+				REQUIRE(*ptrs[i] == i);
+			}
+		}
+		REQUIRE(foreign.Raw() == foreignBefore);
+		REQUIRE(*foreign == numObjects);
+
+		// only live objects are left
+		for (const Memory::Manager::GenerationStats& stats : Memory::Manager::GetGenerationStats())
+		{
+			REQUIRE(stats.numDeadHandles == 0);
+		}
+
+		foreign = nullptr;
+		expected.clear();
+		ptrs.clear();
+		Memory::Manager::Defrag();
+		Memory::Manager::ShrinkToFit();
+		REQUIRE(Memory::Manager::IsEmpty());
+	}
+
+	TEST(ExpiredWeakPtrs)
+	{
+		constexpr size_t numObjects = 64;
+
+		std::vector<SharedPtr<Big>> ptrs{};
+		std::vector<WeakPtr<Big>> weaks{};
+		for (size_t i = 0; i < numObjects; ++i)
+		{
+			ptrs.push_back(SharedPtr<Big>::Make());
+			weaks.emplace_back(ptrs.back());
+		}
+		auto pinned = SharedPtr<Big>::MakePinned();
+		WeakPtr<Big> weakPinned(pinned);
+
+		// keep every fourth one alive, the rest are only weakly referenced
+		for (size_t i = 0; i < numObjects; ++i)
+		{
+			if (i % 4)
+			{
+				ptrs[i] = nullptr;
+			}
+		}
+		pinned = nullptr;
+		constexpr size_t numSurvivors = numObjects / 4;
+
+		// they're spread across several Heaps
+		const auto total = []
+		{
+			Memory::Manager::GenerationStats ret{};
+			for (const Memory::Manager::GenerationStats& stats : Memory::Manager::GetGenerationStats())
+			{
+				ret.usedBytes += stats.usedBytes;
+				ret.numHandles += stats.numHandles;
+				ret.numDeadHandles += stats.numDeadHandles;
+				ret.deadBytes += stats.deadBytes;
+			}
+			return ret;
+		};
+
+		auto stats = total();
+		REQUIRE(stats.numDeadHandles == numObjects - numSurvivors);
+		REQUIRE(stats.deadBytes == (numObjects - numSurvivors) * sizeof(Big));
+
+		// the bytes are reclaimed without waiting on the WeakPtrs
+		Memory::Manager::Defrag();
+		stats = total();
+		REQUIRE(stats.numHandles == numSurvivors);
+		REQUIRE(stats.usedBytes == numSurvivors * sizeof(Big));
+		REQUIRE(stats.numDeadHandles == 0);
+
+		// which still know their objects are gone
+		for (size_t i = 0; i < numObjects; ++i)
+		{
+			REQUIRE(weaks[i].Expired() == bool(i % 4));
+			REQUIRE(bool(SharedPtr<Big>(weaks[i])) == !(i % 4));
+		}
+		REQUIRE(weakPinned.Expired());
+		REQUIRE(!SharedPtr<Big>(weakPinned));
+
+		// the Handles themselves go once the last WeakPtr does
+		ptrs.clear();
+		Memory::Manager::ShrinkToFit();
+		REQUIRE(!Memory::Manager::IsEmpty());
+		weaks.clear();
+		weakPinned = {};
+		Memory::Manager::ShrinkToFit();
+		REQUIRE(Memory::Manager::IsEmpty());
+	}
+
+	TEST(DefragInBackground)
+	{
+		using T = uint64_t;
+		constexpr T numObjects = 1 << 15;
+
+		Memory::Manager::Policy policy{};
+		policy.defragInBackground = true;
+		Memory::Manager::SetPolicy(policy);
+
+		// enough to fill Heaps which are big enough to be Defragged in the background
+		std::vector<SharedPtr<T>> ptrs{};
+		for (T i = 0; i < numObjects; ++i)
+		{
+			ptrs.push_back(SharedPtr<T>::Make(i));
+		}
+		for (size_t i = 0; i < numObjects; i += 2)
+		{
+			ptrs[i] = nullptr;
+		}
+		const auto deadBytes = []
+		{
+			size_t ret = 0;
+			for (const Memory::Manager::GenerationStats& stats : Memory::Manager::GetGenerationStats())
+			{
+				ret += stats.deadBytes;
+			}
+			return ret;
+		};
+		REQUIRE(deadBytes() == numObjects / 2 * sizeof(T));
+
+		// one frame starts copying, the objects keep changing while it does
+		Memory::Manager::Collect(std::chrono::seconds(1));
+		for (size_t i = 1; i < numObjects; i += 2)
+		{
+			++*ptrs[i];
+		}
+		auto extra = SharedPtr<T>::Make(numObjects);
+
+		// later frames move them over, one Heap at a time
+		for (size_t frame = 0; frame < 1000 && deadBytes(); ++frame)
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
+			Memory::Manager::Collect(std::chrono::seconds(1));
+		}
+		REQUIRE(deadBytes() == 0);
+		for (size_t i = 1; i < numObjects; i += 2)
+		{
+			REQUIRE(*ptrs[i] == i + 1);
+		}
+		REQUIRE(*extra == numObjects);
+
+		Memory::Manager::SetPolicy({});
+		extra = nullptr;
+		ptrs.clear();
+		Memory::Manager::Defrag();
+		Memory::Manager::ShrinkToFit();
+		REQUIRE(Memory::Manager::IsEmpty());
+	}
 }
@@ -1,14 +1,134 @@
 #include "../../pch.h"
+#include "Simd.h"
 
 using namespace std::string_literals;
 using namespace Library;
+using namespace Library::Literals;
 
 #define TEST(name) TEST_CASE_METHOD(MemLeak, "Memory::" #name, "[Memory]")
 
 namespace UnitTests
 {
+	/**
+	 * Sizes around each kernel's edges: too small for any vectors, a whole number of iterations, left overs, and streaming.
+	 */
+	static std::vector<size_t> KernelSizes()
+	{
+		return { 0, 1, 7, 255, 256, 257, 4099, (size_t(64) << 10) + 13, Memory::NonTemporalThreshold() + 7 };
+	}
+
+	/**
+	 * @returns		every instruction set this CPU supports
+	 */
+	static std::vector<Memory::Isa> SupportedIsas()
+	{
+		std::vector<Memory::Isa> ret{};
+		for (auto isa = uint8_t(Memory::Isa::Scalar); isa <= uint8_t(Memory::DetectIsa()); ++isa)
+		{
+			ret.push_back(Memory::Isa(isa));
+		}
+		return ret;
+	}
+
 	TEST(Malloc)
 	{
 		REQUIRE(!Memory::Malloc(0));
 	}
+
+	TEST(SimdCopy)
+	{
+		const size_t maxSize = Memory::NonTemporalThreshold() + 64;
+		std::vector<std::byte> source(maxSize);
+		for (size_t i = 0; i < maxSize; ++i)
+		{
+			source[i] = std::byte(i * 7 + i / 251);
+		}
+
+		for (const Memory::Isa isa : SupportedIsas())
+		{
+			for (const size_t size : KernelSizes())
+			{
+				// misaligned both ways so every head and tail gets exercised
+				for (size_t offset = 0; offset < 3; ++offset)
+				{
+					std::vector<std::byte> dest(size + 8, std::byte(0xCD));
+					Memory::SimdCopy(dest.data() + offset, source.data() + 2 - offset, size, isa);
+					REQUIRE(std::equal(dest.begin() + offset, dest.begin() + offset + size, source.begin() + 2 - offset));
+					REQUIRE(std::all_of(dest.begin(), dest.begin() + offset, [](const std::byte b) { return b == std::byte(0xCD); }));
+					REQUIRE(std::all_of(dest.begin() + offset + size, dest.end(), [](const std::byte b) { return b == std::byte(0xCD); }));
+				}
+			}
+		}
+	}
+
+	TEST(SimdFill)
+	{
+		constexpr uint16_t pattern = 0xF1EA;
+		std::array<std::byte, 2> bytes{};
+		std::memcpy(bytes.data(), &pattern, sizeof(pattern));
+
+		for (const Memory::Isa isa : SupportedIsas())
+		{
+			for (const size_t size : KernelSizes())
+			{
+				for (size_t offset = 0; offset < 3; ++offset)
+				{
+					std::vector<std::byte> dest(size + 8, std::byte(0xCD));
+					Memory::SimdFill(dest.data() + offset, pattern, size, isa);
+					for (size_t i = 0; i < size; ++i)
+					{
+						if (dest[offset + i] != bytes[i % 2])
+						{
+							FAIL("wrong byte at " << i << " of " << size);
+						}
+					}
+					REQUIRE(dest[offset + size] == std::byte(0xCD));
+				}
+			}
+		}
+	}
+
+	TEST(SimdFind)
+	{
+		for (const size_t elementSize : { 1_z, 2_z, 4_z, 8_z, 12_z, 16_z })
+		{
+			std::array<std::byte, 16> value{};
+			std::array<std::byte, 16> almost{};
+			for (size_t i = 0; i < elementSize; ++i)
+			{
+				value[i] = std::byte(0xA0 + i);
+				almost[i] = value[i];
+			}
+			// only the last byte differs, so a match on a partial element would be caught
+			almost[elementSize - 1] = std::byte(0);
+
+			for (const Memory::Isa isa : SupportedIsas())
+			{
+				for (const size_t count : { 0_z, 1_z, 3_z, 16_z, 100_z, 1000_z })
+				{
+					std::vector<std::byte> data(count * elementSize);
+					for (size_t i = 0; i < count; ++i)
+					{
+						std::memcpy(data.data() + i * elementSize, almost.data(), elementSize);
+					}
+					REQUIRE(Memory::SimdFind(data.data(), count, value.data(), elementSize, isa) == count);
+					REQUIRE(Memory::SimdCount(data.data(), count, value.data(), elementSize, isa) == 0);
+					REQUIRE(Memory::SimdCount(data.data(), count, almost.data(), elementSize, isa) == count);
+
+					// at the start, the end, and everywhere a block or vector boundary could be
+					size_t expected = 0;
+					for (size_t i = count; i-- > 0;)
+					{
+						if (i == count - 1 || i % 5 == 0 || i % 16 == 15)
+						{
+							std::memcpy(data.data() + i * elementSize, value.data(), elementSize);
+							++expected;
+							REQUIRE(Memory::SimdFind(data.data(), count, value.data(), elementSize, isa) == i);
+						}
+					}
+					REQUIRE(Memory::SimdCount(data.data(), count, value.data(), elementSize, isa) == expected);
+				}
+			}
+		}
+	}
 }
@@ -0,0 +1,162 @@
+#include "../../pch.h"
+#include "Profiler.h"
+
+using namespace Library;
+using namespace Library::Memory;
+
+// The Profiler keeps its samples for the life of the process, which MemLeak would report.
+#define TEST(name) TEST_CASE("Memory::Profiler::" #name, "[Memory::Profiler]")
+
+namespace UnitTests
+{
+	TEST(Malloc)
+	{
+		Profiler::Clear();
+		Profiler::Start(1);
+		void* p = Malloc(100);
+		Profiler::Stop();
+
+		REQUIRE(Profiler::NumLive() == 1);
+		const auto sites = Profiler::LiveSites();
+		REQUIRE(sites.size() == 1);
+		REQUIRE(sites.front().numSamples == 1);
+		REQUIRE(sites.front().numBytes == 100);
+		REQUIRE(sites.front().estimatedBytes == 100);
+		REQUIRE(!sites.front().stack.empty());
+
+		// still forgotten after Stop
+		Free(p);
+		REQUIRE(Profiler::NumLive() == 0);
+		REQUIRE(Profiler::LiveSites().empty());
+	}
+
+	TEST(Interval)
+	{
+		constexpr size_t interval = 4;
+		std::vector<int*> ptrs{};
+		ptrs.reserve(4 * interval);
+
+		Profiler::Clear();
+		Profiler::Start(interval);
+		for (size_t i = 0; i < 4 * interval; ++i)
+		{
+			ptrs.push_back(Malloc<int>());
+		}
+		Profiler::Stop();
+
+		REQUIRE(Profiler::NumLive() == 4);
+		const auto sites = Profiler::LiveSites();
+		REQUIRE(sites.size() == 1);
+		REQUIRE(sites.front().numBytes == 4 * sizeof(int));
+		REQUIRE(sites.front().estimatedBytes == 4 * interval * sizeof(int));
+
+		for (int*& p : ptrs)
+		{
+			Free(p);
+		}
+		REQUIRE(Profiler::NumLive() == 0);
+	}
+
+	TEST(Manager)
+	{
+		Profiler::Clear();
+		Profiler::Start(1);
+		auto shared = SharedPtr<uint64_t>::Make(5);
+		Profiler::Stop();
+
+		// making the first object may also have made a new Heap
+		const size_t numLive = Profiler::NumLive();
+		REQUIRE(numLive >= 1);
+		const auto sites = Profiler::LiveSites();
+		REQUIRE(std::any_of(sites.begin(), sites.end(), [](const Profiler::Site& site) { return site.numBytes == sizeof(uint64_t); }));
+
+		// the sample follows the Handle, not the address
+		Memory::Manager::Defrag();
+		REQUIRE(Profiler::NumLive() == numLive);
+
+		shared = nullptr;
+		REQUIRE(Profiler::NumLive() == numLive - 1);
+		Profiler::Clear();
+	}
+
+	TEST(Allocator)
+	{
+		// so the Pool doesn't need a new slab from Malloc while sampling
+		SList<int, PoolAllocator<int>> list{ 0 };
+		list.Clear();
+
+		Profiler::Clear();
+		Profiler::Start(1);
+		list.PushBack(1);
+		list.PushBack(2);
+		Profiler::Stop();
+		REQUIRE(Profiler::NumLive() == 2);
+
+		list.Clear();
+		REQUIRE(Profiler::NumLive() == 0);
+	}
+
+	TEST(WriteFolded)
+	{
+		Profiler::Clear();
+		Profiler::Start(1);
+		void* p = Malloc(123);
+		Profiler::Stop();
+
+		std::stringstream stream{};
+		Profiler::WriteFolded(stream);
+		const std::string folded = stream.str();
+		REQUIRE(std::count(folded.begin(), folded.end(), '\n') == 1);
+		REQUIRE(folded.ends_with(" 123\n"));
+		REQUIRE(folded.find(';') != std::string::npos);
+
+		Free(p);
+		stream.str("");
+		Profiler::WriteFolded(stream);
+		REQUIRE(stream.str().empty());
+	}
+
+	TEST(Threads)
+	{
+		constexpr size_t numThreads = 4;
+		constexpr size_t numAllocs = 256;
+
+		Profiler::Clear();
+		Profiler::Start(1);
+		std::array<std::vector<void*>, numThreads> ptrs{};
+		for (auto& v : ptrs)
+		{
+			v.reserve(numAllocs);
+		}
+		std::vector<std::thread> threads{};
+		threads.reserve(numThreads);
+		for (size_t t = 0; t < numThreads; ++t)
+		{
+			threads.emplace_back([&ptrs, t]
+			{
+				for (size_t i = 0; i < numAllocs; ++i)
+				{
+					ptrs[t].push_back(Malloc(16));
+				}
+			});
+		}
+		for (std::thread& thread : threads)
+		{
+			thread.join();
+		}
+		Profiler::Stop();
+
+		// the threads themselves may have allocated too
+		const size_t numLive = Profiler::NumLive();
+		REQUIRE(numLive >= numThreads * numAllocs);
+		for (auto& v : ptrs)
+		{
+			for (void*& p : v)
+			{
+				Free(p);
+			}
+		}
+		REQUIRE(Profiler::NumLive() == numLive - numThreads * numAllocs);
+		Profiler::Clear();
+	}
+}
@@ -97,4 +97,170 @@ namespace UnitTests
 		p = SharedPtr<int>::Make();
 		REQUIRE(p.Raw());
 	}
+
+	TEST(AtomicRefCount)
+	{
+		constexpr size_t numThreads = 4;
+		constexpr size_t numCopies = 1 << 14;
+		
+		auto shared = AtomicSharedPtr<int>::Make(7);
+		AtomicWeakPtr<int> weak = shared;
+
+		std::vector<std::thread> threads{};
+		std::atomic<size_t> numSeen{ 0 };
+		for (size_t i = 0; i < numThreads; ++i)
+		{
+			threads.emplace_back([&]
+			{
+				for (size_t j = 0; j < numCopies; ++j)
+				{
+					AtomicSharedPtr<int> copy = shared;
+					AtomicWeakPtr<int> weakCopy = copy;
+					numSeen += *AtomicSharedPtr<int>(weakCopy) == 7;
+				}
+			});
+		}
+		for (std::thread& thread : threads)
+		{
+			thread.join();
+		}
+
+		REQUIRE(numSeen == numThreads * numCopies);
+		REQUIRE(shared.ReferenceCount() == 1);
+		
+		shared = nullptr;
+		REQUIRE(weak.Expired());
+	}
+
+	TEST(MakeArray)
+	{
+		auto a = SharedPtr<std::string>::MakeArray(3, "hi");
+		REQUIRE(a.Size() == 3);
+		for (const std::string& s : a)
+		{
+			REQUIRE(s == "hi");
+		}
+		a[1] = "hello";
+		REQUIRE(a.Span()[1] == "hello");
+		REQUIRE_THROWS_AS(a[3], std::out_of_range);
+
+		auto b = a;
+		REQUIRE(a.ReferenceCount() == 2);
+		REQUIRE(b == a);
+
+		// value-initialized without args
+		auto c = SharedPtr<int[]>::Make(4);
+		REQUIRE(std::ranges::count(c.Span(), 0) == 4);
+
+		SharedPtr<int[]> empty;
+		REQUIRE(empty.IsEmpty());
+		REQUIRE(!empty);
+		REQUIRE(empty.begin() == empty.end());
+	}
+
+	/**
+	 * Keeps track of how many are alive, and throws from the ctor once throwAt are.
+	 */
+	struct Counter
+	{
+		static inline int numAlive = 0;
+		static inline int throwAt = -1;
+		Counter()
+		{
+			if (numAlive == throwAt)
+			{
+				throw std::runtime_error("Counter");
+			}
+			++numAlive;
+		}
+		~Counter() { --numAlive; }
+	};
+
+	TEST(MakeArray dtor)
+	{
+		{
+			auto a = SharedPtr<Counter[]>::Make(10);
+			REQUIRE(Counter::numAlive == 10);
+			auto b = std::move(a);
+			REQUIRE(a.Size() == 0);
+			REQUIRE(Counter::numAlive == 10);
+		}
+		REQUIRE(Counter::numAlive == 0);
+
+		// the objects constructed before the throw are cleaned up
+		Counter::throwAt = 5;
+		REQUIRE_THROWS_AS(SharedPtr<Counter[]>::Make(10), std::runtime_error);
+		REQUIRE(Counter::numAlive == 0);
+		Counter::throwAt = -1;
+	}
+
+	TEST(MakeArray Defrag)
+	{
+		// one Handle for the whole run
+		const size_t numHandles = Memory::Manager::GetGenerationStats()[0].numHandles;
+		auto a = SharedPtr<uint64_t>::MakeArray(16);
+		REQUIRE(Memory::Manager::GetGenerationStats()[0].numHandles == numHandles + 1);
+
+		// leave a gap below the array so Defrag has to move it
+		auto gap = SharedPtr<uint64_t>::MakeArray(4);
+		auto b = SharedPtr<uint64_t>::MakeArray(16);
+		for (size_t i = 0; i < b.Size(); ++i)
+		{
+			b[i] = i;
+		}
+		const uint64_t* before = b.Raw();
+		gap = nullptr;
+		Memory::Manager::Defrag();
+
+		REQUIRE(b.Raw() != before);
+		for (size_t i = 0; i < b.Size(); ++i)
+		{
+			REQUIRE(b[i] == i);
+		}
+	}
+
+	TEST(MakePinned)
+	{
+		auto pinned = SharedPtr<std::string>::MakePinned("hello");
+		REQUIRE(*pinned == "hello");
+		REQUIRE(pinned->size() == 5);
+		REQUIRE(pinned.ReferenceCount() == 1);
+
+		SharedPtr<std::string> shared = pinned;
+		WeakPtr<std::string> weak = shared;
+		REQUIRE(pinned.ReferenceCount() == 2);
+		REQUIRE(shared.Raw() == pinned.Raw());
+
+		PinnedPtr<std::string> moved = std::move(pinned);
+		REQUIRE(!pinned);
+		REQUIRE_THROWS_AS(*pinned, NullReferenceException);
+		REQUIRE(*moved == "hello");
+
+		moved = nullptr;
+		shared = nullptr;
+		REQUIRE(weak.Expired());
+	}
+
+	TEST(MakePinned Defrag)
+	{
+		// surrounded by objects that do move
+		auto gap = SharedPtr<uint64_t>::Make(0);
+		auto pinned = SharedPtr<uint64_t>::MakePinned(5);
+		auto moved = SharedPtr<uint64_t>::Make(6);
+		const uint64_t* before = pinned.Raw();
+		const uint64_t* movedBefore = moved.Raw();
+		gap = nullptr;
+
+		Memory::Manager::Defrag();
+		Memory::Manager::Graduate();
+		REQUIRE(moved.Raw() != movedBefore);
+		REQUIRE(pinned.Raw() == before);
+		REQUIRE(*pinned == 5);
+
+		// freed once unused
+		pinned = nullptr;
+		moved = nullptr;
+		Memory::Manager::Defrag();
+		REQUIRE(Memory::Manager::IsEmpty());
+	}
 }
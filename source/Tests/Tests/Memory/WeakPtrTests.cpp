@@ -30,6 +30,18 @@ namespace UnitTests
 		REQUIRE(b.Raw() == a.Raw());
 	}
 
+	TEST(operator SharedPtr after Expired)
+	{
+		WeakPtr<int> weak;
+		{
+			const SharedPtr<int> shared = SharedPtr<int>::Make();
+			weak = shared;
+		}
+		const SharedPtr<int> shared = weak;
+		REQUIRE(!shared);
+		REQUIRE(weak.ReferenceCount() == 0);
+	}
+
 	TEST(Expired)
 	{
 		WeakPtr<int> weak;
@@ -0,0 +1,157 @@
+#include "../../pch.h"
+#include "Parallel.h"
+
+using namespace std::string_literals;
+using namespace Library;
+using namespace Library::Util;
+
+// No MemLeak since the Workers' threads outlive each test.
+#define TEST(name) TEST_CASE("Parallel::" #name, "[Parallel]")
+
+namespace UnitTests
+{
+	// more than one even on a machine with a single core, so the tasks really do interleave
+	constexpr size_t numWorkers = 4;
+	constexpr size_t numElements = 10'000;
+	constexpr size_t grainSize = 100;
+
+	static Array<int> RandomArray()
+	{
+		Array<int> ret(numElements);
+		for (size_t i = 0; i < numElements; ++i)
+		{
+			ret.PushBack(Random::Range<int>(-1000, 1000));
+		}
+		return ret;
+	}
+
+	TEST(Run)
+	{
+		Parallel::Workers::SetCount(numWorkers);
+		REQUIRE(Parallel::Workers::Count() == numWorkers);
+
+		std::vector<std::atomic<size_t>> counts(1000);
+		Parallel::Workers::Run(counts.size(), [&counts](const size_t i) { ++counts[i]; });
+		for (const auto& count : counts)
+		{
+			REQUIRE(count == 1);
+		}
+
+		// a Run inside a task is done by whoever is running that task
+		std::atomic<size_t> total = 0;
+		Parallel::Workers::Run(10, [&total](size_t)
+		{
+			Parallel::Workers::Run(10, [&total](size_t) { ++total; });
+		});
+		REQUIRE(total == 100);
+
+		Parallel::Workers::SetCount(1);
+		REQUIRE(Parallel::Workers::Count() == 1);
+		total = 0;
+		Parallel::Workers::Run(10, [&total](size_t) { ++total; });
+		REQUIRE(total == 10);
+	}
+
+	TEST(Exception)
+	{
+		Parallel::Workers::SetCount(numWorkers);
+		std::atomic<size_t> total = 0;
+		REQUIRE_THROWS_AS(Parallel::Workers::Run(1000, [&total](const size_t i)
+		{
+			if (i == 10)
+			{
+				throw std::runtime_error("task " + std::to_string(i));
+			}
+			++total;
+		}), std::runtime_error);
+		REQUIRE(total < 1000);
+
+		// still usable afterwards
+		total = 0;
+		Parallel::Workers::Run(1000, [&total](size_t) { ++total; });
+		REQUIRE(total == 1000);
+	}
+
+	TEST(ForEach)
+	{
+		Parallel::Workers::SetCount(numWorkers);
+		Array<int> a = RandomArray();
+		Array<int> expected = a;
+		Parallel::ForEach(a, [](int& i) { i *= 2; }, grainSize);
+		std::for_each(expected.begin(), expected.end(), [](int& i) { i *= 2; });
+		REQUIRE(a == expected);
+
+		Array<int> empty;
+		Parallel::ForEach(empty, [](int&) { FAIL(); });
+	}
+
+	TEST(Transform)
+	{
+		Parallel::Workers::SetCount(numWorkers);
+		const Array<int> a = RandomArray();
+		std::vector<std::string> out(a.Size());
+		REQUIRE(Parallel::Transform(a, out.begin(), [](const int i) { return std::to_string(i); }, grainSize) == out.end());
+		for (size_t i = 0; i < a.Size(); ++i)
+		{
+			REQUIRE(out[i] == std::to_string(a[i]));
+		}
+	}
+
+	TEST(Reduce)
+	{
+		Parallel::Workers::SetCount(numWorkers);
+		const Array<int> a = RandomArray();
+		REQUIRE(Parallel::Reduce(a, 0ll, std::plus<>{}, grainSize) == std::accumulate(a.begin(), a.end(), 0ll));
+
+		// associative but not commutative, so the order has to be kept
+		Array<std::string> strings;
+		for (size_t i = 0; i < 1000; ++i)
+		{
+			strings.PushBack(std::to_string(i));
+		}
+		REQUIRE(Parallel::Reduce(strings, "start"s, std::plus<>{}, 7) == std::accumulate(strings.begin(), strings.end(), "start"s));
+
+		REQUIRE(Parallel::Reduce(Array<int>(), 5, std::plus<>{}) == 5);
+	}
+
+	TEST(Sort)
+	{
+		Parallel::Workers::SetCount(numWorkers);
+		for (const size_t grain : { size_t(1), size_t(7), grainSize, numElements, numElements * 2 })
+		{
+			Array<int> a = RandomArray();
+			Array<int> expected = a;
+			Parallel::Sort(a, std::less<>{}, grain);
+			std::sort(expected.begin(), expected.end());
+			REQUIRE(a == expected);
+
+			Parallel::Sort(a, std::greater<>{}, grain);
+			REQUIRE(std::is_sorted(a.begin(), a.end(), std::greater<>{}));
+		}
+	}
+
+	TEST(Partition)
+	{
+		Parallel::Workers::SetCount(numWorkers);
+		for (const size_t grain : { size_t(1), size_t(7), grainSize, numElements * 2 })
+		{
+			Array<int> a = RandomArray();
+			Array<int> expected = a;
+			const auto isEven = [](const int i) { return i % 2 == 0; };
+
+			const auto middle = Parallel::Partition(a, isEven, grain);
+			REQUIRE(size_t(middle - a.begin()) == size_t(std::count_if(expected.begin(), expected.end(), isEven)));
+			REQUIRE(std::all_of(a.begin(), middle, isEven));
+			REQUIRE(std::none_of(middle, a.end(), isEven));
+
+			std::sort(a.begin(), a.end());
+			std::sort(expected.begin(), expected.end());
+			REQUIRE(a == expected);
+		}
+
+		Array<std::string> strings{ "a", "bb", "ccc", "dddd", "eeeee" };
+		const auto middle = Parallel::Partition(strings, [](const std::string& s) { return s.size() % 2 == 1; }, 2);
+		REQUIRE(middle - strings.begin() == 3);
+		REQUIRE(std::is_permutation(strings.begin(), strings.end(), Array<std::string>{ "a", "ccc", "eeeee", "bb", "dddd" }.begin()));
+	}
+}
@@ -1,3 +1,5 @@
 // This tells Catch to provide a main() - only do this in one cpp file
 #define CATCH_CONFIG_MAIN
+// Benchmarks are tagged [.] so they only run when explicitly asked for, e.g. `Tests [benchmark]`
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
 #include <catch2/catch.hpp>
@@ -5,6 +5,7 @@
 // Standard
 #include <algorithm>
 #include <atomic>
+#include <bit>
 #include <bitset>
 #include <chrono>
 #include <cinttypes>
@@ -23,6 +24,7 @@
 #include <memory>
 
 // External
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
 #include <catch2/catch.hpp>
 
 // Library
@@ -40,6 +42,7 @@
 #include "Input.h"
 // Memory
 #include "Memory.h"
+#include "Pages.h"
 #include "SmartPtr.h"
 #include "InternedString.h"
 // Util